@@ -10,8 +10,9 @@ std::shared_ptr<provider::Invalidator<Connection>> Connection::getInvalidator()
   return m_invalidator;
 }
 
-ConnectionImpl::ConnectionImpl(MYSQL* mysql)
+ConnectionImpl::ConnectionImpl(MYSQL* mysql, bool nonBlocking)
   : m_connection(mysql)
+  , m_nonBlocking(nonBlocking)
 {}
 
 ConnectionImpl::~ConnectionImpl() {
@@ -22,4 +23,8 @@ MYSQL* ConnectionImpl::getHandle() {
   return m_connection;
 }
 
+bool ConnectionImpl::isNonBlocking() {
+  return m_nonBlocking;
+}
+
 }}
\ No newline at end of file
@@ -24,6 +24,13 @@ public:
    */
   virtual MYSQL* getHandle() = 0;
 
+  /**
+   * Check if connection socket is driven by &id:oatpp::mysql::NonBlockingEngine;. <br>
+   * Such connection can only be used with &id:oatpp::mysql::Executor::executeAsync;.
+   * @return - `true` if connection is non-blocking.
+   */
+  virtual bool isNonBlocking() = 0;
+
   void setInvalidator(const std::shared_ptr<provider::Invalidator<Connection>>& invalidator);
   std::shared_ptr<provider::Invalidator<Connection>> getInvalidator();
 
@@ -32,14 +39,17 @@ public:
 class ConnectionImpl : public Connection {
 private:
   MYSQL* m_connection;
+  bool m_nonBlocking;
 
 public:
 
-  ConnectionImpl(MYSQL* connection);
+  ConnectionImpl(MYSQL* connection, bool nonBlocking = false);
   ~ConnectionImpl();
 
   MYSQL* getHandle() override;
 
+  bool isNonBlocking() override;
+
 };
 
 struct ConnectionAcquisitionProxy : public provider::AcquisitionProxy<Connection, ConnectionAcquisitionProxy> {
@@ -51,6 +61,10 @@ struct ConnectionAcquisitionProxy : public provider::AcquisitionProxy<Connection
   MYSQL* getHandle() override {
     return _handle.object->getHandle();
   }
+
+  bool isNonBlocking() override {
+    return _handle.object->isNonBlocking();
+  }
 };
 
 }}
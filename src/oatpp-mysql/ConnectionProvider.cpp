@@ -1,4 +1,31 @@
 #include "ConnectionProvider.hpp"
+#include "NonBlockingEngine.hpp"
+#include "Utils.hpp"
+
+#include "oatpp/Environment.hpp"
+
+#ifdef _WIN32
+  #include <winsock2.h>
+#else
+  #include <netinet/in.h>
+  #include <netinet/tcp.h>
+  #include <sys/socket.h>
+#endif
+
+#if !defined(MARIADB_BASE_VERSION) && !defined(MARIADB_PACKAGE_VERSION_ID)
+  // MYSQL_OPT_SSL_MODE - since 5.7.11
+  #if MYSQL_VERSION_ID >= 50711
+    #define OATPP_MYSQL_SSL_MODE_API
+  #endif
+  // MYSQL_OPT_SSL_SESSION_DATA, mysql_get_ssl_session_data() - since 8.0.29
+  #if MYSQL_VERSION_ID >= 80029
+    #define OATPP_MYSQL_SSL_SESSION_API
+  #endif
+  // MYSQL_OPT_COMPRESSION_ALGORITHMS, MYSQL_OPT_ZSTD_COMPRESSION_LEVEL - since 8.0.18
+  #if MYSQL_VERSION_ID >= 80018
+    #define OATPP_MYSQL_COMPRESSION_ALGORITHMS_API
+  #endif
+#endif
 
 namespace oatpp { namespace mysql {
 
@@ -7,42 +34,330 @@ void ConnectionProvider::ConnectionInvalidator::invalidate(const std::shared_ptr
   // TODO: implement connection invalidation
 }
 
-ConnectionProvider::ConnectionProvider(const ConnectionOptions& options)
-  : m_options(options)
-  , m_invalidator(std::make_shared<ConnectionInvalidator>())
+ConnectionProvider::HandshakeCache::HandshakeCache()
+  : m_connectsCount(0)
+  , m_connectsMicros(0)
+  , m_reusedCount(0)
+  , m_reusedMicros(0)
 {}
 
-provider::ResourceHandle<Connection> ConnectionProvider::get() {
+void ConnectionProvider::HandshakeCache::applySession(MYSQL* handle, const ConnectionOptions& options) {
+#ifdef OATPP_MYSQL_SSL_SESSION_API
+  if(!options.sslSessionReuse || options.sslMode == SslMode::DISABLED) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(m_lock);
+  if(!m_sessionData.empty()) {
+    // session data is copied by the client library
+    mysql_options(handle, MYSQL_OPT_SSL_SESSION_DATA, m_sessionData.c_str());
+  }
+#else
+  (void) handle;
+  (void) options;
+#endif
+}
+
+void ConnectionProvider::HandshakeCache::onConnected(MYSQL* handle, const ConnectionOptions& options, v_int64 micros) {
+
+  m_connectsCount ++;
+  m_connectsMicros += micros;
+
+#ifdef OATPP_MYSQL_SSL_SESSION_API
+
+  if(mysql_get_ssl_session_reused(handle)) {
+    m_reusedCount ++;
+    m_reusedMicros += micros;
+  }
+
+  if(!options.sslSessionReuse || options.sslMode == SslMode::DISABLED) {
+    return;
+  }
+
+  // keep the freshest session - server may rotate ticket keys
+  unsigned int size = 0;
+  void* data = mysql_get_ssl_session_data(handle, 0, &size);
+  if(data != nullptr) {
+    std::string session((const char*) data, size);
+    mysql_free_ssl_session_data(handle, data);
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_sessionData = std::move(session);
+  }
+
+#else
+  (void) handle;
+  (void) options;
+#endif
+
+}
+
+ConnectionProvider::HandshakeStats ConnectionProvider::HandshakeCache::getStats() {
+  HandshakeStats stats;
+  stats.connectsCount = m_connectsCount;
+  stats.connectsMicros = m_connectsMicros;
+  stats.reusedCount = m_reusedCount;
+  stats.reusedMicros = m_reusedMicros;
+  return stats;
+}
+
+ConnectionProvider::ConnectionProvider(const ConnectionOptions& options, const std::shared_ptr<WorkerPool>& workerPool)
+  : m_invalidator(std::make_shared<ConnectionInvalidator>())
+  , m_handshakeCache(std::make_shared<HandshakeCache>())
+  , m_options(options)
+  , m_workerPool(workerPool)
+{
+  if(!m_workerPool) {
+    m_workerPool = std::make_shared<WorkerPool>();
+  }
+}
+
+MYSQL* ConnectionProvider::createHandle(const ConnectionOptions& options) {
+
   MYSQL* handle = mysql_init(nullptr);
   if (handle == nullptr) {
-      throw std::runtime_error("[oatpp::mysql::ConnectionProvider::get()]: " 
-        "Failed to initialize MySQL connection. Error: " + std::string(mysql_error(handle)));
-  }
-    
-  MYSQL* result = mysql_real_connect(handle, 
-    m_options.host->c_str(), 
-    m_options.username->c_str(), 
-    m_options.password->c_str(), 
-    m_options.database->c_str(), 
-    m_options.port, 
-    nullptr, 
-    0);
+    throw std::runtime_error("[oatpp::mysql::ConnectionProvider::createHandle()]: "
+      "Failed to initialize MySQL connection.");
+  }
 
-  if (result == nullptr) {
-    throw std::runtime_error("[oatpp::mysql::ConnectionProvider::get()]: " 
-      "Failed to connect to MySQL server. Error: " + std::string(mysql_error(handle)));
+  // charset is negotiated during the handshake - no extra round trip after connect
+  if (options.charset) {
+    mysql_options(handle, MYSQL_SET_CHARSET_NAME, options.charset->c_str());
+  }
+
+  if (options.unixSocket) {
+    unsigned int protocol = MYSQL_PROTOCOL_SOCKET;
+#ifdef _WIN32
+    protocol = MYSQL_PROTOCOL_PIPE;
+#endif
+    mysql_options(handle, MYSQL_OPT_PROTOCOL, &protocol);
+  }
+
+  switch (options.compression) {
+    case Compression::NONE:
+      break;
+    case Compression::ZLIB: {
+#ifdef OATPP_MYSQL_COMPRESSION_ALGORITHMS_API
+      mysql_options(handle, MYSQL_OPT_COMPRESSION_ALGORITHMS, "zlib");
+#else
+      mysql_options(handle, MYSQL_OPT_COMPRESS, nullptr);
+#endif
+      break;
+    }
+    case Compression::ZSTD: {
+#ifdef OATPP_MYSQL_COMPRESSION_ALGORITHMS_API
+      mysql_options(handle, MYSQL_OPT_COMPRESSION_ALGORITHMS, "zstd");
+      if (options.compressionLevel > 0) {
+        unsigned int level = options.compressionLevel;
+        mysql_options(handle, MYSQL_OPT_ZSTD_COMPRESSION_LEVEL, &level);
+      }
+#else
+      mysql_close(handle);
+      throw std::runtime_error("[oatpp::mysql::ConnectionProvider::createHandle()]: "
+        "zstd compression requires MySQL client library 8.0.18 or later. MariaDB Connector/C supports zlib only.");
+#endif
+      break;
+    }
+  }
+
+  configureSsl(handle, options);
+
+  if (options.trackGtids) {
+    mysql_options(handle, MYSQL_INIT_COMMAND, "SET SESSION session_track_gtids = OWN_GTID");
+  }
+
+  if (options.connectTimeout > 0) {
+    unsigned int timeout = options.connectTimeout;
+    mysql_options(handle, MYSQL_OPT_CONNECT_TIMEOUT, &timeout);
+  }
+
+  if (options.readTimeout > 0) {
+    unsigned int timeout = options.readTimeout;
+    mysql_options(handle, MYSQL_OPT_READ_TIMEOUT, &timeout);
+  }
+
+  if (options.writeTimeout > 0) {
+    unsigned int timeout = options.writeTimeout;
+    mysql_options(handle, MYSQL_OPT_WRITE_TIMEOUT, &timeout);
+  }
+
+  return handle;
+
+}
+
+void ConnectionProvider::configureSsl(MYSQL* handle, const ConnectionOptions& options) {
+
+  if (options.sslCa) {
+    mysql_options(handle, MYSQL_OPT_SSL_CA, options.sslCa->c_str());
   }
 
-  if (mysql_set_character_set(handle, "utf8") != 0) {
+  if (options.sslCert) {
+    mysql_options(handle, MYSQL_OPT_SSL_CERT, options.sslCert->c_str());
+  }
+
+  if (options.sslKey) {
+    mysql_options(handle, MYSQL_OPT_SSL_KEY, options.sslKey->c_str());
+  }
+
+#ifdef OATPP_MYSQL_SSL_MODE_API
+
+  unsigned int mode = SSL_MODE_PREFERRED;
+  switch (options.sslMode) {
+    case SslMode::DISABLED: mode = SSL_MODE_DISABLED; break;
+    case SslMode::PREFERRED: mode = SSL_MODE_PREFERRED; break;
+    case SslMode::REQUIRED: mode = SSL_MODE_REQUIRED; break;
+    case SslMode::VERIFY_CA: mode = SSL_MODE_VERIFY_CA; break;
+    case SslMode::VERIFY_IDENTITY: mode = SSL_MODE_VERIFY_IDENTITY; break;
+  }
+  mysql_options(handle, MYSQL_OPT_SSL_MODE, &mode);
+
+#if MYSQL_VERSION_ID >= 80003
+  if (options.getServerPublicKey) {
+    bool value = true;
+    mysql_options(handle, MYSQL_OPT_GET_SERVER_PUBLIC_KEY, &value);
+  }
+#endif
+
+#else
+
+  // MariaDB Connector/C has no ssl mode - enforce and verify flags only
+  if (options.sslMode == SslMode::REQUIRED || options.sslMode == SslMode::VERIFY_CA ||
+      options.sslMode == SslMode::VERIFY_IDENTITY)
+  {
+    my_bool enforce = 1;
+    mysql_options(handle, MYSQL_OPT_SSL_ENFORCE, &enforce);
+  }
+
+  if (options.sslMode == SslMode::VERIFY_CA || options.sslMode == SslMode::VERIFY_IDENTITY) {
+    my_bool verify = 1;
+    mysql_options(handle, MYSQL_OPT_SSL_VERIFY_SERVER_CERT, &verify);
+  }
+
+#endif
+
+}
+
+// client libraries have no options for these - set on the socket of the new connection
+void ConnectionProvider::configureSocket(MYSQL* handle, const ConnectionOptions& options) {
+
+  // socket options are for TCP only
+  if (options.unixSocket) {
+    return;
+  }
+
+  my_socket fd = Utils::getSocket(handle);
+
+  if (!options.tcpNoDelay) {
+    int value = 0;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (const char*) &value, sizeof(value));
+  }
+
+  if (options.tcpKeepAlive) {
+    int value = 1;
+    setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, (const char*) &value, sizeof(value));
+#if defined(TCP_KEEPIDLE)
+    if (options.tcpKeepAliveIdle > 0) {
+      int idle = (int) options.tcpKeepAliveIdle;
+      setsockopt(fd, IPPROTO_TCP, TCP_KEEPIDLE, (const char*) &idle, sizeof(idle));
+    }
+#elif defined(TCP_KEEPALIVE)
+    if (options.tcpKeepAliveIdle > 0) {
+      int idle = (int) options.tcpKeepAliveIdle;
+      setsockopt(fd, IPPROTO_TCP, TCP_KEEPALIVE, (const char*) &idle, sizeof(idle));
+    }
+#endif
+  }
+
+}
+
+provider::ResourceHandle<Connection> ConnectionProvider::connect(const ConnectionOptions& options,
+                                                                 const std::shared_ptr<ConnectionInvalidator>& invalidator,
+                                                                 const std::shared_ptr<HandshakeCache>& handshakeCache)
+{
+  MYSQL* handle = createHandle(options);
+  handshakeCache->applySession(handle, options);
+
+  v_int64 startTime = oatpp::Environment::getMicroTickCount();
+
+  MYSQL* result = mysql_real_connect(handle,
+    options.host ? options.host->c_str() : nullptr,
+    options.username ? options.username->c_str() : nullptr,
+    options.password ? options.password->c_str() : nullptr,
+    options.database ? options.database->c_str() : nullptr,
+    options.port,
+    options.unixSocket ? options.unixSocket->c_str() : nullptr,
+    options.clientFlags);
+
+  if (result == nullptr) {
+    std::string error = mysql_error(handle);
+    mysql_close(handle);
     throw std::runtime_error("[oatpp::mysql::ConnectionProvider::get()]: " 
-      "Failed to set character set to utf8. Error: " + std::string(mysql_error(handle)));
+      "Failed to connect to MySQL server. Error: " + error);
   }
 
-  return provider::ResourceHandle<Connection>(std::make_shared<ConnectionImpl>(handle), m_invalidator);
+  handshakeCache->onConnected(handle, options, oatpp::Environment::getMicroTickCount() - startTime);
+  configureSocket(handle, options);
+
+  return provider::ResourceHandle<Connection>(std::make_shared<ConnectionImpl>(handle), invalidator);
+}
+
+provider::ResourceHandle<Connection> ConnectionProvider::get() {
+  // a blocking connection would be pooled together with the non-blocking ones and handed to executeAsync()
+  if(m_options.useNonBlockingEngine && NonBlockingEngine::isSupported()) {
+    throw std::runtime_error("[oatpp::mysql::ConnectionProvider::get()]: "
+      "Error. Provider makes non-blocking connections - use getAsync(). Blocking queries need a separate provider.");
+  }
+  return connect(m_options, m_invalidator, m_handshakeCache);
 }
 
 async::CoroutineStarterForResult<const provider::ResourceHandle<Connection>&> ConnectionProvider::getAsync() {
-  throw std::runtime_error("[oatpp::mysql::ConnectionProvider::getAsync()]: Not implemented!");
+
+  if(m_options.useNonBlockingEngine && NonBlockingEngine::isSupported()) {
+
+    class ConnectCoroutine : public async::CoroutineWithResult<ConnectCoroutine, const provider::ResourceHandle<Connection>&> {
+    private:
+      ConnectionOptions m_options;
+      std::shared_ptr<ConnectionInvalidator> m_invalidator;
+      std::shared_ptr<HandshakeCache> m_handshakeCache;
+      v_int64 m_startTime;
+    public:
+
+      ConnectCoroutine(const ConnectionOptions& options,
+                       const std::shared_ptr<ConnectionInvalidator>& invalidator,
+                       const std::shared_ptr<HandshakeCache>& handshakeCache)
+        : m_options(options)
+        , m_invalidator(invalidator)
+        , m_handshakeCache(handshakeCache)
+        , m_startTime(0)
+      {}
+
+      Action act() override {
+        MYSQL* handle = createHandle(m_options);
+        m_handshakeCache->applySession(handle, m_options);
+        m_startTime = oatpp::Environment::getMicroTickCount();
+        return NonBlockingEngine::connect(handle, m_options).callbackTo(&ConnectCoroutine::onConnected);
+      }
+
+      Action onConnected(MYSQL* handle) {
+        m_handshakeCache->onConnected(handle, m_options, oatpp::Environment::getMicroTickCount() - m_startTime);
+        configureSocket(handle, m_options);
+        return _return(provider::ResourceHandle<Connection>(std::make_shared<ConnectionImpl>(handle, true), m_invalidator));
+      }
+
+    };
+
+    return ConnectCoroutine::startForResult(m_options, m_invalidator, m_handshakeCache);
+
+  }
+
+  auto options = m_options;
+  auto invalidator = m_invalidator;
+  auto handshakeCache = m_handshakeCache;
+  return m_workerPool->execute<provider::ResourceHandle<Connection>>([options, invalidator, handshakeCache]() {
+    return connect(options, invalidator, handshakeCache);
+  });
+}
+
+ConnectionProvider::HandshakeStats ConnectionProvider::getHandshakeStats() {
+  return m_handshakeCache->getStats();
 }
 
 void ConnectionProvider::stop() {
@@ -2,21 +2,225 @@
 #define oatpp_mysql_ConnectionProvider_hpp
 
 #include "Connection.hpp"
+#include "WorkerPool.hpp"
 
 #include "oatpp/provider/Pool.hpp"
 #include "oatpp/Types.hpp"
 
+#include <atomic>
+#include <mutex>
+#include <string>
+
 namespace oatpp { namespace mysql {
 
+/**
+ * Protocol compression algorithm.
+ */
+enum class Compression : v_int32 {
+
+  /**
+   * No compression.
+   */
+  NONE = 0,
+
+  /**
+   * zlib compression.
+   */
+  ZLIB = 1,
+
+  /**
+   * zstd compression. Requires MySQL client library 8.0.18 or later - not available with MariaDB Connector/C.
+   */
+  ZSTD = 2
+
+};
+
+/**
+ * TLS mode of the connection - `MYSQL_OPT_SSL_MODE`.
+ */
+enum class SslMode : v_int32 {
+
+  /**
+   * Unencrypted connection.
+   */
+  DISABLED = 0,
+
+  /**
+   * Encrypted if server supports it. Client library default.
+   */
+  PREFERRED = 1,
+
+  /**
+   * Encrypted. Server certificate is not verified.
+   */
+  REQUIRED = 2,
+
+  /**
+   * Encrypted. Server certificate is verified against &l:ConnectionOptions::sslCa;.
+   */
+  VERIFY_CA = 3,
+
+  /**
+   * Same as &l:SslMode::VERIFY_CA; plus server host name is verified against the certificate.
+   */
+  VERIFY_IDENTITY = 4
+
+};
+
+/**
+ * Connection options.
+ */
 struct ConnectionOptions {
   oatpp::String host;
-  v_uint16 port;
+  v_uint16 port = 3306;
   oatpp::String database;
   oatpp::String username;
   oatpp::String password;
+
+  /**
+   * Path to the unix domain socket (named pipe on Windows) of the co-located server. <br>
+   * If set - connection is made through the socket instead of TCP and &l:ConnectionOptions::host; may be left `nullptr`.
+   */
+  oatpp::String unixSocket;
+
+  /**
+   * Connection character set. Set during the handshake, so no extra `SET NAMES` round trip is made. <br>
+   * Should match the server charset to avoid server-side transcoding.
+   */
+  oatpp::String charset = "utf8mb4";
+
+  /**
+   * Connect timeout in seconds - `MYSQL_OPT_CONNECT_TIMEOUT`. `0` - client library default.
+   */
+  v_uint32 connectTimeout = 0;
+
+  /**
+   * Read timeout in seconds - `MYSQL_OPT_READ_TIMEOUT`. `0` - client library default.
+   */
+  v_uint32 readTimeout = 0;
+
+  /**
+   * Write timeout in seconds - `MYSQL_OPT_WRITE_TIMEOUT`. `0` - client library default.
+   */
+  v_uint32 writeTimeout = 0;
+
+  /**
+   * Disable Nagle's algorithm on the TCP socket. Client library enables `TCP_NODELAY` by default. <br>
+   * Client library has no option for it - `false` is set on the socket once connected, and is lost if the client
+   * library reconnects the handle by itself (`MYSQL_OPT_RECONNECT`, not enabled by the provider).
+   */
+  bool tcpNoDelay = true;
+
+  /**
+   * Enable TCP keepalive probes on the connection socket. <br>
+   * Set on the socket once connected, same as &l:ConnectionOptions::tcpNoDelay; - not kept on reconnect by the client library.
+   */
+  bool tcpKeepAlive = false;
+
+  /**
+   * Idle time in seconds before the first keepalive probe is sent. `0` - system default.
+   */
+  v_uint32 tcpKeepAliveIdle = 0;
+
+  /**
+   * Protocol compression. Pays off for large result sets over the bandwidth-bound links.
+   * Use &id:oatpp::mysql::Executor::setCompressedConnectionProvider; to compress selected queries only.
+   */
+  Compression compression = Compression::NONE;
+
+  /**
+   * Compression level for &l:Compression::ZSTD; - `MYSQL_OPT_ZSTD_COMPRESSION_LEVEL` `[1..22]`. `0` - default level (3).
+   */
+  v_uint32 compressionLevel = 0;
+
+  /**
+   * TLS mode.
+   */
+  SslMode sslMode = SslMode::PREFERRED;
+
+  /**
+   * Path to the PEM file with trusted CA certificates - `MYSQL_OPT_SSL_CA`.
+   */
+  oatpp::String sslCa;
+
+  /**
+   * Path to the PEM file with client certificate - `MYSQL_OPT_SSL_CERT`.
+   */
+  oatpp::String sslCert;
+
+  /**
+   * Path to the PEM file with client private key - `MYSQL_OPT_SSL_KEY`.
+   */
+  oatpp::String sslKey;
+
+  /**
+   * Resume TLS session of the previous connection made by the same provider - `MYSQL_OPT_SSL_SESSION_DATA`. <br>
+   * Resumed session skips certificate exchange and key agreement, which is the most of the handshake CPU cost.
+   * Requires mysql client library 8.0.29 or later, ignored otherwise.
+   */
+  bool sslSessionReuse = true;
+
+  /**
+   * Request RSA public key from the server for `caching_sha2_password` full authentication
+   * over the unencrypted connection - `MYSQL_OPT_GET_SERVER_PUBLIC_KEY`. <br>
+   * Server caches the password hash after the first full authentication,
+   * so the following connections of the same user take the single round trip fast-auth path.
+   */
+  bool getServerPublicKey = false;
+
+  /**
+   * Report GTID of every committed transaction to the client - `session_track_gtids = OWN_GTID`. <br>
+   * Set with `MYSQL_INIT_COMMAND`, so it's applied during connect and on reconnect.
+   * Required on the primary for &id:oatpp::mysql::ConsistencySession;.
+   */
+  bool trackGtids = false;
+
+  /**
+   * Client flags passed to `mysql_real_connect`. Ex.: `CLIENT_FOUND_ROWS`, `CLIENT_MULTI_STATEMENTS`.
+   */
+  unsigned long clientFlags = 0;
+
+  /**
+   * Connections acquired with `getAsync()` are driven by &id:oatpp::mysql::NonBlockingEngine;
+   * instead of blocking the &id:oatpp::mysql::WorkerPool; thread. <br>
+   * Such connections can only be used with &id:oatpp::mysql::Executor::executeAsync;, so the provider makes
+   * no blocking connections - `get()` throws. Pool of this provider never mixes the two kinds of connections,
+   * blocking queries use a separate provider - see &id:oatpp::mysql::Executor::setNonBlockingConnectionProvider;. <br>
+   * Ignored if mysql client library has no non-blocking API.
+   */
+  bool useNonBlockingEngine = false;
 };
 
 class ConnectionProvider : public provider::Provider<Connection> {
+public:
+
+  /**
+   * Connection handshake statistics.
+   */
+  struct HandshakeStats {
+
+    /**
+     * Number of successful connects.
+     */
+    v_int64 connectsCount;
+
+    /**
+     * Total time spent in connects in microseconds.
+     */
+    v_int64 connectsMicros;
+
+    /**
+     * Number of connects which resumed TLS session.
+     */
+    v_int64 reusedCount;
+
+    /**
+     * Total time spent in connects which resumed TLS session in microseconds.
+     */
+    v_int64 reusedMicros;
+
+  };
+
 private:
 
   class ConnectionInvalidator : public provider::Invalidator<Connection> {
@@ -24,30 +228,75 @@ private:
     void invalidate(const std::shared_ptr<Connection>& connection) override;
   };
 
+private:
+
+  /*
+   * TLS session of the last connection and handshake stats - shared by all connects of the provider.
+   */
+  class HandshakeCache {
+  private:
+    std::mutex m_lock;
+    std::string m_sessionData;
+    std::atomic<v_int64> m_connectsCount;
+    std::atomic<v_int64> m_connectsMicros;
+    std::atomic<v_int64> m_reusedCount;
+    std::atomic<v_int64> m_reusedMicros;
+  public:
+
+    HandshakeCache();
+
+    void applySession(MYSQL* handle, const ConnectionOptions& options);
+    void onConnected(MYSQL* handle, const ConnectionOptions& options, v_int64 micros);
+
+    HandshakeStats getStats();
+
+  };
+
 private:
   std::shared_ptr<ConnectionInvalidator> m_invalidator;
+  std::shared_ptr<HandshakeCache> m_handshakeCache;
   ConnectionOptions m_options;
+  std::shared_ptr<WorkerPool> m_workerPool;
+
+private:
+  static MYSQL* createHandle(const ConnectionOptions& options);
+  static void configureSsl(MYSQL* handle, const ConnectionOptions& options);
+  static void configureSocket(MYSQL* handle, const ConnectionOptions& options);
+  static provider::ResourceHandle<Connection> connect(const ConnectionOptions& options,
+                                                      const std::shared_ptr<ConnectionInvalidator>& invalidator,
+                                                      const std::shared_ptr<HandshakeCache>& handshakeCache);
 
 public:
 
   /**
    * Constructor.
    * @param options - connection options.
+   * @param workerPool - &id:oatpp::mysql::WorkerPool; to run blocking connect in &l:ConnectionProvider::getAsync ();. <br>
+   * If `nullptr` - provider creates its own pool.
    */
-  ConnectionProvider(const ConnectionOptions& options);
+  ConnectionProvider(const ConnectionOptions& options, const std::shared_ptr<WorkerPool>& workerPool = nullptr);
 
   /**
-   * Get connection.
+   * Get connection. <br>
+   * Throws if &l:ConnectionOptions::useNonBlockingEngine; is set - such provider makes non-blocking connections only.
    * @return - resource handle to the connection.
    */
   provider::ResourceHandle<Connection> get() override;
 
   /**
-   * Get connection asynchronously.
+   * Get connection asynchronously. Connect is done on the &id:oatpp::mysql::WorkerPool; thread,
+   * or by the &id:oatpp::mysql::NonBlockingEngine; if &l:ConnectionOptions::useNonBlockingEngine; is set.
    * @return - coroutine handle to the connection.
    */
   async::CoroutineStarterForResult<const provider::ResourceHandle<Connection>&> getAsync() override;
 
+  /**
+   * Get handshake statistics of connections made by this provider. <br>
+   * Compare average connect time of resumed and full TLS handshakes.
+   * @return - &l:ConnectionProvider::HandshakeStats;.
+   */
+  HandshakeStats getHandshakeStats();
+
   /**
    * Stop the provider.
    */
@@ -0,0 +1,167 @@
+#include "ConsistencySession.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+namespace oatpp { namespace mysql {
+
+// keeps intervals sorted, overlapping and adjacent ones are joined - "1-5" + "6-8" -> "1-8"
+void ConsistencySession::GtidSet::addInterval(const std::string& source, v_int64 first, v_int64 last) {
+
+  if(first <= 0 || last < first) {
+    return;
+  }
+
+  auto& intervals = m_sources[source];
+
+  auto it = intervals.begin();
+  while(it != intervals.end() && it->second + 1 < first) {
+    ++ it;
+  }
+
+  auto joined = it;
+  while(joined != intervals.end() && joined->first <= last + 1) {
+    first = std::min(first, joined->first);
+    last = std::max(last, joined->second);
+    ++ joined;
+  }
+
+  it = intervals.erase(it, joined);
+  intervals.insert(it, {first, last});
+
+}
+
+// e.g. "uuid:1-5:11-18" -> {uuid: [1-5, 11-18]}, "uuid:tag:1-3" -> {"uuid:tag": [1-3]}
+void ConsistencySession::GtidSet::add(const std::string& gtids) {
+
+  size_t pos = 0;
+  while(pos < gtids.size()) {
+
+    size_t end = gtids.find(',', pos);
+    if(end == std::string::npos) {
+      end = gtids.size();
+    }
+
+    std::string source;
+    size_t partStart = pos;
+
+    while(partStart < end) {
+
+      size_t partEnd = gtids.find(':', partStart);
+      if(partEnd == std::string::npos || partEnd > end) {
+        partEnd = end;
+      }
+
+      std::string part;
+      for(size_t i = partStart; i < partEnd; i ++) {
+        if(!std::isspace((unsigned char) gtids[i])) {
+          part.push_back(gtids[i]);
+        }
+      }
+
+      if(!part.empty()) {
+        if(source.empty()) {
+          source = part; // uuid
+        } else if(std::isdigit((unsigned char) part[0])) {
+          // interval "N" or "N-M"
+          size_t dash = part.find('-');
+          v_int64 first = std::strtoll(part.c_str(), nullptr, 10);
+          v_int64 last = dash == std::string::npos ? first : std::strtoll(part.c_str() + dash + 1, nullptr, 10);
+          addInterval(source, first, last);
+        } else {
+          // tag - following intervals belong to "uuid:tag"
+          size_t tagStart = source.find(':');
+          source = source.substr(0, tagStart) + ":" + part;
+        }
+      }
+
+      partStart = partEnd + 1;
+
+    }
+
+    pos = end + 1;
+
+  }
+
+}
+
+void ConsistencySession::GtidSet::merge(const GtidSet& other) {
+  for(auto& source : other.m_sources) {
+    for(auto& interval : source.second) {
+      addInterval(source.first, interval.first, interval.second);
+    }
+  }
+}
+
+bool ConsistencySession::GtidSet::contains(const GtidSet& other) const {
+  for(auto& source : other.m_sources) {
+    auto it = m_sources.find(source.first);
+    if(it == m_sources.end()) {
+      return false;
+    }
+    // both lists are sorted and joined - each interval of other must lie within one of ours
+    auto own = it->second.begin();
+    for(auto& interval : source.second) {
+      while(own != it->second.end() && own->second < interval.first) {
+        ++ own;
+      }
+      if(own == it->second.end() || own->first > interval.first || own->second < interval.second) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool ConsistencySession::GtidSet::isEmpty() const {
+  return m_sources.empty();
+}
+
+std::string ConsistencySession::GtidSet::toString() const {
+  std::string result;
+  for(auto& source : m_sources) {
+    if(!result.empty()) {
+      result += ",";
+    }
+    result += source.first;
+    for(auto& interval : source.second) {
+      result += ":" + std::to_string(interval.first);
+      if(interval.second != interval.first) {
+        result += "-" + std::to_string(interval.second);
+      }
+    }
+  }
+  return result;
+}
+
+ConsistencySession::Scope::Scope(const std::shared_ptr<ConsistencySession>& session)
+  : m_previous(current())
+{
+  current() = session;
+}
+
+ConsistencySession::Scope::~Scope() {
+  current() = m_previous;
+}
+
+std::shared_ptr<ConsistencySession>& ConsistencySession::current() {
+  static thread_local std::shared_ptr<ConsistencySession> session;
+  return session;
+}
+
+std::shared_ptr<ConsistencySession> ConsistencySession::getCurrent() {
+  return current();
+}
+
+void ConsistencySession::addGtids(const std::string& gtids) {
+  std::lock_guard<std::mutex> guard(m_lock);
+  m_gtids.add(gtids);
+}
+
+ConsistencySession::GtidSet ConsistencySession::getGtids() {
+  std::lock_guard<std::mutex> guard(m_lock);
+  return m_gtids;
+}
+
+}}
@@ -0,0 +1,123 @@
+#ifndef oatpp_mysql_ConsistencySession_hpp
+#define oatpp_mysql_ConsistencySession_hpp
+
+#include "oatpp/Types.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace oatpp { namespace mysql {
+
+/**
+ * Logical session for read-your-writes consistency of the replica reads. <br>
+ * &id:oatpp::mysql::RoutingExecutor; records GTIDs of the writes made in the session
+ * (connections must have &id:oatpp::mysql::ConnectionOptions::trackGtids; enabled),
+ * and reads of the same session go to a replica only after it has applied these GTIDs. <br>
+ * Session is activated for the current thread with &l:ConsistencySession::Scope;:
+ * ```cpp
+ * auto session = std::make_shared<oatpp::mysql::ConsistencySession>(); // keep it per user, e.g. in the http session
+ * {
+ *   oatpp::mysql::ConsistencySession::Scope scope(session);
+ *   client.updateUser(user);
+ *   client.getUser(user->id); // sees the update
+ * }
+ * ```
+ */
+class ConsistencySession {
+public:
+
+  /**
+   * Set of GTIDs kept as sorted, non-adjacent intervals per source - the same as the server reports them. <br>
+   * Gaps are preserved - executed sets of the source may miss purged or skipped transactions,
+   * and a set without the gaps would never be contained in them.
+   */
+  class GtidSet {
+  private:
+    typedef std::vector<std::pair<v_int64, v_int64>> Intervals;
+  private:
+    void addInterval(const std::string& source, v_int64 first, v_int64 last);
+  private:
+    std::map<std::string, Intervals> m_sources;
+  public:
+
+    /**
+     * Add GTIDs in the mysql text format. Ex.: `3E11FA47-71CA-11E1-9E33-C80AA9429562:23`,
+     * `3E11FA47-71CA-11E1-9E33-C80AA9429562:1-5:11-18,uuid2:tag:1-3`.
+     * @param gtids
+     */
+    void add(const std::string& gtids);
+
+    /**
+     * Add all GTIDs of other set.
+     * @param other
+     */
+    void merge(const GtidSet& other);
+
+    /**
+     * Check if this set includes all GTIDs of the other set.
+     * @param other
+     * @return
+     */
+    bool contains(const GtidSet& other) const;
+
+    /**
+     * Check if set is empty.
+     * @return
+     */
+    bool isEmpty() const;
+
+    /**
+     * Format set for `WAIT_FOR_EXECUTED_GTID_SET`. Ex.: `3E11FA47-71CA-11E1-9E33-C80AA9429562:1-5:11-23`.
+     * @return
+     */
+    std::string toString() const;
+
+  };
+
+public:
+
+  /**
+   * Make the session current for the calling thread while the scope is alive.
+   */
+  class Scope {
+  private:
+    std::shared_ptr<ConsistencySession> m_previous;
+  public:
+    Scope(const std::shared_ptr<ConsistencySession>& session);
+    ~Scope();
+  };
+
+private:
+  static std::shared_ptr<ConsistencySession>& current();
+private:
+  std::mutex m_lock;
+  GtidSet m_gtids;
+public:
+
+  /**
+   * Get session current for the calling thread.
+   * @return - session or `nullptr` if there is no active &l:ConsistencySession::Scope;.
+   */
+  static std::shared_ptr<ConsistencySession> getCurrent();
+
+  /**
+   * Record GTIDs of the write made in this session.
+   * @param gtids - GTIDs in the mysql text format.
+   */
+  void addGtids(const std::string& gtids);
+
+  /**
+   * Get GTIDs written in this session.
+   * @return - &l:ConsistencySession::GtidSet;.
+   */
+  GtidSet getGtids();
+
+};
+
+}}
+
+#endif // oatpp_mysql_ConsistencySession_hpp
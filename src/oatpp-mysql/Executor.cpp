@@ -1,5 +1,9 @@
 ﻿#include "Executor.hpp"
 
+#include "NonBlockingEngine.hpp"
+
+#include "ql_template/ListExpander.hpp"
+#include "ql_template/LiteralValueProvider.hpp"
 #include "ql_template/Parser.hpp"
 #include "ql_template/TemplateValueProvider.hpp"
 
@@ -15,13 +19,16 @@ void Executor::ConnectionInvalidator::invalidate(const std::shared_ptr<orm::Conn
   invalidator->invalidate(c);
 }
 
-Executor::Executor(const std::shared_ptr<provider::Provider<Connection>>& connectionProvider)
-  : m_connectionProvider(connectionProvider)
-  , m_connectionInvalidator(std::make_shared<ConnectionInvalidator>())
-  , m_serializer(std::make_shared<mapping::Serializer>())
+Executor::Executor(const std::shared_ptr<provider::Provider<Connection>>& connectionProvider,
+                   const std::shared_ptr<WorkerPool>& workerPool)
+  : m_connectionInvalidator(std::make_shared<ConnectionInvalidator>())
+  , m_connectionProvider(connectionProvider)
   , m_resultMapper(std::make_shared<mapping::ResultMapper>())
+  , m_workerPool(workerPool)
 {
-
+  if(!m_workerPool) {
+    m_workerPool = std::make_shared<WorkerPool>();
+  }
 }
 
 std::shared_ptr<data::mapping::TypeResolver> Executor::createTypeResolver() {
@@ -29,18 +36,59 @@ std::shared_ptr<data::mapping::TypeResolver> Executor::createTypeResolver() {
   return resolver;
 }
 
-provider::ResourceHandle<orm::Connection> Executor::getConnection() {
-  auto connection = m_connectionProvider->get();
+provider::ResourceHandle<orm::Connection> Executor::wrapConnection(const provider::ResourceHandle<Connection>& connection,
+                                                                   const std::shared_ptr<ConnectionInvalidator>& invalidator)
+{
   if (connection) {
     connection.object->setInvalidator(connection.invalidator);
     return provider::ResourceHandle<orm::Connection>(
       connection.object,
-      m_connectionInvalidator
+      invalidator
     );
   }
   throw std::runtime_error("[oatpp::mysql::Executor::getConnection()]: Error. Can't connect.");
 }
 
+provider::ResourceHandle<orm::Connection> Executor::wrapConnection(const provider::ResourceHandle<Connection>& connection) {
+  return wrapConnection(connection, m_connectionInvalidator);
+}
+
+const std::shared_ptr<WorkerPool>& Executor::getWorkerPool() {
+  return m_workerPool;
+}
+
+provider::ResourceHandle<orm::Connection> Executor::getConnection() {
+  return wrapConnection(m_connectionProvider->get());
+}
+
+const std::shared_ptr<provider::Provider<Connection>>& Executor::selectConnectionProvider(const StringTemplate& queryTemplate) {
+  if(m_compressedConnectionProvider) {
+    auto extra = std::static_pointer_cast<ql_template::Parser::TemplateExtra>(queryTemplate.getExtraData());
+    if(extra && extra->hasHint("compress")) {
+      return m_compressedConnectionProvider;
+    }
+  }
+  return m_connectionProvider;
+}
+
+const std::shared_ptr<provider::Provider<Connection>>& Executor::selectAsyncConnectionProvider(const StringTemplate& queryTemplate) {
+  if(m_nonBlockingConnectionProvider) {
+    auto extra = std::static_pointer_cast<ql_template::Parser::TemplateExtra>(queryTemplate.getExtraData());
+    if(!m_compressedConnectionProvider || !extra || !extra->hasHint("compress")) {
+      return m_nonBlockingConnectionProvider;
+    }
+  }
+  return selectConnectionProvider(queryTemplate);
+}
+
+void Executor::setCompressedConnectionProvider(const std::shared_ptr<provider::Provider<Connection>>& connectionProvider) {
+  m_compressedConnectionProvider = connectionProvider;
+}
+
+void Executor::setNonBlockingConnectionProvider(const std::shared_ptr<provider::Provider<Connection>>& connectionProvider) {
+  m_nonBlockingConnectionProvider = connectionProvider;
+}
+
 data::share::StringTemplate Executor::parseQueryTemplate(const oatpp::String& name,
                                                          const oatpp::String& text,
                                                          const ParamsTypeMap& paramsTypeMap,
@@ -49,8 +97,7 @@ data::share::StringTemplate Executor::parseQueryTemplate(const oatpp::String& na
 
   auto&& t = ql_template::Parser::parseTemplate(text);
 
-  auto extra = std::make_shared<ql_template::Parser::TemplateExtra>();
-  t.setExtraData(extra);
+  auto extra = std::static_pointer_cast<ql_template::Parser::TemplateExtra>(t.getExtraData());
 
   extra->prepare = prepare;
   extra->templateName = name;
@@ -88,45 +135,95 @@ Executor::QueryParameter Executor::parseQueryParameter(const oatpp::String& para
 
 }
 
-// mysql bind params
-void Executor::bindParams(MYSQL_STMT* stmt,
-                          const StringTemplate& queryTemplate,
-                          const std::unordered_map<oatpp::String, oatpp::Void>& params, 
-                          const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver) {
+// resolve params in the placeholder order. prepared is false for the text protocol queries - lists are not padded
+void Executor::resolveParams(const StringTemplate& queryTemplate,
+                             const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                             const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                             bool prepared,
+                             ResolvedParams& result) {
   data::mapping::TypeResolver::Cache cache;
 
-  auto extra = std::static_pointer_cast<ql_template::Parser::TemplateExtra>(queryTemplate.getExtraData());
-
   size_t count = queryTemplate.getTemplateVariables().size();
+  result.counts.reserve(count);
+  result.placeholders.reserve(count);
+
   for (size_t i = 0; i < count; ++i) {
     auto& var = queryTemplate.getTemplateVariables()[i];
     
     auto queryParam = parseQueryParameter(var.name);  // e.g. "user.name.first" -> QueryParameter{name="user", propertyPath={"name", "first"}}
 
     if (queryParam.name->empty()) {
-      throw std::runtime_error("[oatpp::mysql::Executor::bindParams()]: Error. "
+      throw std::runtime_error("[oatpp::mysql::Executor::resolveParams()]: Error. "
         "Can't parse query parameter name. Parameter name: " + var.name);
     }
 
     // resolve parameter type
     auto it = params.find(queryParam.name);
-    if (it != params.end()) {
-      auto value = typeResolver->resolveObjectPropertyValue(it->second, queryParam.propertyPath, cache);
-      if (value.getValueType()->classId.id == oatpp::Void::Class::CLASS_ID.id) {
-        throw std::runtime_error("[oatpp::mysql::Executor::bindParams()]: Error. "
-          "Can't resolve parameter type because property dose not found or its type is unknown." 
-          " Parameter name: " + queryParam.name + ", var.name: " + var.name);
-      }
+    if (it == params.end()) {
+      // missing parameter - placeholder is left unbound
+      result.values.push_back(nullptr);
+      result.counts.push_back(1);
+      result.placeholders.push_back(nullptr);
+      continue;
+    }
+
+    auto value = typeResolver->resolveObjectPropertyValue(it->second, queryParam.propertyPath, cache);
+    if (value.getValueType()->classId.id == oatpp::Void::Class::CLASS_ID.id) {
+      throw std::runtime_error("[oatpp::mysql::Executor::resolveParams()]: Error. "
+        "Can't resolve parameter type because property dose not found or its type is unknown." 
+        " Parameter name: " + queryParam.name + ", var.name: " + var.name);
+    }
 
-      // [serialize] bind parameter according to the resolved type
-      m_serializer->serialize(stmt, i, value);
+    if (ql_template::ListExpander::isList(value.getValueType())) {
+      auto size = result.values.size();
+      result.placeholders.push_back(ql_template::ListExpander::expand(value, prepared, (v_uint32) i, result.values));
+      result.counts.push_back((v_uint32) (result.values.size() - size));
+      result.hasLists = true;
+    } else {
+      result.values.push_back(value);
+      result.counts.push_back(1);
+      result.placeholders.push_back(nullptr);
+    }
+
+  }
+}
+
+// serialize params to mysql binds. stmt is nullptr for the text protocol queries
+void Executor::serializeParams(MYSQL_STMT* stmt, const mapping::Serializer& serializer, const ResolvedParams& resolvedParams) {
+  for (size_t i = 0; i < resolvedParams.values.size(); ++i) {
+    auto& value = resolvedParams.values[i];
+    // [serialize] bind parameter according to the resolved type. Missing parameters have no type
+    if (value.getValueType()->classId.id != oatpp::Void::Class::CLASS_ID.id) {
+      serializer.serialize(stmt, (v_uint32) i, value);
     }
   }
+}
 
-  if (mysql_stmt_bind_param(stmt, m_serializer->getBindParams().data())) {
+// mysql bind params
+void Executor::bindParams(MYSQL_STMT* stmt, const mapping::Serializer& serializer, const ResolvedParams& resolvedParams) {
+
+  serializeParams(stmt, serializer, resolvedParams);
+
+  if (mysql_stmt_bind_param(stmt, serializer.getBindParams().data())) {
     throw std::runtime_error("[oatpp::mysql::Executor::bindParams()]: Error. "
       "Can't bind parameters. Error: " + std::string(mysql_stmt_error(stmt)));
   }
+
+  // streamed BLOB parameters
+  serializer.sendLongData(stmt);
+}
+
+oatpp::String Executor::formatQuery(MYSQL* handle,
+                                   const StringTemplate& queryTemplate,
+                                   const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                   const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver)
+{
+  ResolvedParams resolvedParams;
+  resolveParams(queryTemplate, params, typeResolver, false, resolvedParams);
+  mapping::Serializer serializer;
+  serializeParams(nullptr, serializer, resolvedParams);
+  ql_template::LiteralValueProvider valueProvider(handle, serializer.getBindParams(), resolvedParams.counts);
+  return queryTemplate.format(&valueProvider);
 }
 
 std::shared_ptr<orm::QueryResult> Executor::execute(const StringTemplate& queryTemplate,
@@ -136,7 +233,7 @@ std::shared_ptr<orm::QueryResult> Executor::execute(const StringTemplate& queryT
 {
   auto connectionHandle = connection;
   if (!connectionHandle) {
-    connectionHandle = getConnection();
+    connectionHandle = wrapConnection(selectConnectionProvider(queryTemplate)->get());
   }
 
   std::shared_ptr<const data::mapping::TypeResolver> tr = typeResolver;
@@ -144,7 +241,33 @@ std::shared_ptr<orm::QueryResult> Executor::execute(const StringTemplate& queryT
     tr = m_defaultTypeResolver;
   }
 
-  auto mysqlConnection = std::static_pointer_cast<mysql::Connection>(connectionHandle.object);
+  return executePrepared(queryTemplate, params, tr, connectionHandle, m_resultMapper, m_workerPool);
+}
+
+std::shared_ptr<orm::QueryResult> Executor::executePrepared(const StringTemplate& queryTemplate,
+                                                            const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                                            const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                                                            const provider::ResourceHandle<orm::Connection>& connection,
+                                                            const std::shared_ptr<mapping::ResultMapper>& resultMapper,
+                                                            const std::shared_ptr<WorkerPool>& workerPool)
+{
+  auto mysqlConnection = std::static_pointer_cast<mysql::Connection>(connection.object);
+
+  if (mysqlConnection->isNonBlocking()) {
+    throw std::runtime_error("[oatpp::mysql::Executor::execute()]: "
+      "Error. Connection is driven by NonBlockingEngine. Use executeAsync() instead.");
+  }
+
+  ResolvedParams resolvedParams;
+  resolveParams(queryTemplate, params, typeResolver, true, resolvedParams);
+
+  // list parameters change the placeholders - the text is formatted per call
+  auto extra = std::static_pointer_cast<ql_template::Parser::TemplateExtra>(queryTemplate.getExtraData());
+  oatpp::String preparedTemplate = extra->preparedTemplate;
+  if (resolvedParams.hasLists) {
+    ql_template::TemplateValueProvider valueProvider(&resolvedParams.placeholders);
+    preparedTemplate = queryTemplate.format(&valueProvider);
+  }
 
   MYSQL_STMT* stmt = mysql_stmt_init(mysqlConnection->getHandle());
   if (!stmt) {
@@ -152,31 +275,175 @@ std::shared_ptr<orm::QueryResult> Executor::execute(const StringTemplate& queryT
       "ErrorError. Can't create MYSQL_STMT. Error: " + std::string(mysql_error(mysqlConnection->getHandle())));
   }
 
-  auto extra = std::static_pointer_cast<ql_template::Parser::TemplateExtra>(queryTemplate.getExtraData());
-  if (mysql_stmt_prepare(stmt, extra->preparedTemplate->c_str(), extra->preparedTemplate->size())) {
+  if (mysql_stmt_prepare(stmt, preparedTemplate->c_str(), preparedTemplate->size())) {
+    std::string error = mysql_stmt_error(stmt);
+    mysql_stmt_close(stmt);
     throw std::runtime_error("[oatpp::mysql::Executor::execute()]: "
-      "Error. Can't prepare MYSQL_STMT. preparedTemplate: " + extra->preparedTemplate +
-      " Error: " + std::string(mysql_stmt_error(stmt)));
+      "Error. Can't prepare MYSQL_STMT. preparedTemplate: " + preparedTemplate +
+      " Error: " + error);
+  }
+
+  try {
+    // serializer owns bind buffers - it must live until the statement is executed
+    mapping::Serializer serializer;
+    bindParams(stmt, serializer, resolvedParams);
+    // execution error is reported through QueryResult::isSuccess()
+    mysql_stmt_execute(stmt);
+  } catch (...) {
+    mysql_stmt_close(stmt);
+    throw;
+  }
+
+  return std::make_shared<mysql::QueryResult>(stmt, connection, resultMapper, typeResolver, workerPool);
+}
+
+async::CoroutineStarterForResult<const std::shared_ptr<orm::QueryResult>&>
+Executor::executeAsync(const StringTemplate& queryTemplate,
+                       const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                       const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                       const provider::ResourceHandle<orm::Connection>& connection)
+{
+
+  class ExecuteCoroutine : public async::CoroutineWithResult<ExecuteCoroutine, const std::shared_ptr<orm::QueryResult>&> {
+  private:
+    std::shared_ptr<provider::Provider<Connection>> m_connectionProvider;
+    std::shared_ptr<ConnectionInvalidator> m_connectionInvalidator;
+    std::shared_ptr<mapping::ResultMapper> m_resultMapper;
+    std::shared_ptr<WorkerPool> m_workerPool;
+    StringTemplate m_queryTemplate;
+    std::unordered_map<oatpp::String, oatpp::Void> m_params;
+    std::shared_ptr<const data::mapping::TypeResolver> m_typeResolver;
+    provider::ResourceHandle<orm::Connection> m_connection;
+  public:
+
+    ExecuteCoroutine(const std::shared_ptr<provider::Provider<Connection>>& connectionProvider,
+                     const std::shared_ptr<ConnectionInvalidator>& connectionInvalidator,
+                     const std::shared_ptr<mapping::ResultMapper>& resultMapper,
+                     const std::shared_ptr<WorkerPool>& workerPool,
+                     const StringTemplate& queryTemplate,
+                     const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                     const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                     const provider::ResourceHandle<orm::Connection>& connection)
+      : m_connectionProvider(connectionProvider)
+      , m_connectionInvalidator(connectionInvalidator)
+      , m_resultMapper(resultMapper)
+      , m_workerPool(workerPool)
+      , m_queryTemplate(queryTemplate)
+      , m_params(params)
+      , m_typeResolver(typeResolver)
+      , m_connection(connection)
+    {}
+
+    Action act() override {
+      if(m_connection) {
+        return yieldTo(&ExecuteCoroutine::execute);
+      }
+      return m_connectionProvider->getAsync().callbackTo(&ExecuteCoroutine::onConnection);
+    }
+
+    Action onConnection(const provider::ResourceHandle<Connection>& connection) {
+      m_connection = wrapConnection(connection, m_connectionInvalidator);
+      return yieldTo(&ExecuteCoroutine::execute);
+    }
+
+    Action execute() {
+      auto mysqlConnection = std::static_pointer_cast<mysql::Connection>(m_connection.object);
+      if(mysqlConnection->isNonBlocking()) {
+        return yieldTo(&ExecuteCoroutine::executeNonBlocking);
+      }
+      return yieldTo(&ExecuteCoroutine::executeOnWorker);
+    }
+
+    Action executeNonBlocking() {
+      auto handle = std::static_pointer_cast<mysql::Connection>(m_connection.object)->getHandle();
+      auto query = formatQuery(handle, m_queryTemplate, m_params, m_typeResolver);
+      return NonBlockingEngine::query(handle, query).next(yieldTo(&ExecuteCoroutine::fetchNonBlocking));
+    }
+
+    Action fetchNonBlocking() {
+      auto handle = std::static_pointer_cast<mysql::Connection>(m_connection.object)->getHandle();
+      return NonBlockingEngine::storeResult(handle).callbackTo(&ExecuteCoroutine::onFetched);
+    }
+
+    Action onFetched(MYSQL_RES* textResults) {
+      auto handle = std::static_pointer_cast<mysql::Connection>(m_connection.object)->getHandle();
+      std::shared_ptr<orm::QueryResult> result = std::make_shared<mysql::QueryResult>(
+        textResults, handle, m_connection, m_resultMapper, m_typeResolver, m_workerPool
+      );
+      return _return(result);
+    }
+
+    Action executeOnWorker() {
+      // the task owns everything it uses - it may run after the executor is destroyed
+      auto queryTemplate = m_queryTemplate;
+      auto params = m_params;
+      auto typeResolver = m_typeResolver;
+      auto connection = m_connection;
+      auto resultMapper = m_resultMapper;
+      auto workerPool = m_workerPool;
+      return m_workerPool->execute<std::shared_ptr<orm::QueryResult>>(
+        [queryTemplate, params, typeResolver, connection, resultMapper, workerPool]() {
+          return executePrepared(queryTemplate, params, typeResolver, connection, resultMapper, workerPool);
+        }
+      ).callbackTo(&ExecuteCoroutine::onResult);
+    }
+
+    Action onResult(const std::shared_ptr<orm::QueryResult>& result) {
+      return _return(result);
+    }
+
+  };
+
+  std::shared_ptr<const data::mapping::TypeResolver> tr = typeResolver;
+  if(!tr) {
+    tr = m_defaultTypeResolver;
   }
 
-  bindParams(stmt, queryTemplate, params, typeResolver);
+  return ExecuteCoroutine::startForResult(selectAsyncConnectionProvider(queryTemplate), m_connectionInvalidator,
+                                         m_resultMapper, m_workerPool, queryTemplate, params, tr, connection);
 
-  return std::make_shared<mysql::QueryResult>(stmt, connectionHandle, m_resultMapper, tr);
+}
+
+// statement without parameters and without result set - e.g. transaction control
+std::shared_ptr<orm::QueryResult> Executor::executeStatement(const std::string& statement,
+                                                             const provider::ResourceHandle<orm::Connection>& connection)
+{
+  auto mysqlConnection = std::static_pointer_cast<mysql::Connection>(connection.object);
+
+  if (mysqlConnection->isNonBlocking()) {
+    throw std::runtime_error("[oatpp::mysql::Executor::executeStatement()]: "
+      "Error. Connection is driven by NonBlockingEngine. Transactions are not supported on such connections.");
+  }
+
+  MYSQL* handle = mysqlConnection->getHandle();
+
+  // execution error is reported through QueryResult::isSuccess()
+  mysql_real_query(handle, statement.data(), (unsigned long) statement.size());
+
+  return std::make_shared<mysql::QueryResult>(nullptr, handle, connection, m_resultMapper, m_defaultTypeResolver, m_workerPool);
 }
 
 std::shared_ptr<orm::QueryResult> Executor::begin(const provider::ResourceHandle<orm::Connection>& connection) {
-  throw std::runtime_error("[oatpp::mysql::Executor::begin()]: "
-                           "Error. Not implemented.");
+  if(connection) {
+    return executeStatement("START TRANSACTION", connection);
+  }
+  return executeStatement("START TRANSACTION", getConnection());
 }
 
 std::shared_ptr<orm::QueryResult> Executor::commit(const provider::ResourceHandle<orm::Connection>& connection) {
-  throw std::runtime_error("[oatpp::mysql::Executor::commit()]: "
-                           "Error. Not implemented.");
+  if(!connection) {
+    throw std::runtime_error("[oatpp::mysql::Executor::commit()]: "
+                             "Error. Connection of the transaction is required.");
+  }
+  return executeStatement("COMMIT", connection);
 }
 
 std::shared_ptr<orm::QueryResult> Executor::rollback(const provider::ResourceHandle<orm::Connection>& connection) {
-  throw std::runtime_error("[oatpp::mysql::Executor::rollback()]: "
-                           "Error. Not implemented.");
+  if(!connection) {
+    throw std::runtime_error("[oatpp::mysql::Executor::rollback()]: "
+                             "Error. Connection of the transaction is required.");
+  }
+  return executeStatement("ROLLBACK", connection);
 }
 
 v_int64 Executor::getSchemaVersion(const oatpp::String& suffix,
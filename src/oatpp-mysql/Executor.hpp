@@ -22,8 +22,10 @@ private:
 private:
   std::shared_ptr<ConnectionInvalidator> m_connectionInvalidator;
   std::shared_ptr<provider::Provider<Connection>> m_connectionProvider;
-  std::shared_ptr<mapping::Serializer> m_serializer;
+  std::shared_ptr<provider::Provider<Connection>> m_compressedConnectionProvider;
+  std::shared_ptr<provider::Provider<Connection>> m_nonBlockingConnectionProvider;
   std::shared_ptr<mapping::ResultMapper> m_resultMapper;
+  std::shared_ptr<WorkerPool> m_workerPool;
 
 private:
   struct QueryParameter {
@@ -31,17 +33,77 @@ private:
     std::vector<std::string> propertyPath;
   };
 
-  QueryParameter parseQueryParameter(const oatpp::String& paramName);
+  static QueryParameter parseQueryParameter(const oatpp::String& paramName);
+
+  /*
+   * Parameter values in the placeholder order. List parameters are expanded to several values.
+   */
+  struct ResolvedParams {
+    std::vector<oatpp::Void> values;
+    std::vector<v_uint32> counts;
+    std::vector<oatpp::String> placeholders;
+    bool hasLists = false;
+  };
 
 private:
-  void bindParams(MYSQL_STMT* stmt,
-                  const StringTemplate& queryTemplate,
-                  const std::unordered_map<oatpp::String, oatpp::Void>& params,
-                  const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver);
+  const std::shared_ptr<provider::Provider<Connection>>& selectConnectionProvider(const StringTemplate& queryTemplate);
+  const std::shared_ptr<provider::Provider<Connection>>& selectAsyncConnectionProvider(const StringTemplate& queryTemplate);
+  static void resolveParams(const StringTemplate& queryTemplate,
+                            const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                            const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                            bool prepared,
+                            ResolvedParams& result);
+  static void serializeParams(MYSQL_STMT* stmt, const mapping::Serializer& serializer, const ResolvedParams& resolvedParams);
+  static void bindParams(MYSQL_STMT* stmt, const mapping::Serializer& serializer, const ResolvedParams& resolvedParams);
+  static oatpp::String formatQuery(MYSQL* handle,
+                                   const StringTemplate& queryTemplate,
+                                   const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                   const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver);
+  /*
+   * Doesn't touch the executor - called from the worker threads of executeAsync().
+   */
+  static std::shared_ptr<orm::QueryResult> executePrepared(const StringTemplate& queryTemplate,
+                                                           const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                                           const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                                                           const provider::ResourceHandle<orm::Connection>& connection,
+                                                           const std::shared_ptr<mapping::ResultMapper>& resultMapper,
+                                                           const std::shared_ptr<WorkerPool>& workerPool);
+  static provider::ResourceHandle<orm::Connection> wrapConnection(const provider::ResourceHandle<Connection>& connection,
+                                                                  const std::shared_ptr<ConnectionInvalidator>& invalidator);
+  std::shared_ptr<orm::QueryResult> executeStatement(const std::string& statement,
+                                                     const provider::ResourceHandle<orm::Connection>& connection);
+
+protected:
+  provider::ResourceHandle<orm::Connection> wrapConnection(const provider::ResourceHandle<Connection>& connection);
+  const std::shared_ptr<WorkerPool>& getWorkerPool();
 
 public:
 
-  Executor(const std::shared_ptr<provider::Provider<Connection>>& connectionProvider);
+  /**
+   * Constructor.
+   * @param connectionProvider - connection provider. Ex.: &id:oatpp::mysql::ConnectionProvider; or &id:oatpp::mysql::ConnectionPool;.
+   * @param workerPool - &id:oatpp::mysql::WorkerPool; to run blocking calls of &l:Executor::executeAsync ();. <br>
+   * If `nullptr` - executor creates its own pool.
+   */
+  Executor(const std::shared_ptr<provider::Provider<Connection>>& connectionProvider,
+           const std::shared_ptr<WorkerPool>& workerPool = nullptr);
+
+  /**
+   * Set provider of connections with protocol compression enabled (&id:oatpp::mysql::ConnectionOptions::compression;). <br>
+   * Queries with the `compress` hint (`/&#42;oatpp: compress&#42;/`) acquire connections from this provider,
+   * all other queries use the main provider - small point lookups don't pay the compression CPU cost.
+   * @param connectionProvider - provider of compressed connections. `nullptr` - route all queries to the main provider.
+   */
+  void setCompressedConnectionProvider(const std::shared_ptr<provider::Provider<Connection>>& connectionProvider);
+
+  /**
+   * Set provider of non-blocking connections (&id:oatpp::mysql::ConnectionOptions::useNonBlockingEngine;). <br>
+   * &l:Executor::executeAsync (); acquires connections from this provider, &l:Executor::execute (); and transactions
+   * use the main provider - blocking and non-blocking connections are kept in separate pools.
+   * Queries with the `compress` hint still use the compressed provider.
+   * @param connectionProvider - provider of non-blocking connections. `nullptr` - async queries use the main provider.
+   */
+  void setNonBlockingConnectionProvider(const std::shared_ptr<provider::Provider<Connection>>& connectionProvider);
 
   /**
    * Get default type resolver.
@@ -82,8 +144,32 @@ public:
                                             const provider::ResourceHandle<orm::Connection>& connection = nullptr)  override;
 
   /**
-   * Begin database transaction. Should NOT be used directly. Use &id:oatpp::orm::Transaction; instead.
+   * Execute database query asynchronously. <br>
+   * Connection is acquired with `getAsync()` of the connection provider, so &id:oatpp::mysql::ConnectionPool; doesn't block
+   * when exhausted. Statement is executed on the &id:oatpp::mysql::WorkerPool; thread. <br>
+   * Non-blocking connections (see &l:Executor::setNonBlockingConnectionProvider ();) are driven by
+   * &id:oatpp::mysql::NonBlockingEngine; instead - query is sent with the text protocol and all rows are read
+   * without blocking before the result is returned. <br>
+   * Coroutine holds the connection provider, the type resolver and the query by value - executor may be destroyed
+   * before the coroutine is done.
+   * @param queryTemplate - a query template obtained in a prior call to &l:Executor::parseQueryTemplate (); method.
+   * @param params - query parameters.
+   * @param typeResolver - type resolver.
    * @param connection - database connection.
+   * @return - &id:oatpp::async::CoroutineStarterForResult; with &id:oatpp::orm::QueryResult;. <br>
+   * Use &id:oatpp::mysql::QueryResult::fetchAsync; to fetch rows without blocking.
+   */
+  virtual async::CoroutineStarterForResult<const std::shared_ptr<orm::QueryResult>&>
+  executeAsync(const StringTemplate& queryTemplate,
+               const std::unordered_map<oatpp::String, oatpp::Void>& params,
+               const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver = nullptr,
+               const provider::ResourceHandle<orm::Connection>& connection = nullptr);
+
+  /**
+   * Begin database transaction. Should NOT be used directly. Use &id:oatpp::orm::Transaction; instead. <br>
+   * Executes `START TRANSACTION` on the connection. Queries of the transaction must be executed on the connection
+   * of the returned result.
+   * @param connection - database connection. If `nullptr` - connection is acquired with &l:Executor::getConnection ();.
    * @return - &id:oatpp::orm::QueryResult;.
    */
   std::shared_ptr<orm::QueryResult> begin(const provider::ResourceHandle<orm::Connection>& connection = nullptr) override;
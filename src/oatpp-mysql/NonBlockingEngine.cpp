@@ -0,0 +1,172 @@
+#include "NonBlockingEngine.hpp"
+
+#include "oatpp/Environment.hpp"
+
+namespace oatpp { namespace mysql {
+
+bool NonBlockingEngine::isSupported() {
+#ifdef OATPP_MYSQL_NONBLOCKING_API
+  return true;
+#else
+  return false;
+#endif
+}
+
+#ifdef OATPP_MYSQL_NONBLOCKING_API
+
+namespace {
+
+/*
+ * Wait for the socket to be ready for the operation the last `mysql_*_nonblocking` call is blocked on.
+ * libmysqlclient records it in the async context of the connection NET (mysql_com.h).
+ * The socket descriptor is taken from `NET::fd` - libmysqlclient has no getter for it.
+ */
+async::Action waitIO(MYSQL* handle) {
+
+  NET_ASYNC* context = NET_ASYNC_DATA(&handle->net);
+
+  // TCP connect is in progress - NET has no socket until the connect completes, check again a bit later
+  if(context == nullptr || handle->net.vio == nullptr || context->async_blocking_state == NET_NONBLOCKING_CONNECT) {
+    return async::Action::createWaitRepeatAction(oatpp::Environment::getMicroTickCount() + 1000);
+  }
+
+  if(context->async_blocking_state == NET_NONBLOCKING_WRITE) {
+    return async::Action::createIOWaitAction(handle->net.fd, async::Action::IOEventType::IO_EVENT_WRITE);
+  }
+  return async::Action::createIOWaitAction(handle->net.fd, async::Action::IOEventType::IO_EVENT_READ);
+
+}
+
+}
+
+async::CoroutineStarterForResult<MYSQL*> NonBlockingEngine::connect(MYSQL* handle, const ConnectionOptions& options) {
+
+  class ConnectCoroutine : public async::CoroutineWithResult<ConnectCoroutine, MYSQL*> {
+  private:
+    MYSQL* m_handle;
+    ConnectionOptions m_options;
+  public:
+
+    ConnectCoroutine(MYSQL* handle, const ConnectionOptions& options)
+      : m_handle(handle)
+      , m_options(options)
+    {}
+
+    Action act() override {
+
+      auto status = mysql_real_connect_nonblocking(m_handle,
+        m_options.host ? m_options.host->c_str() : nullptr,
+        m_options.username ? m_options.username->c_str() : nullptr,
+        m_options.password ? m_options.password->c_str() : nullptr,
+        m_options.database ? m_options.database->c_str() : nullptr,
+        m_options.port,
+        m_options.unixSocket ? m_options.unixSocket->c_str() : nullptr,
+        m_options.clientFlags);
+
+      switch(status) {
+        case NET_ASYNC_NOT_READY:
+          return waitIO(m_handle);
+        case NET_ASYNC_ERROR: {
+          std::string error = mysql_error(m_handle);
+          mysql_close(m_handle);
+          throw std::runtime_error("[oatpp::mysql::NonBlockingEngine::connect()]: "
+                                   "Failed to connect to MySQL server. Error: " + error);
+        }
+        default:
+          return _return(m_handle);
+      }
+
+    }
+
+  };
+
+  return ConnectCoroutine::startForResult(handle, options);
+
+}
+
+async::CoroutineStarter NonBlockingEngine::query(MYSQL* handle, const oatpp::String& query) {
+
+  class QueryCoroutine : public async::Coroutine<QueryCoroutine> {
+  private:
+    MYSQL* m_handle;
+    oatpp::String m_query;
+  public:
+
+    QueryCoroutine(MYSQL* handle, const oatpp::String& query)
+      : m_handle(handle)
+      , m_query(query)
+    {}
+
+    Action act() override {
+      auto status = mysql_real_query_nonblocking(m_handle, m_query->data(), (unsigned long) m_query->size());
+      if(status == NET_ASYNC_NOT_READY) {
+        return waitIO(m_handle);
+      }
+      // on NET_ASYNC_ERROR error is read from the handle by the caller
+      return finish();
+    }
+
+  };
+
+  return QueryCoroutine::start(handle, query);
+
+}
+
+async::CoroutineStarterForResult<MYSQL_RES*> NonBlockingEngine::storeResult(MYSQL* handle) {
+
+  class StoreResultCoroutine : public async::CoroutineWithResult<StoreResultCoroutine, MYSQL_RES*> {
+  private:
+    MYSQL* m_handle;
+    MYSQL_RES* m_result;
+  public:
+
+    StoreResultCoroutine(MYSQL* handle)
+      : m_handle(handle)
+      , m_result(nullptr)
+    {}
+
+    Action act() override {
+
+      if(mysql_errno(m_handle) != 0 || mysql_field_count(m_handle) == 0) {
+        return _return(nullptr);
+      }
+
+      auto status = mysql_store_result_nonblocking(m_handle, &m_result);
+      if(status == NET_ASYNC_NOT_READY) {
+        return waitIO(m_handle);
+      }
+      return _return(m_result);
+
+    }
+
+  };
+
+  return StoreResultCoroutine::startForResult(handle);
+
+}
+
+#else
+
+async::CoroutineStarterForResult<MYSQL*> NonBlockingEngine::connect(MYSQL* handle, const ConnectionOptions& options) {
+  (void) options;
+  mysql_close(handle);
+  throw std::runtime_error("[oatpp::mysql::NonBlockingEngine::connect()]: Error. "
+                           "Non-blocking API is not available in this mysql client library.");
+}
+
+async::CoroutineStarter NonBlockingEngine::query(MYSQL* handle, const oatpp::String& query) {
+  (void) handle;
+  (void) query;
+  throw std::runtime_error("[oatpp::mysql::NonBlockingEngine::query()]: Error. "
+                           "Non-blocking API is not available in this mysql client library.");
+}
+
+async::CoroutineStarterForResult<MYSQL_RES*> NonBlockingEngine::storeResult(MYSQL* handle) {
+  (void) handle;
+  throw std::runtime_error("[oatpp::mysql::NonBlockingEngine::storeResult()]: Error. "
+                           "Non-blocking API is not available in this mysql client library.");
+}
+
+#endif
+
+}}
@@ -0,0 +1,67 @@
+#ifndef oatpp_mysql_NonBlockingEngine_hpp
+#define oatpp_mysql_NonBlockingEngine_hpp
+
+#include "ConnectionProvider.hpp"
+
+#include "oatpp/async/Coroutine.hpp"
+
+/*
+ * Non-blocking C API (`mysql_*_nonblocking`) is available in libmysqlclient since 8.0.16.
+ */
+#if !defined(MARIADB_BASE_VERSION) && !defined(MARIADB_PACKAGE_VERSION_ID) && \
+    defined(MYSQL_VERSION_ID) && MYSQL_VERSION_ID >= 80016
+  #define OATPP_MYSQL_NONBLOCKING_API
+#endif
+
+namespace oatpp { namespace mysql {
+
+/**
+ * Engine driving mysql connections with non-blocking sockets from the oatpp async executor I/O loop (epoll/kqueue). <br>
+ * Every step is a coroutine which is resumed when the connection socket is ready:
+ *
+ * - connect - `mysql_real_connect_nonblocking`.
+ * - execute - `mysql_real_query_nonblocking`. libmysqlclient has no non-blocking prepared statements,
+ *   so the statement is prepared on the client side - parameters are rendered as escaped literals.
+ * - fetch - `mysql_store_result_nonblocking`.
+ *
+ * No thread is blocked while the query is in flight, so a few executor threads can serve many connections. <br>
+ * When a step would block, the coroutine waits for the direction the client library is blocked on -
+ * the async state of the connection `NET` (`async_blocking_state`), so it is never woken up for the other one.
+ */
+class NonBlockingEngine {
+public:
+
+  /**
+   * Check if the linked mysql client library has non-blocking API.
+   * @return
+   */
+  static bool isSupported();
+
+  /**
+   * Connect. On failure the handle is closed and error is thrown in the calling coroutine.
+   * @param handle - MYSQL native handle initialized with `mysql_init` and options set.
+   * @param options - &id:oatpp::mysql::ConnectionOptions;.
+   * @return - &id:oatpp::async::CoroutineStarterForResult; with connected handle.
+   */
+  static async::CoroutineStarterForResult<MYSQL*> connect(MYSQL* handle, const ConnectionOptions& options);
+
+  /**
+   * Send query and read the result header. Query error is left on the handle - `mysql_errno()`.
+   * @param handle - MYSQL native connection handle.
+   * @param query - query text.
+   * @return - &id:oatpp::async::CoroutineStarter;.
+   */
+  static async::CoroutineStarter query(MYSQL* handle, const oatpp::String& query);
+
+  /**
+   * Read rows of the query result.
+   * @param handle - MYSQL native connection handle.
+   * @return - &id:oatpp::async::CoroutineStarterForResult; with result. `nullptr` if query has no result set or on error.
+   */
+  static async::CoroutineStarterForResult<MYSQL_RES*> storeResult(MYSQL* handle);
+
+};
+
+}}
+
+#endif // oatpp_mysql_NonBlockingEngine_hpp
@@ -0,0 +1,130 @@
+#include "ParallelScan.hpp"
+
+#include <algorithm>
+
+namespace oatpp { namespace mysql {
+
+constexpr const char* const ParallelScan::PARAM_RANGE_FROM;
+constexpr const char* const ParallelScan::PARAM_RANGE_TO;
+
+ParallelScan::ParallelScan(const std::shared_ptr<orm::Executor>& executor,
+                           const oatpp::String& name,
+                           const oatpp::String& text,
+                           const std::shared_ptr<WorkerPool>& workerPool)
+  : m_executor(executor)
+  , m_queryTemplate(executor->parseQueryTemplate(name, text, {}, false))
+  , m_workerPool(workerPool)
+{
+  if(!m_workerPool) {
+    m_workerPool = std::make_shared<WorkerPool>();
+  }
+}
+
+std::vector<oatpp::Void> ParallelScan::splitRange(v_int64 from, v_int64 to, v_int32 partitions) {
+
+  if(partitions < 1 || to <= from) {
+    throw std::runtime_error("[oatpp::mysql::ParallelScan::splitRange()]: Error. Invalid range or partitions count.");
+  }
+
+  std::vector<oatpp::Void> boundaries;
+  boundaries.reserve(partitions + 1);
+
+  v_int64 size = to - from;
+  for(v_int32 i = 0; i < partitions; i ++) {
+    boundaries.push_back(oatpp::Int64(from + size / partitions * i + std::min<v_int64>(i, size % partitions)));
+  }
+  boundaries.push_back(oatpp::Int64(to));
+
+  return boundaries;
+
+}
+
+// partition i reads [boundaries[i], boundaries[i + 1]). The last partition runs on the calling thread
+void ParallelScan::runPartitions(const std::vector<oatpp::Void>& boundaries, const Params& params, const PartitionHandler& handler) {
+
+  if(boundaries.size() < 2) {
+    throw std::runtime_error("[oatpp::mysql::ParallelScan::runPartitions()]: Error. At least 2 boundaries expected.");
+  }
+
+  v_int32 partitions = (v_int32) boundaries.size() - 1;
+
+  auto executor = m_executor;
+  auto queryTemplate = m_queryTemplate;
+
+  auto runPartition = [executor, queryTemplate, boundaries, params, handler](v_int32 partition) {
+    Params partitionParams = params;
+    partitionParams[PARAM_RANGE_FROM] = boundaries[partition];
+    partitionParams[PARAM_RANGE_TO] = boundaries[partition + 1];
+    auto result = executor->execute(queryTemplate, partitionParams);
+    if(!result->isSuccess()) {
+      throw std::runtime_error("[oatpp::mysql::ParallelScan::runPartitions()]: Error. "
+                               "Partition " + std::to_string(partition) + " failed: " + result->getErrorMessage());
+    }
+    handler(partition, result);
+  };
+
+  // queued with tryPost - the calling thread runs partitions no worker has taken, so a scan started from
+  // a worker thread of the saturated pool doesn't deadlock
+  std::vector<WorkerPool::Task> tasks;
+  tasks.reserve(partitions);
+  for(v_int32 i = partitions - 1; i >= 0; i --) {
+    tasks.push_back([runPartition, i]() {
+      runPartition(i);
+    });
+  }
+
+  m_workerPool->runAll(tasks);
+
+}
+
+oatpp::Void ParallelScan::fetchAll(const std::vector<oatpp::Void>& boundaries, const Params& params, const oatpp::Type* type) {
+
+  if(type->classId.id != data::type::__class::AbstractVector::CLASS_ID.id &&
+     type->classId.id != data::type::__class::AbstractList::CLASS_ID.id)
+  {
+    throw std::runtime_error("[oatpp::mysql::ParallelScan::fetchAll()]: Error. "
+                             "Invalid result container type. Allowed types are oatpp::Vector, oatpp::List");
+  }
+
+  std::vector<oatpp::Void> parts(boundaries.size() > 1 ? boundaries.size() - 1 : 0);
+
+  runPartitions(boundaries, params, [&parts, type](v_int32 partition, const std::shared_ptr<orm::QueryResult>& result) {
+    // each partition writes its own slot - no locking needed
+    parts[partition] = result->fetch(type, -1);
+  });
+
+  auto dispatcher = static_cast<const data::type::__class::Collection::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  auto collection = dispatcher->createObject();
+
+  for(auto& part : parts) {
+    auto iterator = dispatcher->beginIteration(part);
+    while(!iterator->finished()) {
+      dispatcher->addItem(collection, iterator->get());
+      iterator->next();
+    }
+  }
+
+  return collection;
+
+}
+
+void ParallelScan::fetchBatches(const std::vector<oatpp::Void>& boundaries,
+                                const Params& params,
+                                const oatpp::Type* type,
+                                v_int64 batchSize,
+                                const BatchCallback& callback)
+{
+
+  if(batchSize < 1) {
+    throw std::runtime_error("[oatpp::mysql::ParallelScan::fetchBatches()]: Error. Invalid batch size.");
+  }
+
+  runPartitions(boundaries, params, [type, batchSize, callback](v_int32 partition, const std::shared_ptr<orm::QueryResult>& result) {
+    while(result->hasMoreToFetch()) {
+      callback(partition, result->fetch(type, batchSize));
+    }
+  });
+
+}
+
+}}
@@ -0,0 +1,117 @@
+#ifndef oatpp_mysql_ParallelScan_hpp
+#define oatpp_mysql_ParallelScan_hpp
+
+#include "WorkerPool.hpp"
+
+#include "oatpp/orm/Executor.hpp"
+
+#include <functional>
+
+namespace oatpp { namespace mysql {
+
+/**
+ * Range-partitioned parallel read of a large table. <br>
+ * Key range is split into partitions and every partition is read by its own query on its own connection -
+ * use &id:oatpp::mysql::ConnectionPool; with at least partitions-count connections.
+ * Rows are deserialized on the worker threads. <br>
+ * Query must select a half-open key range with the `:rangeFrom` and `:rangeTo` parameters:
+ * ```cpp
+ * oatpp::mysql::ParallelScan scan(executor, "exportOrders",
+ *   "SELECT * FROM orders WHERE id >= :rangeFrom AND id < :rangeTo AND status = :status;");
+ *
+ * auto orders = scan.fetchAll<oatpp::Vector<oatpp::Object<OrderDto>>>(
+ *   oatpp::mysql::ParallelScan::splitRange(0, maxId + 1, 8), {{"status", oatpp::String("done")}});
+ * ```
+ */
+class ParallelScan {
+public:
+
+  /**
+   * Called with the next batch of the partition. Called concurrently from the worker threads.
+   */
+  typedef std::function<void(v_int32 partition, const oatpp::Void& batch)> BatchCallback;
+
+  /**
+   * Name of the range start parameter (inclusive).
+   */
+  static constexpr const char* const PARAM_RANGE_FROM = "rangeFrom";
+
+  /**
+   * Name of the range end parameter (exclusive).
+   */
+  static constexpr const char* const PARAM_RANGE_TO = "rangeTo";
+
+private:
+  typedef std::unordered_map<oatpp::String, oatpp::Void> Params;
+  typedef std::function<void(v_int32 partition, const std::shared_ptr<orm::QueryResult>& result)> PartitionHandler;
+private:
+  std::shared_ptr<orm::Executor> m_executor;
+  data::share::StringTemplate m_queryTemplate;
+  std::shared_ptr<WorkerPool> m_workerPool;
+private:
+  void runPartitions(const std::vector<oatpp::Void>& boundaries, const Params& params, const PartitionHandler& handler);
+public:
+
+  /**
+   * Constructor.
+   * @param executor - &id:oatpp::orm::Executor;.
+   * @param name - query name.
+   * @param text - query text with `:rangeFrom` and `:rangeTo` parameters.
+   * @param workerPool - &id:oatpp::mysql::WorkerPool; reading partitions. If `nullptr` - scan creates its own pool.
+   * Partitions count of the scan should not exceed threads count of the pool + 1.
+   */
+  ParallelScan(const std::shared_ptr<orm::Executor>& executor,
+               const oatpp::String& name,
+               const oatpp::String& text,
+               const std::shared_ptr<WorkerPool>& workerPool = nullptr);
+
+  /**
+   * Split numeric range `[from, to)` into partitions of equal size.
+   * @param from - range start (inclusive).
+   * @param to - range end (exclusive).
+   * @param partitions - number of partitions.
+   * @return - `partitions + 1` boundaries of &id:oatpp::Int64;.
+   */
+  static std::vector<oatpp::Void> splitRange(v_int64 from, v_int64 to, v_int32 partitions);
+
+  /**
+   * Read all partitions and merge rows into one collection in the partitions order.
+   * @param boundaries - partition boundaries - `N + 1` values of any ordered type for `N` partitions.
+   * Ex.: &l:ParallelScan::splitRange (); or dates.
+   * @param params - other query parameters.
+   * @param type - result collection type - &id:oatpp::Vector; or &id:oatpp::List;.
+   * @return - collection of rows.
+   */
+  oatpp::Void fetchAll(const std::vector<oatpp::Void>& boundaries, const Params& params, const oatpp::Type* type);
+
+  /**
+   * Read all partitions and merge rows into one collection in the partitions order.
+   * @tparam Wrapper - result collection type - &id:oatpp::Vector; or &id:oatpp::List;.
+   * @param boundaries - partition boundaries.
+   * @param params - other query parameters.
+   * @return - collection of rows.
+   */
+  template<class Wrapper>
+  Wrapper fetchAll(const std::vector<oatpp::Void>& boundaries, const Params& params = {}) {
+    return fetchAll(boundaries, params, Wrapper::Class::getType()).template cast<Wrapper>();
+  }
+
+  /**
+   * Read all partitions and stream rows in batches. Batches of the same partition come in order.
+   * @param boundaries - partition boundaries.
+   * @param params - other query parameters.
+   * @param type - batch collection type.
+   * @param batchSize - max rows in a batch.
+   * @param callback - &l:ParallelScan::BatchCallback;. Must be thread-safe.
+   */
+  void fetchBatches(const std::vector<oatpp::Void>& boundaries,
+                    const Params& params,
+                    const oatpp::Type* type,
+                    v_int64 batchSize,
+                    const BatchCallback& callback);
+
+};
+
+}}
+
+#endif // oatpp_mysql_ParallelScan_hpp
@@ -6,23 +6,49 @@ namespace oatpp { namespace mysql {
 QueryResult::QueryResult(MYSQL_STMT* stmt,
                          const provider::ResourceHandle<orm::Connection>& connection,
                          const std::shared_ptr<mapping::ResultMapper>& resultMapper,
-                         const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver)
+                         const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                         const std::shared_ptr<WorkerPool>& workerPool)
     :m_stmt(stmt)
     ,m_connection(connection)
     ,m_resultMapper(resultMapper)
     ,m_resultData(stmt,typeResolver)
+    ,m_workerPool(workerPool)
+    ,m_affectedRows(-1)
 {
-	m_resultData.init();    // initialize the information of all columns
+	// error of the statement execution - read it before the first fetch overrides it
 	if (mysql_stmt_errno(m_stmt) != 0) {
 		m_errorMessage = "Error executing statement: " + std::string(mysql_stmt_error(m_stmt));
 	}
 	else {
 		m_errorMessage = std::string(mysql_stmt_error(m_stmt));
 	}
+	m_resultData.init();    // initialize the information of all columns
+}
+
+QueryResult::QueryResult(MYSQL_RES* textResults,
+                         MYSQL* handle,
+                         const provider::ResourceHandle<orm::Connection>& connection,
+                         const std::shared_ptr<mapping::ResultMapper>& resultMapper,
+                         const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                         const std::shared_ptr<WorkerPool>& workerPool)
+    :m_stmt(nullptr)
+    ,m_connection(connection)
+    ,m_resultMapper(resultMapper)
+    ,m_resultData(textResults, typeResolver)
+    ,m_workerPool(workerPool)
+    ,m_affectedRows(textResults ? (v_int64) mysql_num_rows(textResults) : (v_int64) mysql_affected_rows(handle))
+{
+	m_resultData.init();
+	if (mysql_errno(handle) != 0) {
+		m_resultData.isSuccess = false;
+		m_errorMessage = "Error executing statement: " + std::string(mysql_error(handle));
+	}
 }
 
 QueryResult::~QueryResult() {
-	mysql_stmt_close(m_stmt);
+	if (m_stmt) {
+		mysql_stmt_close(m_stmt);
+	}
 	OATPP_LOGd("QueryResult", "QueryResult destroyed");
 }
 
@@ -43,6 +69,9 @@ v_int64 QueryResult::getPosition() const {
 }
 
 v_int64 QueryResult::getKnownCount() const {
+  if (!m_stmt) {
+    return m_affectedRows;
+  }
   return m_resultMapper->getKnownCount(const_cast<oatpp::mysql::mapping::ResultMapper::ResultData *>(&m_resultData));
 }
 
@@ -52,7 +81,66 @@ bool QueryResult::hasMoreToFetch() const {
 
 oatpp::Void QueryResult::fetch(const oatpp::Type* const type, v_int64 count) {
   // OATPP_LOGd("QueryResult::fetch", "Fetching {} rows, type_id={}, type_name={}", count, type->classId.id, type->classId.name);
-  return m_resultMapper->readRows(&m_resultData, type, count);
+  return m_resultMapper->readRows(getResultData(), type, count);
+}
+
+oatpp::Void QueryResult::fetchTyped(const oatpp::Type* const type, v_int64 count) {
+  return m_resultMapper->readRowsTyped(getResultData(), type, count);
+}
+
+mapping::ResultMapper::ResultData* QueryResult::getResultData() {
+  m_resultData.completeRow();
+  return &m_resultData;
+}
+
+v_int64 QueryResult::streamColumn(const oatpp::String& column, data::stream::OutputStream* stream, v_buff_size chunkSize) {
+
+  if(!m_resultData.hasMore) {
+    throw std::runtime_error("[oatpp::mysql::QueryResult::streamColumn()]: Error. No current row.");
+  }
+
+  auto it = m_resultData.colIndices.find(column);
+  if(it == m_resultData.colIndices.end()) {
+    throw std::runtime_error("[oatpp::mysql::QueryResult::streamColumn()]: Error. Unknown column '" + *column + "'.");
+  }
+
+  return m_resultData.streamColumn(it->second, stream, chunkSize);
+
+}
+
+const std::shared_ptr<mapping::ResultMapper>& QueryResult::getResultMapper() const {
+  return m_resultMapper;
+}
+
+oatpp::Void QueryResult::fetchPipelined(const oatpp::Type* const type,
+                                        v_int64 count,
+                                        const mapping::FetchPipeline::Config& config)
+{
+  mapping::FetchPipeline pipeline(m_resultMapper, getWorkerPool(), config);
+  return pipeline.fetch(getResultData(), type, count);
+}
+
+v_int64 QueryResult::fetchColumns(mapping::ColumnarResult& columns, v_int64 count) {
+  return columns.read(getResultData(), count);
+}
+
+v_int64 QueryResult::fetchBatch(mapping::RowBatch& batch, v_int64 count) {
+  return batch.read(getResultData(), count);
+}
+
+const std::shared_ptr<WorkerPool>& QueryResult::getWorkerPool() const {
+  if(!m_workerPool) {
+    throw std::runtime_error("[oatpp::mysql::QueryResult::getWorkerPool()]: Error. "
+                             "WorkerPool is not set. Async operations are not available for this result.");
+  }
+  return m_workerPool;
+}
+
+async::CoroutineStarterForResult<const oatpp::Void&> QueryResult::fetchAsync(const oatpp::Type* const type, v_int64 count) {
+  auto self = shared_from_this();
+  return getWorkerPool()->execute<oatpp::Void>([self, type, count]() {
+    return self->fetch(type, count);
+  });
 }
 
 }}
@@ -2,28 +2,54 @@
 #define oatpp_mysql_QueryResult_hpp
 
 #include "ConnectionProvider.hpp"
+#include "WorkerPool.hpp"
+#include "mapping/ColumnarResult.hpp"
 #include "mapping/Deserializer.hpp"
+#include "mapping/FetchPipeline.hpp"
+#include "mapping/RowBatch.hpp"
+#include "mapping/StructReader.hpp"
 #include "mapping/ResultMapper.hpp"
 #include "oatpp/orm/QueryResult.hpp"
 
+#include <type_traits>
+
 namespace oatpp { namespace mysql {
 
 /**
  * Implementation of &id:oatpp::orm::QueryResult;. for mysql.
  */
-class QueryResult : public orm::QueryResult {
+class QueryResult : public orm::QueryResult, public std::enable_shared_from_this<QueryResult> {
 private:
   MYSQL_STMT* m_stmt;
   provider::ResourceHandle<orm::Connection> m_connection;
   std::shared_ptr<mapping::ResultMapper> m_resultMapper;
   mapping::ResultMapper::ResultData m_resultData;
   oatpp::String m_errorMessage;
+  std::shared_ptr<WorkerPool> m_workerPool;
+  v_int64 m_affectedRows;
 public:
 
   QueryResult(MYSQL_STMT* stmt,
               const provider::ResourceHandle<orm::Connection>& connection,
               const std::shared_ptr<mapping::ResultMapper>& resultMapper,
-              const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver);
+              const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+              const std::shared_ptr<WorkerPool>& workerPool = nullptr);
+
+  /**
+   * Constructor for the result of the text protocol query executed by &id:oatpp::mysql::NonBlockingEngine;.
+   * @param textResults - stored result. Ownership is taken. `nullptr` if query has no result set or failed.
+   * @param handle - connection handle to read error and affected rows from.
+   * @param connection
+   * @param resultMapper
+   * @param typeResolver
+   * @param workerPool
+   */
+  QueryResult(MYSQL_RES* textResults,
+              MYSQL* handle,
+              const provider::ResourceHandle<orm::Connection>& connection,
+              const std::shared_ptr<mapping::ResultMapper>& resultMapper,
+              const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+              const std::shared_ptr<WorkerPool>& workerPool = nullptr);
 
   ~QueryResult();
 
@@ -41,6 +67,140 @@ public:
 
   oatpp::Void fetch(const oatpp::Type* const type, v_int64 count) override;
 
+  /**
+   * Get result data positioned at the current row. Used to read rows of several results in custom order. <br>
+   * Values of the current row which didn't fit the bind buffers are fetched, except for the streamed columns.
+   * @return - &id:oatpp::mysql::mapping::ResultMapper::ResultData;.
+   */
+  mapping::ResultMapper::ResultData* getResultData();
+
+  /**
+   * Write value of the large `BLOB`/`TEXT` column of the current row to the stream in chunks -
+   * memory used doesn't depend on the value size. <br>
+   * Call it before the row is fetched - fetch moves to the next row. Other columns of the row are fetched as usual,
+   * the streamed column then holds only the prefix which fits the bind buffer, and so it does for the following rows.
+   * ```
+   * while(res->hasMoreToFetch()) {
+   *   res->streamColumn("data", fileStream.get());
+   *   auto rows = res->fetch<oatpp::Vector<oatpp::Object<FileInfoDto>>>(1);
+   * }
+   * ```
+   * @param column - column name.
+   * @param stream - &id:oatpp::data::stream::OutputStream;.
+   * @param chunkSize - size of the chunk read with `mysql_stmt_fetch_column()`.
+   * @return - number of bytes written. `0` for null.
+   */
+  v_int64 streamColumn(const oatpp::String& column,
+                       data::stream::OutputStream* stream,
+                       v_buff_size chunkSize = mapping::ResultMapper::ResultData::DEFAULT_STREAM_CHUNK_SIZE);
+
+  /**
+   * Get result mapper.
+   * @return - &id:oatpp::mysql::mapping::ResultMapper;.
+   */
+  const std::shared_ptr<mapping::ResultMapper>& getResultMapper() const;
+
+  /**
+   * Fetch rows on the &id:oatpp::mysql::WorkerPool; thread and resume the calling coroutine with the result.
+   * @param type - result container type.
+   * @param count - how many rows to fetch. `-1` - fetch all remaining rows.
+   * @return - &id:oatpp::async::CoroutineStarterForResult;.
+   */
+  async::CoroutineStarterForResult<const oatpp::Void&> fetchAsync(const oatpp::Type* const type, v_int64 count);
+
+  /**
+   * Fetch rows asynchronously. Same as &l:QueryResult::fetchAsync (); but with the result of `Wrapper` type.
+   * @tparam Wrapper - result container type.
+   * @param count - how many rows to fetch. `-1` - fetch all remaining rows.
+   * @return - &id:oatpp::async::CoroutineStarterForResult;.
+   */
+  template<class Wrapper>
+  async::CoroutineStarterForResult<const Wrapper&> fetchAsync(v_int64 count = -1) {
+    auto self = shared_from_this();
+    return getWorkerPool()->execute<Wrapper>([self, count]() {
+      return self->fetch(Wrapper::Class::getType(), count).template cast<Wrapper>();
+    });
+  }
+
+  /**
+   * Fetch rows with network reads overlapped with deserialization - see &id:oatpp::mysql::mapping::FetchPipeline;. <br>
+   * Rows are decoded on the &id:oatpp::mysql::WorkerPool; threads. Order of rows is preserved.
+   * @param type - result container type.
+   * @param count - how many rows to fetch. `-1` - fetch all remaining rows.
+   * @param config - &id:oatpp::mysql::mapping::FetchPipeline::Config;.
+   * @return - collection of rows.
+   */
+  oatpp::Void fetchPipelined(const oatpp::Type* const type,
+                             v_int64 count,
+                             const mapping::FetchPipeline::Config& config = mapping::FetchPipeline::Config());
+
+  /**
+   * Fetch rows pipelined. Same as &l:QueryResult::fetchPipelined (); but with the result of `Wrapper` type.
+   * @tparam Wrapper - result container type.
+   * @param count - how many rows to fetch. `-1` - fetch all remaining rows.
+   * @param config - &id:oatpp::mysql::mapping::FetchPipeline::Config;.
+   * @return - `Wrapper`.
+   */
+  template<class Wrapper>
+  Wrapper fetchPipelined(v_int64 count = -1, const mapping::FetchPipeline::Config& config = mapping::FetchPipeline::Config()) {
+    return fetchPipelined(Wrapper::Class::getType(), count, config).template cast<Wrapper>();
+  }
+
+  /**
+   * Fetch rows to typed column buffers without creating oatpp objects - see &id:oatpp::mysql::mapping::ColumnarResult;. <br>
+   * Rows are appended to the `columns`. Call &id:oatpp::mysql::mapping::ColumnarResult::clear; to reuse it for the next batch.
+   * @param columns - &id:oatpp::mysql::mapping::ColumnarResult;.
+   * @param count - how many rows to fetch. `-1` - fetch all remaining rows.
+   * @return - number of rows fetched.
+   */
+  v_int64 fetchColumns(mapping::ColumnarResult& columns, v_int64 count = -1);
+
+  /**
+   * Fetch next rows to the reusable row batch - see &id:oatpp::mysql::mapping::RowBatch;. <br>
+   * Previous rows of the batch are replaced and their views are invalidated.
+   * @param batch - &id:oatpp::mysql::mapping::RowBatch;.
+   * @param count - max number of rows to fetch. `-1` - fetch all remaining rows.
+   * @return - number of rows fetched.
+   */
+  v_int64 fetchBatch(mapping::RowBatch& batch, v_int64 count);
+
+  /**
+   * Fetch rows straight into the caller's array of plain structs - see &id:oatpp::mysql::mapping::StructReader;.
+   * @tparam T - standard-layout struct described by the `reader`.
+   * @param reader - &id:oatpp::mysql::mapping::StructReader;.
+   * @param rows - pointer to the first struct.
+   * @param capacity - number of structs in the array.
+   * @return - number of rows fetched.
+   */
+  template<class T>
+  v_int64 fetchInto(mapping::StructReader& reader, T* rows, v_int64 capacity) {
+    static_assert(std::is_standard_layout<T>::value, "[oatpp::mysql::QueryResult::fetchInto()]: T must be a standard-layout struct.");
+    return reader.read(getResultData(), rows, sizeof(T), capacity);
+  }
+
+  /**
+   * Fetch rows to the collection of DTOs with the row decoder bound to the result columns once -
+   * see &id:oatpp::mysql::mapping::DecodePlan;.
+   * @param type - result container type.
+   * @param count - how many rows to fetch. `-1` - fetch all remaining rows.
+   * @return - collection of rows.
+   */
+  oatpp::Void fetchTyped(const oatpp::Type* const type, v_int64 count);
+
+  /**
+   * Fetch rows with bound row decoder. Same as &l:QueryResult::fetchTyped (); but with the result of `Wrapper` type.
+   * @tparam Wrapper - result container type. Ex.: `oatpp::Vector<oatpp::Object<MyDto>>`.
+   * @param count - how many rows to fetch. `-1` - fetch all remaining rows.
+   * @return - `Wrapper`.
+   */
+  template<class Wrapper>
+  Wrapper fetchTyped(v_int64 count = -1) {
+    return fetchTyped(Wrapper::Class::getType(), count).template cast<Wrapper>();
+  }
+
+private:
+  const std::shared_ptr<WorkerPool>& getWorkerPool() const;
+
 };
 
 }}
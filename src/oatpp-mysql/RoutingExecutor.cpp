@@ -0,0 +1,633 @@
+#include "RoutingExecutor.hpp"
+
+#include "ql_template/Parser.hpp"
+
+#include "oatpp/Environment.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace oatpp { namespace mysql {
+
+constexpr v_int64 RoutingExecutor::LATENCY_EWMA_DIVISOR;
+constexpr size_t RoutingExecutor::LATENCY_WINDOW_SIZE;
+constexpr size_t RoutingExecutor::LATENCY_WINDOW_MIN_SAMPLES;
+constexpr v_float64 RoutingExecutor::HEDGE_TOKENS_BURST;
+
+RoutingExecutor::RequestTracker::RequestTracker(const std::shared_ptr<Replica>& replica)
+  : m_replica(replica)
+  , m_startTime(oatpp::Environment::getMicroTickCount())
+{
+  m_replica->outstanding ++;
+  m_replica->queriesCount ++;
+}
+
+RoutingExecutor::RequestTracker::~RequestTracker() {
+  m_replica->outstanding --;
+}
+
+v_int64 RoutingExecutor::RequestTracker::complete() {
+  v_int64 sample = oatpp::Environment::getMicroTickCount() - m_startTime;
+  // concurrent updates may lose a sample - that's fine for the moving average
+  v_int64 latency = m_replica->latencyMicros;
+  if(latency == 0) {
+    m_replica->latencyMicros = sample;
+  } else {
+    m_replica->latencyMicros = latency + (sample - latency) / LATENCY_EWMA_DIVISOR;
+  }
+  return sample;
+}
+
+RoutingExecutor::LatencyWindow::LatencyWindow()
+  : m_position(0)
+{
+  m_samples.reserve(LATENCY_WINDOW_SIZE);
+}
+
+void RoutingExecutor::LatencyWindow::record(v_int64 sample) {
+  std::lock_guard<std::mutex> guard(m_lock);
+  if(m_samples.size() < LATENCY_WINDOW_SIZE) {
+    m_samples.push_back(sample);
+  } else {
+    m_samples[m_position] = sample;
+    m_position = (m_position + 1) % LATENCY_WINDOW_SIZE;
+  }
+}
+
+// -1 if there are not enough samples yet
+v_int64 RoutingExecutor::LatencyWindow::getPercentile(v_float64 percentile) {
+
+  std::vector<v_int64> samples;
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    if(m_samples.size() < LATENCY_WINDOW_MIN_SAMPLES) {
+      return -1;
+    }
+    samples = m_samples;
+  }
+
+  size_t index = (size_t) (percentile * (samples.size() - 1));
+  std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+  return samples[index];
+
+}
+
+RoutingExecutor::RoutingExecutor(const std::shared_ptr<provider::Provider<Connection>>& primaryProvider,
+                                 const std::vector<std::shared_ptr<provider::Provider<Connection>>>& replicaProviders,
+                                 const std::shared_ptr<WorkerPool>& workerPool)
+  : Executor(primaryProvider, workerPool)
+  , m_nextReplica(0)
+  , m_gtidWaitTimeoutMicros(50 * 1000)
+  , m_latencyWindow(std::make_shared<LatencyWindow>())
+  , m_hedgePercentile(0.95)
+  , m_hedgeRatio(0.05)
+  , m_hedgeTokens(0)
+  , m_hedgesCount(0)
+{
+  for(auto& replicaProvider : replicaProviders) {
+    m_replicas.push_back(std::make_shared<Replica>(replicaProvider, getWorkerPool()));
+  }
+}
+
+// pick replica with the lowest (outstanding + 1) * latency.
+// Scan starts from the rotating index so that ties are spread across replicas.
+std::shared_ptr<RoutingExecutor::Replica> RoutingExecutor::selectReplica(const std::shared_ptr<Replica>& exclude) {
+
+  v_uint64 size = m_replicas.size();
+  v_uint64 start = m_nextReplica ++;
+
+  std::shared_ptr<Replica> result;
+  v_int64 bestScore = 0;
+
+  for(v_uint64 i = 0; i < size; i ++) {
+    auto& replica = m_replicas[(start + i) % size];
+    if(replica == exclude) {
+      continue;
+    }
+    v_int64 score = (replica->outstanding + 1) * (replica->latencyMicros + 1);
+    if(!result || score < bestScore) {
+      result = replica;
+      bestScore = score;
+    }
+  }
+
+  return result;
+
+}
+
+bool RoutingExecutor::isReadOnly(const StringTemplate& queryTemplate) {
+  auto extra = std::static_pointer_cast<ql_template::Parser::TemplateExtra>(queryTemplate.getExtraData());
+  return extra && extra->readOnly;
+}
+
+void RoutingExecutor::captureGtids(const std::shared_ptr<orm::QueryResult>& result,
+                                   const std::shared_ptr<ConsistencySession>& session)
+{
+
+  auto connection = result->getConnection();
+  if(!connection) {
+    return;
+  }
+
+  MYSQL* handle = std::static_pointer_cast<Connection>(connection.object)->getHandle();
+
+  const char* data;
+  size_t length;
+  if(mysql_session_track_get_first(handle, SESSION_TRACK_GTIDS, &data, &length) == 0) {
+    do {
+      session->addGtids(std::string(data, length));
+    } while(mysql_session_track_get_next(handle, SESSION_TRACK_GTIDS, &data, &length) == 0);
+  }
+
+}
+
+bool RoutingExecutor::waitForGtids(const std::shared_ptr<Replica>& replica,
+                                   const provider::ResourceHandle<orm::Connection>& connection,
+                                   const ConsistencySession::GtidSet& gtids,
+                                   v_int64 timeoutMicros)
+{
+
+  {
+    std::lock_guard<std::mutex> guard(replica->lock);
+    if(replica->appliedGtids.contains(gtids)) {
+      return true;
+    }
+  }
+
+  if(timeoutMicros <= 0) {
+    return false;
+  }
+
+  MYSQL* handle = std::static_pointer_cast<Connection>(connection.object)->getHandle();
+
+  // GTID set comes from the server tracker - uuids, tags and numbers only, no escaping needed
+  char timeout[32];
+  std::snprintf(timeout, sizeof(timeout), "%.6f", (double) timeoutMicros / 1000000.0);
+  std::string query = "SELECT WAIT_FOR_EXECUTED_GTID_SET('" + gtids.toString() + "', " + timeout + ")";
+
+  if(mysql_real_query(handle, query.data(), (unsigned long) query.size()) != 0) {
+    return false;
+  }
+
+  MYSQL_RES* res = mysql_store_result(handle);
+  if(res == nullptr) {
+    return false;
+  }
+
+  // 0 - applied, 1 - timeout
+  MYSQL_ROW row = mysql_fetch_row(res);
+  bool applied = row != nullptr && row[0] != nullptr && std::strcmp(row[0], "0") == 0;
+  mysql_free_result(res);
+
+  if(applied) {
+    std::lock_guard<std::mutex> guard(replica->lock);
+    replica->appliedGtids.merge(gtids);
+  }
+
+  return applied;
+
+}
+
+void RoutingExecutor::setGtidWaitTimeout(v_int64 micros) {
+  m_gtidWaitTimeoutMicros = micros;
+}
+
+void RoutingExecutor::setHedging(v_float64 percentile, v_float64 maxHedgeRatio) {
+  m_hedgePercentile = percentile;
+  m_hedgeRatio = maxHedgeRatio;
+}
+
+v_int64 RoutingExecutor::getHedgesCount() {
+  return m_hedgesCount;
+}
+
+void RoutingExecutor::refillHedgeTokens() {
+  std::lock_guard<std::mutex> guard(m_hedgeLock);
+  m_hedgeTokens = std::min(HEDGE_TOKENS_BURST, m_hedgeTokens + m_hedgeRatio);
+}
+
+bool RoutingExecutor::acquireHedgeToken() {
+  std::lock_guard<std::mutex> guard(m_hedgeLock);
+  if(m_hedgeTokens >= 1) {
+    m_hedgeTokens -= 1;
+    return true;
+  }
+  return false;
+}
+
+// false if the attempt was not launched - the other attempt has already won or the pool queue is full
+bool RoutingExecutor::launchAttempt(const std::shared_ptr<HedgeState>& state,
+                                    v_int32 index,
+                                    const std::shared_ptr<Replica>& replica,
+                                    const StringTemplate& queryTemplate,
+                                    const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                    const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver)
+{
+
+  {
+    std::lock_guard<std::mutex> guard(state->lock);
+    if(state->done) {
+      return false;
+    }
+    state->attempts[index].replica = replica;
+    state->launched ++;
+  }
+
+  // the losing attempt outlives execute() - the task holds the shared state only, never the executor
+  auto latencyWindow = m_latencyWindow;
+
+  bool posted = getWorkerPool()->tryPost([state, index, replica, latencyWindow, queryTemplate, params, typeResolver]() {
+
+    std::shared_ptr<orm::QueryResult> result;
+    std::exception_ptr error;
+
+    try {
+
+      RequestTracker tracker(replica);
+      auto connection = replica->executor->getConnection();
+
+      {
+        std::lock_guard<std::mutex> guard(state->lock);
+        if(state->done) {
+          // the other attempt has already won
+          state->attempts[index].finished = true;
+          state->finished ++;
+          return;
+        }
+        state->attempts[index].connection = connection;
+      }
+
+      result = replica->executor->execute(queryTemplate, params, typeResolver, connection);
+      latencyWindow->record(tracker.complete());
+
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(state->lock);
+      state->attempts[index].finished = true;
+      state->finished ++;
+      if(!state->done) {
+        bool success = result && result->isSuccess();
+        if(success || state->finished == state->launched) {
+          state->done = true;
+          state->result = result;
+          state->error = error;
+        } else if(!state->result && !state->error) {
+          // keep the failure in case the other attempt fails as well
+          state->result = result;
+          state->error = error;
+        }
+      }
+    }
+
+    state->condition.notify_all();
+
+  });
+
+  if(!posted) {
+    // pool is saturated - don't add the load, the attempt already launched (if any) decides the result
+    std::lock_guard<std::mutex> guard(state->lock);
+    state->attempts[index].replica = nullptr;
+    state->launched --;
+    if(!state->done && state->launched > 0 && state->finished == state->launched) {
+      state->done = true;
+    }
+  }
+
+  return posted;
+
+}
+
+void RoutingExecutor::cancelAttempt(const std::shared_ptr<HedgeState>& state, v_int32 index) {
+
+  // if the queue is full the query is not killed - it will finish on its own
+  getWorkerPool()->tryPost([state, index]() {
+
+    std::shared_ptr<Replica> replica;
+    provider::ResourceHandle<orm::Connection> connection;
+
+    {
+      std::lock_guard<std::mutex> guard(state->lock);
+      auto& attempt = state->attempts[index];
+      if(attempt.finished || !attempt.connection) {
+        return;
+      }
+      replica = attempt.replica;
+      // the handle is also held by the state - the connection can't go back to the pool before it's invalidated
+      connection = attempt.connection;
+    }
+
+    try {
+
+      MYSQL* handle = std::static_pointer_cast<Connection>(connection.object)->getHandle();
+      std::string query = "KILL QUERY " + std::to_string(mysql_thread_id(handle));
+
+      auto killConnection = replica->provider->get();
+      mysql_real_query(killConnection.object->getHandle(), query.data(), (unsigned long) query.size());
+
+    } catch (...) {
+      // can't reach the replica - the query will finish on its own
+    }
+
+    // killed connection is not returned to the pool
+    connection.invalidator->invalidate(connection.object);
+
+  });
+
+}
+
+std::shared_ptr<orm::QueryResult> RoutingExecutor::executeHedged(const StringTemplate& queryTemplate,
+                                                                 const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                                                 const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver)
+{
+
+  // token bucket - every hedge-eligible read adds m_hedgeRatio tokens, every hedge takes one
+  refillHedgeTokens();
+
+  v_int64 delay = m_latencyWindow->getPercentile(m_hedgePercentile);
+  auto first = selectReplica();
+
+  auto state = std::make_shared<HedgeState>();
+
+  if(delay < 0 || !launchAttempt(state, 0, first, queryTemplate, params, typeResolver)) {
+    // not enough statistics yet or the pool is saturated - plain read
+    RequestTracker tracker(first);
+    auto result = Executor::execute(queryTemplate, params, typeResolver, wrapConnection(first->provider->get()));
+    m_latencyWindow->record(tracker.complete());
+    return result;
+  }
+
+  bool done;
+  {
+    std::unique_lock<std::mutex> guard(state->lock);
+    done = state->condition.wait_for(guard, std::chrono::microseconds(delay), [&state]() {
+      return state->done;
+    });
+  }
+
+  // no lock is held while the attempt is queued
+  if(!done && acquireHedgeToken() && launchAttempt(state, 1, selectReplica(first), queryTemplate, params, typeResolver)) {
+    m_hedgesCount ++;
+  }
+
+  std::vector<v_int32> unfinished;
+  {
+    std::unique_lock<std::mutex> guard(state->lock);
+    state->condition.wait(guard, [&state]() {
+      return state->done;
+    });
+    for(v_int32 i = 0; i < state->launched; i ++) {
+      if(!state->attempts[i].finished) {
+        unfinished.push_back(i);
+      }
+    }
+  }
+
+  for(v_int32 index : unfinished) {
+    cancelAttempt(state, index);
+  }
+
+  if(state->error) {
+    std::rethrow_exception(state->error);
+  }
+
+  return state->result;
+
+}
+
+std::shared_ptr<orm::QueryResult> RoutingExecutor::execute(const StringTemplate& queryTemplate,
+                                                           const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                                           const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                                                           const provider::ResourceHandle<orm::Connection>& connection)
+{
+
+  auto session = ConsistencySession::getCurrent();
+
+  if(connection || m_replicas.empty() || !isReadOnly(queryTemplate)) {
+    auto result = Executor::execute(queryTemplate, params, typeResolver, connection);
+    if(session) {
+      captureGtids(result, session);
+    }
+    return result;
+  }
+
+  auto extra = std::static_pointer_cast<ql_template::Parser::TemplateExtra>(queryTemplate.getExtraData());
+  bool hedge = extra->hasHint("hedge") && m_replicas.size() > 1;
+
+  if(hedge && (!session || session->getGtids().isEmpty())) {
+    return executeHedged(queryTemplate, params, typeResolver);
+  }
+
+  auto replica = selectReplica();
+  RequestTracker tracker(replica);
+
+  auto replicaConnection = wrapConnection(replica->provider->get());
+
+  if(session) {
+    auto gtids = session->getGtids();
+    if(!gtids.isEmpty() && !waitForGtids(replica, replicaConnection, gtids, m_gtidWaitTimeoutMicros)) {
+      // replica is behind the session - read from the primary
+      return Executor::execute(queryTemplate, params, typeResolver, nullptr);
+    }
+  }
+
+  auto result = Executor::execute(queryTemplate, params, typeResolver, replicaConnection);
+  m_latencyWindow->record(tracker.complete());
+
+  return result;
+
+}
+
+async::CoroutineStarterForResult<const std::shared_ptr<orm::QueryResult>&>
+RoutingExecutor::executeAsync(const StringTemplate& queryTemplate,
+                              const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                              const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                              const provider::ResourceHandle<orm::Connection>& connection)
+{
+
+  auto session = ConsistencySession::getCurrent();
+
+  if(connection || m_replicas.empty() || !isReadOnly(queryTemplate)) {
+
+    if(!session) {
+      return Executor::executeAsync(queryTemplate, params, typeResolver, connection);
+    }
+
+    class WriteCoroutine : public async::CoroutineWithResult<WriteCoroutine, const std::shared_ptr<orm::QueryResult>&> {
+    private:
+      RoutingExecutor* m_executor;
+      StringTemplate m_queryTemplate;
+      std::unordered_map<oatpp::String, oatpp::Void> m_params;
+      std::shared_ptr<const data::mapping::TypeResolver> m_typeResolver;
+      provider::ResourceHandle<orm::Connection> m_connection;
+      std::shared_ptr<ConsistencySession> m_session;
+    public:
+
+      WriteCoroutine(RoutingExecutor* executor,
+                     const StringTemplate& queryTemplate,
+                     const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                     const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                     const provider::ResourceHandle<orm::Connection>& connection,
+                     const std::shared_ptr<ConsistencySession>& session)
+        : m_executor(executor)
+        , m_queryTemplate(queryTemplate)
+        , m_params(params)
+        , m_typeResolver(typeResolver)
+        , m_connection(connection)
+        , m_session(session)
+      {}
+
+      Action act() override {
+        return m_executor->Executor::executeAsync(m_queryTemplate, m_params, m_typeResolver, m_connection)
+          .callbackTo(&WriteCoroutine::onResult);
+      }
+
+      Action onResult(const std::shared_ptr<orm::QueryResult>& result) {
+        captureGtids(result, m_session);
+        return _return(result);
+      }
+
+    };
+
+    return WriteCoroutine::startForResult(this, queryTemplate, params, typeResolver, connection, session);
+
+  }
+
+  if(session && !session->getGtids().isEmpty()) {
+
+    // GTID wait is a blocking call - the replica read runs on the worker thread.
+    // The task holds the replica and the latency window only - it doesn't touch the executor.
+    class GtidReadCoroutine : public async::CoroutineWithResult<GtidReadCoroutine, const std::shared_ptr<orm::QueryResult>&> {
+    private:
+      RoutingExecutor* m_executor;
+      StringTemplate m_queryTemplate;
+      std::unordered_map<oatpp::String, oatpp::Void> m_params;
+      std::shared_ptr<const data::mapping::TypeResolver> m_typeResolver;
+      ConsistencySession::GtidSet m_gtids;
+    public:
+
+      GtidReadCoroutine(RoutingExecutor* executor,
+                        const StringTemplate& queryTemplate,
+                        const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                        const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                        const ConsistencySession::GtidSet& gtids)
+        : m_executor(executor)
+        , m_queryTemplate(queryTemplate)
+        , m_params(params)
+        , m_typeResolver(typeResolver)
+        , m_gtids(gtids)
+      {}
+
+      Action act() override {
+
+        auto replica = m_executor->selectReplica();
+        auto latencyWindow = m_executor->m_latencyWindow;
+        auto timeoutMicros = m_executor->m_gtidWaitTimeoutMicros;
+        auto queryTemplate = m_queryTemplate;
+        auto params = m_params;
+        auto typeResolver = m_typeResolver;
+        auto gtids = m_gtids;
+
+        return m_executor->getWorkerPool()->execute<std::shared_ptr<orm::QueryResult>>(
+          [replica, latencyWindow, timeoutMicros, queryTemplate, params, typeResolver, gtids]() -> std::shared_ptr<orm::QueryResult> {
+            RequestTracker tracker(replica);
+            auto connection = replica->executor->getConnection();
+            if(!waitForGtids(replica, connection, gtids, timeoutMicros)) {
+              return nullptr;
+            }
+            auto result = replica->executor->execute(queryTemplate, params, typeResolver, connection);
+            latencyWindow->record(tracker.complete());
+            return result;
+          }
+        ).callbackTo(&GtidReadCoroutine::onReplicaResult);
+
+      }
+
+      Action onReplicaResult(const std::shared_ptr<orm::QueryResult>& result) {
+        if(!result) {
+          // replica is behind the session - read from the primary
+          return m_executor->Executor::executeAsync(m_queryTemplate, m_params, m_typeResolver, nullptr)
+            .callbackTo(&GtidReadCoroutine::onPrimaryResult);
+        }
+        return _return(result);
+      }
+
+      Action onPrimaryResult(const std::shared_ptr<orm::QueryResult>& result) {
+        return _return(result);
+      }
+
+    };
+
+    return GtidReadCoroutine::startForResult(this, queryTemplate, params, typeResolver, session->getGtids());
+
+  }
+
+  class ReadCoroutine : public async::CoroutineWithResult<ReadCoroutine, const std::shared_ptr<orm::QueryResult>&> {
+  private:
+    RoutingExecutor* m_executor;
+    StringTemplate m_queryTemplate;
+    std::unordered_map<oatpp::String, oatpp::Void> m_params;
+    std::shared_ptr<const data::mapping::TypeResolver> m_typeResolver;
+    std::shared_ptr<Replica> m_replica;
+    std::shared_ptr<RequestTracker> m_tracker;
+  public:
+
+    ReadCoroutine(RoutingExecutor* executor,
+                  const StringTemplate& queryTemplate,
+                  const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                  const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                  const std::shared_ptr<Replica>& replica)
+      : m_executor(executor)
+      , m_queryTemplate(queryTemplate)
+      , m_params(params)
+      , m_typeResolver(typeResolver)
+      , m_replica(replica)
+    {}
+
+    Action act() override {
+      m_tracker = std::make_shared<RequestTracker>(m_replica);
+      return m_replica->provider->getAsync().callbackTo(&ReadCoroutine::onConnection);
+    }
+
+    Action onConnection(const provider::ResourceHandle<Connection>& connection) {
+      return m_executor->Executor::executeAsync(m_queryTemplate, m_params, m_typeResolver, m_executor->wrapConnection(connection))
+        .callbackTo(&ReadCoroutine::onResult);
+    }
+
+    Action onResult(const std::shared_ptr<orm::QueryResult>& result) {
+      m_executor->m_latencyWindow->record(m_tracker->complete());
+      return _return(result);
+    }
+
+  };
+
+  return ReadCoroutine::startForResult(this, queryTemplate, params, typeResolver, selectReplica());
+
+}
+
+std::shared_ptr<orm::QueryResult> RoutingExecutor::commit(const provider::ResourceHandle<orm::Connection>& connection) {
+  auto result = Executor::commit(connection);
+  auto session = ConsistencySession::getCurrent();
+  if(session) {
+    captureGtids(result, session);
+  }
+  return result;
+}
+
+std::vector<RoutingExecutor::ReplicaStats> RoutingExecutor::getReplicaStats() {
+  std::vector<ReplicaStats> result;
+  for(auto& replica : m_replicas) {
+    ReplicaStats stats;
+    stats.outstanding = replica->outstanding;
+    stats.latencyMicros = replica->latencyMicros;
+    stats.queriesCount = replica->queriesCount;
+    result.push_back(stats);
+  }
+  return result;
+}
+
+}}
@@ -0,0 +1,258 @@
+#ifndef oatpp_mysql_RoutingExecutor_hpp
+#define oatpp_mysql_RoutingExecutor_hpp
+
+#include "ConsistencySession.hpp"
+#include "Executor.hpp"
+
+#include <atomic>
+#include <condition_variable>
+
+namespace oatpp { namespace mysql {
+
+/**
+ * Executor splitting reads and writes between the primary and replica servers. <br>
+ * Queries are classified when the template is parsed (see &id:oatpp::mysql::ql_template::Parser::TemplateExtra::readOnly;):
+ *
+ * - read-only queries go to a replica - the one with the least outstanding requests weighted by its observed latency.
+ * - all other queries go to the primary. So do reads of the session state - `LAST_INSERT_ID()`, `@var`, etc.
+ * - queries executed on the explicit connection (transactions) stay on that connection.
+ *   &l:RoutingExecutor::getConnection (); returns primary connection - &id:oatpp::orm::Transaction; runs on the primary.
+ *
+ * Use `/&#42;oatpp: read&#42;/` or `/&#42;oatpp: write&#42;/` hint to override the classification. <br>
+ * Within &id:oatpp::mysql::ConsistencySession::Scope; GTIDs of the writes are recorded to the session,
+ * and reads of the session are made on a replica only after it has applied them -
+ * `WAIT_FOR_EXECUTED_GTID_SET` bounded by &l:RoutingExecutor::setGtidWaitTimeout ();. If the replica is still behind
+ * the read falls back to the primary. <br>
+ * Reads with the `hedge` hint (`/&#42;oatpp: hedge&#42;/`) are hedged - see &l:RoutingExecutor::setHedging ();.
+ */
+class RoutingExecutor : public Executor {
+public:
+
+  /**
+   * Replica statistics.
+   */
+  struct ReplicaStats {
+
+    /**
+     * Number of queries in flight.
+     */
+    v_int64 outstanding;
+
+    /**
+     * Moving average of query latency in microseconds.
+     */
+    v_int64 latencyMicros;
+
+    /**
+     * Number of queries routed to the replica.
+     */
+    v_int64 queriesCount;
+
+  };
+
+private:
+
+  struct Replica {
+
+    Replica(const std::shared_ptr<provider::Provider<Connection>>& pProvider, const std::shared_ptr<WorkerPool>& workerPool)
+      : provider(pProvider)
+      , executor(std::make_shared<Executor>(pProvider, workerPool))
+      , outstanding(0)
+      , latencyMicros(0)
+      , queriesCount(0)
+    {}
+
+    std::shared_ptr<provider::Provider<Connection>> provider;
+
+    /*
+     * Executes reads made on the worker threads - these tasks may outlive the call and must not touch RoutingExecutor.
+     */
+    std::shared_ptr<Executor> executor;
+
+    std::atomic<v_int64> outstanding;
+    std::atomic<v_int64> latencyMicros;
+    std::atomic<v_int64> queriesCount;
+
+    /*
+     * GTIDs the replica is known to have applied - reads of sessions behind this set need no wait.
+     */
+    std::mutex lock;
+    ConsistencySession::GtidSet appliedGtids;
+
+  };
+
+  /*
+   * Counts the request as outstanding while alive. Latency is recorded only for the completed requests.
+   */
+  class RequestTracker {
+  private:
+    std::shared_ptr<Replica> m_replica;
+    v_int64 m_startTime;
+  public:
+    RequestTracker(const std::shared_ptr<Replica>& replica);
+    ~RequestTracker();
+    v_int64 complete();
+  };
+
+  /*
+   * Latencies of the recent reads - source of the hedge delay.
+   */
+  class LatencyWindow {
+  private:
+    std::mutex m_lock;
+    std::vector<v_int64> m_samples;
+    size_t m_position;
+  public:
+    LatencyWindow();
+    void record(v_int64 sample);
+    v_int64 getPercentile(v_float64 percentile);
+  };
+
+  /*
+   * Attempts of the hedged read. The first successful attempt wins, the other one is cancelled.
+   */
+  struct HedgeState {
+
+    struct Attempt {
+      std::shared_ptr<Replica> replica;
+      provider::ResourceHandle<orm::Connection> connection;
+      bool finished = false;
+    };
+
+    std::mutex lock;
+    std::condition_variable condition;
+    Attempt attempts[2];
+    v_int32 launched = 0;
+    v_int32 finished = 0;
+    bool done = false;
+    std::shared_ptr<orm::QueryResult> result;
+    std::exception_ptr error;
+
+  };
+
+private:
+  /*
+   * Weight of the new latency sample is 1/LATENCY_EWMA_DIVISOR.
+   */
+  static constexpr v_int64 LATENCY_EWMA_DIVISOR = 8;
+
+  /*
+   * Number of recent read latencies kept to compute the hedge delay.
+   */
+  static constexpr size_t LATENCY_WINDOW_SIZE = 256;
+
+  /*
+   * Reads are not hedged until there are enough samples for the percentile.
+   */
+  static constexpr size_t LATENCY_WINDOW_MIN_SAMPLES = 32;
+
+  /*
+   * Max number of hedges made in a burst.
+   */
+  static constexpr v_float64 HEDGE_TOKENS_BURST = 10;
+private:
+  std::vector<std::shared_ptr<Replica>> m_replicas;
+  std::atomic<v_uint64> m_nextReplica;
+  v_int64 m_gtidWaitTimeoutMicros;
+  std::shared_ptr<LatencyWindow> m_latencyWindow;
+  v_float64 m_hedgePercentile;
+  v_float64 m_hedgeRatio;
+  std::mutex m_hedgeLock;
+  v_float64 m_hedgeTokens;
+  std::atomic<v_int64> m_hedgesCount;
+private:
+  std::shared_ptr<Replica> selectReplica(const std::shared_ptr<Replica>& exclude = nullptr);
+  bool isReadOnly(const StringTemplate& queryTemplate);
+  static void captureGtids(const std::shared_ptr<orm::QueryResult>& result, const std::shared_ptr<ConsistencySession>& session);
+  static bool waitForGtids(const std::shared_ptr<Replica>& replica,
+                           const provider::ResourceHandle<orm::Connection>& connection,
+                           const ConsistencySession::GtidSet& gtids,
+                           v_int64 timeoutMicros);
+  void refillHedgeTokens();
+  bool acquireHedgeToken();
+  bool launchAttempt(const std::shared_ptr<HedgeState>& state,
+                     v_int32 index,
+                     const std::shared_ptr<Replica>& replica,
+                     const StringTemplate& queryTemplate,
+                     const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                     const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver);
+  void cancelAttempt(const std::shared_ptr<HedgeState>& state, v_int32 index);
+  std::shared_ptr<orm::QueryResult> executeHedged(const StringTemplate& queryTemplate,
+                                                  const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                                  const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver);
+public:
+
+  /**
+   * Constructor.
+   * @param primaryProvider - provider of connections to the primary server.
+   * @param replicaProviders - providers of connections to the replica servers. If empty - all queries go to the primary.
+   * @param workerPool - &id:oatpp::mysql::WorkerPool;. If `nullptr` - executor creates its own pool.
+   */
+  RoutingExecutor(const std::shared_ptr<provider::Provider<Connection>>& primaryProvider,
+                  const std::vector<std::shared_ptr<provider::Provider<Connection>>>& replicaProviders,
+                  const std::shared_ptr<WorkerPool>& workerPool = nullptr);
+
+  /**
+   * Set max time a read of the &id:oatpp::mysql::ConsistencySession; waits for the replica to apply session writes.
+   * `0` - don't wait, read from the primary if the replica is not known to be caught up. Default - 50 milliseconds.
+   * @param micros - timeout in microseconds.
+   */
+  void setGtidWaitTimeout(v_int64 micros);
+
+  /**
+   * Configure hedged reads. <br>
+   * If a read with the `hedge` hint is not answered within the given percentile of the recent read latencies,
+   * the same query is sent to another replica. Whichever answers first is returned, the other query is killed
+   * (`KILL QUERY`) and its connection is invalidated. <br>
+   * Only idempotent reads should be hedged. Hedging is done by &l:RoutingExecutor::execute (); - attempts run on the
+   * &id:oatpp::mysql::WorkerPool;. If the pool queue is full the read is not hedged. <br>
+   * Reads of the &id:oatpp::mysql::ConsistencySession; waiting for GTIDs are not hedged.
+   * @param percentile - latency percentile used as the hedge delay. Default - `0.95`.
+   * @param maxHedgeRatio - max number of hedges per hedge-eligible read. Default - `0.05`.
+   */
+  void setHedging(v_float64 percentile, v_float64 maxHedgeRatio);
+
+  /**
+   * Get number of hedges made.
+   * @return
+   */
+  v_int64 getHedgesCount();
+
+  /**
+   * Execute query on the primary or on a replica. See &id:oatpp::mysql::Executor::execute;.
+   */
+  std::shared_ptr<orm::QueryResult> execute(const StringTemplate& queryTemplate,
+                                            const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                            const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver = nullptr,
+                                            const provider::ResourceHandle<orm::Connection>& connection = nullptr) override;
+
+  /**
+   * Execute query asynchronously on the primary or on a replica. See &id:oatpp::mysql::Executor::executeAsync;. <br>
+   * &id:oatpp::mysql::ConsistencySession; active at the moment of the call is used for the query.
+   */
+  async::CoroutineStarterForResult<const std::shared_ptr<orm::QueryResult>&>
+  executeAsync(const StringTemplate& queryTemplate,
+               const std::unordered_map<oatpp::String, oatpp::Void>& params,
+               const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver = nullptr,
+               const provider::ResourceHandle<orm::Connection>& connection = nullptr) override;
+
+  /**
+   * Commit database transaction. See &id:oatpp::mysql::Executor::commit;. <br>
+   * Transaction gets its GTID on commit, so within &id:oatpp::mysql::ConsistencySession::Scope; the GTID
+   * reported with the commit is recorded to the session.
+   * @param connection
+   * @return - &id:oatpp::orm::QueryResult;.
+   */
+  std::shared_ptr<orm::QueryResult> commit(const provider::ResourceHandle<orm::Connection>& connection) override;
+
+  /**
+   * Get statistics of the replicas in the order they were passed to the constructor.
+   * @return - vector of &l:RoutingExecutor::ReplicaStats;.
+   */
+  std::vector<ReplicaStats> getReplicaStats();
+
+};
+
+}}
+
+#endif // oatpp_mysql_RoutingExecutor_hpp
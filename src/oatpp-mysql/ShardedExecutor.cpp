@@ -0,0 +1,252 @@
+#include "ShardedExecutor.hpp"
+
+#include "ql_template/Parser.hpp"
+
+#include "oatpp/utils/parser/Caret.hpp"
+
+#include <cstdlib>
+
+namespace oatpp { namespace mysql {
+
+ShardedExecutor::ShardedExecutor(const std::vector<std::shared_ptr<provider::Provider<Connection>>>& shardProviders,
+                                 const std::shared_ptr<WorkerPool>& workerPool)
+  : m_workerPool(workerPool)
+  , m_shardFunction(&ShardedExecutor::defaultShardFunction)
+{
+
+  if(shardProviders.empty()) {
+    throw std::runtime_error("[oatpp::mysql::ShardedExecutor::ShardedExecutor()]: Error. No shards.");
+  }
+
+  if(!m_workerPool) {
+    m_workerPool = std::make_shared<WorkerPool>((v_int32) shardProviders.size());
+  }
+
+  for(auto& shardProvider : shardProviders) {
+    m_shards.push_back(std::make_shared<mysql::Executor>(shardProvider, m_workerPool));
+  }
+
+}
+
+// FNV-1a for strings - stable across platforms and builds, unlike std::hash
+v_int32 ShardedExecutor::defaultShardFunction(const oatpp::Void& key, v_int32 shardsCount) {
+
+  auto classId = key.getValueType()->classId.id;
+  v_uint64 hash;
+
+  if(classId == oatpp::String::Class::CLASS_ID.id) {
+    auto& str = *static_cast<std::string*>(key.get());
+    hash = 14695981039346656037ULL;
+    for(char c : str) {
+      hash ^= (v_uint8) c;
+      hash *= 1099511628211ULL;
+    }
+  } else if(classId == oatpp::Int8::Class::CLASS_ID.id) {
+    hash = (v_uint64) std::abs((v_int64) *static_cast<v_int8*>(key.get()));
+  } else if(classId == oatpp::UInt8::Class::CLASS_ID.id) {
+    hash = *static_cast<v_uint8*>(key.get());
+  } else if(classId == oatpp::Int16::Class::CLASS_ID.id) {
+    hash = (v_uint64) std::abs((v_int64) *static_cast<v_int16*>(key.get()));
+  } else if(classId == oatpp::UInt16::Class::CLASS_ID.id) {
+    hash = *static_cast<v_uint16*>(key.get());
+  } else if(classId == oatpp::Int32::Class::CLASS_ID.id) {
+    hash = (v_uint64) std::abs((v_int64) *static_cast<v_int32*>(key.get()));
+  } else if(classId == oatpp::UInt32::Class::CLASS_ID.id) {
+    hash = *static_cast<v_uint32*>(key.get());
+  } else if(classId == oatpp::Int64::Class::CLASS_ID.id) {
+    v_int64 value = *static_cast<v_int64*>(key.get());
+    hash = value < 0 ? (v_uint64) 0 - (v_uint64) value : (v_uint64) value;
+  } else if(classId == oatpp::UInt64::Class::CLASS_ID.id) {
+    hash = *static_cast<v_uint64*>(key.get());
+  } else {
+    throw std::runtime_error("[oatpp::mysql::ShardedExecutor::defaultShardFunction()]: Error. "
+                             "Unsupported shard key type '" + std::string(key.getValueType()->classId.name) + "'. "
+                             "Use setShardFunction() to map keys of this type.");
+  }
+
+  return (v_int32) (hash % (v_uint64) shardsCount);
+
+}
+
+void ShardedExecutor::setShardFunction(const ShardFunction& shardFunction) {
+  m_shardFunction = shardFunction;
+}
+
+void ShardedExecutor::setMergeComparator(const ShardedQueryResult::StringComparator& comparator) {
+  m_mergeComparator = comparator;
+}
+
+v_int32 ShardedExecutor::getShardIndex(const oatpp::Void& key) {
+  v_int32 index = m_shardFunction(key, (v_int32) m_shards.size());
+  if(index < 0 || index >= (v_int32) m_shards.size()) {
+    throw std::runtime_error("[oatpp::mysql::ShardedExecutor::getShardIndex()]: Error. Shard index out of range.");
+  }
+  return index;
+}
+
+std::shared_ptr<mysql::Executor> ShardedExecutor::getShardExecutor(v_int32 index) {
+  return m_shards.at(index);
+}
+
+v_int32 ShardedExecutor::getShardsCount() {
+  return (v_int32) m_shards.size();
+}
+
+std::shared_ptr<data::mapping::TypeResolver> ShardedExecutor::createTypeResolver() {
+  return m_shards[0]->createTypeResolver();
+}
+
+provider::ResourceHandle<orm::Connection> ShardedExecutor::getConnection() {
+  throw std::runtime_error("[oatpp::mysql::ShardedExecutor::getConnection()]: Error. "
+                           "Connection belongs to a shard. Use getShardExecutor(index)->getConnection().");
+}
+
+data::share::StringTemplate ShardedExecutor::parseQueryTemplate(const oatpp::String& name,
+                                                                const oatpp::String& text,
+                                                                const ParamsTypeMap& paramsTypeMap,
+                                                                bool prepare)
+{
+  // template doesn't depend on the shard
+  return m_shards[0]->parseQueryTemplate(name, text, paramsTypeMap, prepare);
+}
+
+// e.g. "user.tenantId" -> value of the property "tenantId" of the parameter "user". nullptr if not found
+oatpp::Void ShardedExecutor::resolveShardKey(const oatpp::String& keyPath,
+                                             const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                             const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver)
+{
+
+  utils::parser::Caret caret(keyPath);
+  auto nameLabel = caret.putLabel();
+  caret.findChar('.');
+  oatpp::String name = nameLabel.toString();
+
+  std::vector<std::string> path;
+  while(caret.canContinue()) {
+    caret.inc();
+    auto label = caret.putLabel();
+    caret.findChar('.');
+    path.push_back(label.std_str());
+  }
+
+  auto it = params.find(name);
+  if(it == params.end()) {
+    return nullptr;
+  }
+
+  data::mapping::TypeResolver::Cache cache;
+  return typeResolver->resolveObjectPropertyValue(it->second, path, cache);
+
+}
+
+std::shared_ptr<orm::QueryResult> ShardedExecutor::executeOnAllShards(const StringTemplate& queryTemplate,
+                                                                      const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                                                      const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver)
+{
+
+  // shards run in parallel - query takes the time of the slowest shard. Each shard writes its own slot
+  std::vector<std::shared_ptr<mysql::QueryResult>> results(m_shards.size());
+  std::vector<WorkerPool::Task> tasks;
+  tasks.reserve(m_shards.size());
+
+  for(size_t i = 0; i < m_shards.size(); i ++) {
+    auto shard = m_shards[i];
+    auto result = &results[i];
+    tasks.push_back([shard, result, &queryTemplate, &params, &typeResolver]() {
+      *result = std::static_pointer_cast<mysql::QueryResult>(shard->execute(queryTemplate, params, typeResolver));
+    });
+  }
+
+  m_workerPool->runAll(tasks);
+
+  auto extra = std::static_pointer_cast<ql_template::Parser::TemplateExtra>(queryTemplate.getExtraData());
+  oatpp::String order = extra->getHint("merge_order");
+
+  if(order) {
+    // "column" or "column:desc"
+    auto pos = order->find(':');
+    if(pos != std::string::npos) {
+      std::string direction = order->substr(pos + 1);
+      bool descending = (direction == "desc" || direction == "DESC");
+      return std::make_shared<ShardedQueryResult>(results, order->substr(0, pos), descending, m_mergeComparator);
+    }
+    return std::make_shared<ShardedQueryResult>(results, order, false, m_mergeComparator);
+  }
+
+  return std::make_shared<ShardedQueryResult>(results);
+
+}
+
+std::shared_ptr<orm::QueryResult> ShardedExecutor::execute(const StringTemplate& queryTemplate,
+                                                           const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                                           const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                                                           const provider::ResourceHandle<orm::Connection>& connection)
+{
+
+  std::shared_ptr<const data::mapping::TypeResolver> tr = typeResolver;
+  if(!tr) {
+    tr = m_defaultTypeResolver;
+  }
+
+  if(connection) {
+    // explicit connection already belongs to some shard
+    return m_shards[0]->execute(queryTemplate, params, tr, connection);
+  }
+
+  auto extra = std::static_pointer_cast<ql_template::Parser::TemplateExtra>(queryTemplate.getExtraData());
+  oatpp::String keyPath = extra->getHint("shard_key");
+
+  if(keyPath) {
+    auto key = resolveShardKey(keyPath, params, tr);
+    if(key) {
+      return m_shards[getShardIndex(key)]->execute(queryTemplate, params, tr);
+    }
+  }
+
+  // a write without the key would be applied to every shard
+  if(!extra->readOnly && !extra->hasHint("broadcast")) {
+    throw std::runtime_error("[oatpp::mysql::ShardedExecutor::execute()]: Error. "
+                             "Query '" + (extra->templateName ? *extra->templateName : std::string()) + "' "
+                             "modifies data and has no shard key value. "
+                             "Set the 'shard_key' hint, or the 'broadcast' hint to run it on all shards.");
+  }
+
+  return executeOnAllShards(queryTemplate, params, tr);
+
+}
+
+std::shared_ptr<orm::QueryResult> ShardedExecutor::begin(const provider::ResourceHandle<orm::Connection>& connection) {
+  if(!connection) {
+    throw std::runtime_error("[oatpp::mysql::ShardedExecutor::begin()]: Error. "
+                             "Transaction can't span shards. Pass the connection of the shard - "
+                             "getShardExecutor(getShardIndex(key))->getConnection().");
+  }
+  // explicit connection already belongs to some shard
+  return m_shards[0]->begin(connection);
+}
+
+std::shared_ptr<orm::QueryResult> ShardedExecutor::commit(const provider::ResourceHandle<orm::Connection>& connection) {
+  return m_shards[0]->commit(connection);
+}
+
+std::shared_ptr<orm::QueryResult> ShardedExecutor::rollback(const provider::ResourceHandle<orm::Connection>& connection) {
+  return m_shards[0]->rollback(connection);
+}
+
+v_int64 ShardedExecutor::getSchemaVersion(const oatpp::String& suffix,
+                                          const provider::ResourceHandle<orm::Connection>& connection)
+{
+  return m_shards[0]->getSchemaVersion(suffix, connection);
+}
+
+void ShardedExecutor::migrateSchema(const oatpp::String& script,
+                                    v_int64 newVersion,
+                                    const oatpp::String& suffix,
+                                    const provider::ResourceHandle<orm::Connection>& connection)
+{
+  for(auto& shard : m_shards) {
+    shard->migrateSchema(script, newVersion, suffix, connection);
+  }
+}
+
+}}
@@ -0,0 +1,145 @@
+#ifndef oatpp_mysql_ShardedExecutor_hpp
+#define oatpp_mysql_ShardedExecutor_hpp
+
+#include "Executor.hpp"
+#include "ShardedQueryResult.hpp"
+
+#include <functional>
+
+namespace oatpp { namespace mysql {
+
+/**
+ * Executor over several shards - mysql servers holding parts of the same tables. <br>
+ * Shard is selected by the value of the query parameter named in the `shard_key` hint:
+ * ```
+ * QUERY(getUsers, "/&#42;oatpp: shard_key=tenantId&#42;/ SELECT * FROM users WHERE tenant_id=:tenantId;", PARAM(oatpp::Int64, tenantId))
+ * ```
+ * Read-only queries (see &id:oatpp::mysql::ql_template::Parser::TemplateExtra::readOnly;) without the `shard_key` hint
+ * (or with `NULL` key value) are sent to all shards in parallel, and the results are merged -
+ * see &id:oatpp::mysql::ShardedQueryResult;. Results are concatenated unless the `merge_order` hint names the column
+ * the results are sorted by - `merge_order=created_at` or `merge_order=created_at:desc`. <br>
+ * Writes without the key value are rejected. Use the `broadcast` hint to run a write on all shards. <br>
+ * Transactions are pinned to a shard - begin them with the connection of the shard:
+ * `getShardExecutor(getShardIndex(key))->getConnection()`.
+ */
+class ShardedExecutor : public orm::Executor {
+public:
+
+  /**
+   * Function mapping shard key value to the shard index `[0..shardsCount)`.
+   */
+  typedef std::function<v_int32(const oatpp::Void& key, v_int32 shardsCount)> ShardFunction;
+
+private:
+  std::vector<std::shared_ptr<mysql::Executor>> m_shards;
+  std::shared_ptr<WorkerPool> m_workerPool;
+  ShardFunction m_shardFunction;
+  ShardedQueryResult::StringComparator m_mergeComparator;
+private:
+  static v_int32 defaultShardFunction(const oatpp::Void& key, v_int32 shardsCount);
+  oatpp::Void resolveShardKey(const oatpp::String& keyPath,
+                              const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                              const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver);
+  std::shared_ptr<orm::QueryResult> executeOnAllShards(const StringTemplate& queryTemplate,
+                                                       const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                                       const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver);
+public:
+
+  /**
+   * Constructor.
+   * @param shardProviders - connection providers of the shards. Shard index is the index in this vector.
+   * @param workerPool - &id:oatpp::mysql::WorkerPool; running shard queries in parallel.
+   * If `nullptr` - executor creates its own pool with a thread per shard.
+   */
+  ShardedExecutor(const std::vector<std::shared_ptr<provider::Provider<Connection>>>& shardProviders,
+                  const std::shared_ptr<WorkerPool>& workerPool = nullptr);
+
+  /**
+   * Set function mapping shard key to the shard index. <br>
+   * Default function takes integer keys modulo shards count and hashes string keys (FNV-1a).
+   * @param shardFunction - &l:ShardedExecutor::ShardFunction;.
+   */
+  void setShardFunction(const ShardFunction& shardFunction);
+
+  /**
+   * Set comparator of the string values of the `merge_order` column. <br>
+   * Required to merge by a column of the non-binary collation - see &id:oatpp::mysql::ShardedQueryResult;.
+   * @param comparator - &id:oatpp::mysql::ShardedQueryResult::StringComparator;. `nullptr` - bytewise only.
+   */
+  void setMergeComparator(const ShardedQueryResult::StringComparator& comparator);
+
+  /**
+   * Get shard index for the key.
+   * @param key - shard key value.
+   * @return - shard index.
+   */
+  v_int32 getShardIndex(const oatpp::Void& key);
+
+  /**
+   * Get executor of the shard. Use it for transactions - transaction can't span shards.
+   * @param index - shard index.
+   * @return - &id:oatpp::mysql::Executor;.
+   */
+  std::shared_ptr<mysql::Executor> getShardExecutor(v_int32 index);
+
+  /**
+   * Get shards count.
+   * @return
+   */
+  v_int32 getShardsCount();
+
+  std::shared_ptr<data::mapping::TypeResolver> createTypeResolver() override;
+
+  /**
+   * Not available - connection belongs to a shard. Use &l:ShardedExecutor::getShardExecutor (); instead.
+   * @throws - `std::runtime_error`.
+   */
+  provider::ResourceHandle<orm::Connection> getConnection() override;
+
+  StringTemplate parseQueryTemplate(const oatpp::String& name,
+                                    const oatpp::String& text,
+                                    const ParamsTypeMap& paramsTypeMap,
+                                    bool prepare = false) override;
+
+  /**
+   * Execute query on the shard selected by the `shard_key` hint or, for reads and `broadcast` queries, on all shards. <br>
+   * Query with explicit connection is executed on that connection.
+   * @param queryTemplate
+   * @param params
+   * @param typeResolver
+   * @param connection
+   * @return - &id:oatpp::orm::QueryResult;.
+   */
+  std::shared_ptr<orm::QueryResult> execute(const StringTemplate& queryTemplate,
+                                            const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                                            const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver = nullptr,
+                                            const provider::ResourceHandle<orm::Connection>& connection = nullptr) override;
+
+  /**
+   * Begin transaction on the connection of a shard. Should NOT be used directly. Use &id:oatpp::orm::Transaction; instead.
+   * @param connection - connection of the shard - `getShardExecutor(index)->getConnection()`.
+   * @return - &id:oatpp::orm::QueryResult;.
+   * @throws - `std::runtime_error` if connection is `nullptr` - transaction can't span shards.
+   */
+  std::shared_ptr<orm::QueryResult> begin(const provider::ResourceHandle<orm::Connection>& connection = nullptr) override;
+
+  std::shared_ptr<orm::QueryResult> commit(const provider::ResourceHandle<orm::Connection>& connection) override;
+
+  std::shared_ptr<orm::QueryResult> rollback(const provider::ResourceHandle<orm::Connection>& connection) override;
+
+  v_int64 getSchemaVersion(const oatpp::String& suffix = nullptr,
+                           const provider::ResourceHandle<orm::Connection>& connection = nullptr) override;
+
+  /**
+   * Run schema migration script on all shards.
+   */
+  void migrateSchema(const oatpp::String& script,
+                     v_int64 newVersion,
+                     const oatpp::String& suffix = nullptr,
+                     const provider::ResourceHandle<orm::Connection>& connection = nullptr) override;
+
+};
+
+}}
+
+#endif // oatpp_mysql_ShardedExecutor_hpp
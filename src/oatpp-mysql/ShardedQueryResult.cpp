@@ -0,0 +1,291 @@
+#include "ShardedQueryResult.hpp"
+#include "mapping/DecimalCodec.hpp"
+#include "mapping/TimeCodec.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace oatpp { namespace mysql {
+
+ShardedQueryResult::ShardedQueryResult(const std::vector<std::shared_ptr<mysql::QueryResult>>& results,
+                                       const oatpp::String& orderColumn,
+                                       bool descending,
+                                       const StringComparator& stringComparator)
+  : m_results(results)
+  , m_orderColumn(orderColumn)
+  , m_descending(descending)
+  , m_stringComparator(stringComparator)
+  , m_orderChecked(false)
+  , m_collatedOrder(false)
+  , m_position(0)
+{}
+
+bool ShardedQueryResult::isBytewiseCollation(unsigned int collationId) {
+  switch(collationId) {
+    case 63:  // binary
+    case 46:  // utf8mb4_bin
+    case 47:  // latin1_bin
+    case 65:  // ascii_bin
+    case 83:  // utf8mb3_bin
+    case 309: // utf8mb4_0900_bin
+      return true;
+    default:
+      return false;
+  }
+}
+
+// NULL first, then by value. Both binds are of the same column, so they have the same type
+v_int32 ShardedQueryResult::compareValues(const MYSQL_BIND& a, const MYSQL_BIND& b, const StringComparator& stringComparator) {
+
+  bool aNull = *a.is_null;
+  bool bNull = *b.is_null;
+  if(aNull || bNull) {
+    return (v_int32) bNull - (v_int32) aNull;
+  }
+
+  switch(a.buffer_type) {
+
+    case MYSQL_TYPE_TINY:
+      if(a.is_unsigned) {
+        return (v_int32) *(uint8_t*) a.buffer - (v_int32) *(uint8_t*) b.buffer;
+      }
+      return (v_int32) *(int8_t*) a.buffer - (v_int32) *(int8_t*) b.buffer;
+
+    case MYSQL_TYPE_SHORT:
+      if(a.is_unsigned) {
+        return (v_int32) *(uint16_t*) a.buffer - (v_int32) *(uint16_t*) b.buffer;
+      }
+      return (v_int32) *(int16_t*) a.buffer - (v_int32) *(int16_t*) b.buffer;
+
+    case MYSQL_TYPE_LONG: {
+      if(a.is_unsigned) {
+        uint32_t x = *(uint32_t*) a.buffer, y = *(uint32_t*) b.buffer;
+        return (x > y) - (x < y);
+      }
+      int32_t x = *(int32_t*) a.buffer, y = *(int32_t*) b.buffer;
+      return (x > y) - (x < y);
+    }
+
+    case MYSQL_TYPE_LONGLONG: {
+      if(a.is_unsigned) {
+        uint64_t x = *(uint64_t*) a.buffer, y = *(uint64_t*) b.buffer;
+        return (x > y) - (x < y);
+      }
+      int64_t x = *(int64_t*) a.buffer, y = *(int64_t*) b.buffer;
+      return (x > y) - (x < y);
+    }
+
+    case MYSQL_TYPE_FLOAT: {
+      float x = *(float*) a.buffer, y = *(float*) b.buffer;
+      return (x > y) - (x < y);
+    }
+
+    case MYSQL_TYPE_DOUBLE: {
+      double x = *(double*) a.buffer, y = *(double*) b.buffer;
+      return (x > y) - (x < y);
+    }
+
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_TIME: {
+      v_int64 x = mapping::TimeCodec::toEpochMicros(*(const MYSQL_TIME*) a.buffer);
+      v_int64 y = mapping::TimeCodec::toEpochMicros(*(const MYSQL_TIME*) b.buffer);
+      return (x > y) - (x < y);
+    }
+
+    case MYSQL_TYPE_NEWDECIMAL:
+      return mapping::DecimalCodec::compare((const char*) a.buffer, std::min(*a.length, a.buffer_length - 1),
+                                            (const char*) b.buffer, std::min(*b.length, b.buffer_length - 1));
+
+    default: {
+      // binary-safe - BLOB and VARBINARY values may contain zero bytes
+      unsigned long x = std::min(*a.length, a.buffer_length - 1);
+      unsigned long y = std::min(*b.length, b.buffer_length - 1);
+      if(stringComparator) {
+        return stringComparator((const char*) a.buffer, (v_buff_size) x, (const char*) b.buffer, (v_buff_size) y);
+      }
+      int cmp = std::memcmp(a.buffer, b.buffer, std::min(x, y));
+      if(cmp != 0) {
+        return cmp;
+      }
+      return (x > y) - (x < y);
+    }
+
+  }
+
+}
+
+// strings of the non-binary collations can't be merged bytewise - the shards sorted them in the collation order
+void ShardedQueryResult::checkOrderColumn(mapping::ResultMapper::ResultData* data, v_int32 index) {
+
+  m_orderChecked = true;
+
+  MYSQL_RES* meta = data->metaResults ? data->metaResults : data->textResults;
+  if(meta == nullptr) {
+    return;
+  }
+
+  MYSQL_FIELD* field = mysql_fetch_field_direct(meta, (unsigned int) index);
+  switch(field->type) {
+    case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_VAR_STRING:
+    case MYSQL_TYPE_VARCHAR:
+    case MYSQL_TYPE_TINY_BLOB:
+    case MYSQL_TYPE_BLOB:
+    case MYSQL_TYPE_MEDIUM_BLOB:
+    case MYSQL_TYPE_LONG_BLOB:
+      break;
+    default:
+      return;
+  }
+
+  // ENUM and SET are sorted by the member index, not by the text
+  bool members = (field->flags & (ENUM_FLAG | SET_FLAG)) != 0;
+  if(!members && isBytewiseCollation(field->charsetnr)) {
+    return;
+  }
+
+  if(!m_stringComparator) {
+    throw std::runtime_error("[oatpp::mysql::ShardedQueryResult::checkOrderColumn()]: Error. "
+                             "Column '" + m_orderColumn + "' (collation " + std::to_string(field->charsetnr) + ") "
+                             "is not ordered bytewise. Set the string comparator matching the column order "
+                             "or merge by a column of the binary or _bin collation.");
+  }
+
+  m_collatedOrder = true;
+
+}
+
+// shard data to read the next row from. nullptr if all shards are exhausted.
+// Shards count is small - linear scan of the shard heads is cheaper than a heap.
+mapping::ResultMapper::ResultData* ShardedQueryResult::selectNext() {
+
+  mapping::ResultMapper::ResultData* result = nullptr;
+  const MYSQL_BIND* resultValue = nullptr;
+
+  for(auto& shardResult : m_results) {
+
+    auto data = shardResult->getResultData();
+    if(!data->hasMore) {
+      continue;
+    }
+
+    if(!m_orderColumn) {
+      return data;
+    }
+
+    auto it = data->colIndices.find(m_orderColumn);
+    if(it == data->colIndices.end()) {
+      throw std::runtime_error("[oatpp::mysql::ShardedQueryResult::selectNext()]: Error. "
+                               "No column '" + m_orderColumn + "' to merge results by.");
+    }
+
+    if(!m_orderChecked) {
+      checkOrderColumn(data, it->second);
+    }
+
+    const MYSQL_BIND* value = &data->bindResults[it->second];
+    if(result == nullptr) {
+      result = data;
+      resultValue = value;
+    } else {
+      v_int32 cmp = m_collatedOrder ? compareValues(*value, *resultValue, m_stringComparator)
+                                    : compareValues(*value, *resultValue, nullptr);
+      if(m_descending ? cmp > 0 : cmp < 0) {
+        result = data;
+        resultValue = value;
+      }
+    }
+
+  }
+
+  return result;
+
+}
+
+provider::ResourceHandle<orm::Connection> ShardedQueryResult::getConnection() const {
+  return nullptr;
+}
+
+bool ShardedQueryResult::isSuccess() const {
+  for(auto& result : m_results) {
+    if(!result->isSuccess()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+oatpp::String ShardedQueryResult::getErrorMessage() const {
+  for(auto& result : m_results) {
+    if(!result->isSuccess()) {
+      return result->getErrorMessage();
+    }
+  }
+  return nullptr;
+}
+
+v_int64 ShardedQueryResult::getPosition() const {
+  return m_position;
+}
+
+v_int64 ShardedQueryResult::getKnownCount() const {
+  v_int64 count = 0;
+  for(auto& result : m_results) {
+    v_int64 shardCount = result->getKnownCount();
+    if(shardCount < 0) {
+      return -1;
+    }
+    count += shardCount;
+  }
+  return count;
+}
+
+bool ShardedQueryResult::hasMoreToFetch() const {
+  for(auto& result : m_results) {
+    if(result->hasMoreToFetch()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+oatpp::Void ShardedQueryResult::fetch(const oatpp::Type* const type, v_int64 count) {
+
+  if(type->classId.id != data::type::__class::AbstractVector::CLASS_ID.id &&
+     type->classId.id != data::type::__class::AbstractList::CLASS_ID.id &&
+     type->classId.id != data::type::__class::AbstractUnorderedSet::CLASS_ID.id)
+  {
+    throw std::runtime_error("[oatpp::mysql::ShardedQueryResult::fetch()]: Error. "
+                             "Invalid result container type. Allowed types are oatpp::Vector, oatpp::List, oatpp::UnorderedSet");
+  }
+
+  auto dispatcher = static_cast<const data::type::__class::Collection::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  auto collection = dispatcher->createObject();
+
+  const oatpp::Type* itemType = *type->params.begin();
+
+  v_int64 counter = 0;
+  while(count < 0 || counter < count) {
+
+    auto data = selectNext();
+    if(data == nullptr) {
+      break;
+    }
+
+    // all shard results share the executor result mapper
+    dispatcher->addItem(collection, m_results[0]->getResultMapper()->readOneRow(data, itemType));
+    ++data->rowIndex;
+    data->next();
+
+    ++m_position;
+    ++counter;
+
+  }
+
+  return collection;
+
+}
+
+}}
@@ -0,0 +1,108 @@
+#ifndef oatpp_mysql_ShardedQueryResult_hpp
+#define oatpp_mysql_ShardedQueryResult_hpp
+
+#include "QueryResult.hpp"
+
+#include <functional>
+
+namespace oatpp { namespace mysql {
+
+/**
+ * Result of the query executed on several shards. Rows of the shard results are read lazily:
+ *
+ * - concatenation - all rows of the first shard, then all rows of the second shard, etc.
+ * - ordered merge - k-way merge of the shard results sorted by the same column.
+ *   Each shard result must be sorted by this column (`ORDER BY`). Values are compared by the bind buffers,
+ *   before rows are deserialized. `NULL` goes first. <br>
+ *   Binary strings and strings of the `_bin` collations are compared bytewise. Strings of other collations
+ *   (case-insensitive, `utf8mb4_0900_ai_ci`, etc.) and `ENUM`/`SET` columns, sorted by the member index, need
+ *   the &l:ShardedQueryResult::StringComparator; matching the column order - merge without it throws,
+ *   as bytewise order would differ from the order of the shards.
+ */
+class ShardedQueryResult : public orm::QueryResult {
+public:
+
+  /**
+   * Function comparing string values of the merge column in the order of its collation.
+   * Returns negative, zero or positive value as `memcmp` does.
+   */
+  typedef std::function<v_int32(const char* a, v_buff_size aSize, const char* b, v_buff_size bSize)> StringComparator;
+
+public:
+
+  /**
+   * Check if strings of the collation are ordered bytewise - `binary` and `_bin` collations of the common charsets.
+   * @param collationId - collation id. `charsetnr` of the column.
+   * @return
+   */
+  static bool isBytewiseCollation(unsigned int collationId);
+
+  /**
+   * Compare values of the merge column. `NULL` goes first.
+   * @param a
+   * @param b
+   * @param stringComparator - comparator of the string values. `nullptr` - compare strings bytewise.
+   * @return - negative, zero or positive value as `memcmp` does.
+   */
+  static v_int32 compareValues(const MYSQL_BIND& a, const MYSQL_BIND& b, const StringComparator& stringComparator);
+
+private:
+  std::vector<std::shared_ptr<mysql::QueryResult>> m_results;
+  oatpp::String m_orderColumn;
+  bool m_descending;
+  StringComparator m_stringComparator;
+  bool m_orderChecked;
+  bool m_collatedOrder;
+  v_int64 m_position;
+private:
+  void checkOrderColumn(mapping::ResultMapper::ResultData* data, v_int32 index);
+  mapping::ResultMapper::ResultData* selectNext();
+public:
+
+  /**
+   * Constructor.
+   * @param results - results of the shards.
+   * @param orderColumn - column the shard results are sorted by. `nullptr` - concatenate results.
+   * @param descending - shard results are sorted in descending order.
+   * @param stringComparator - &l:ShardedQueryResult::StringComparator; for the merge column of the non-binary collation.
+   */
+  ShardedQueryResult(const std::vector<std::shared_ptr<mysql::QueryResult>>& results,
+                     const oatpp::String& orderColumn = nullptr,
+                     bool descending = false,
+                     const StringComparator& stringComparator = nullptr);
+
+  /**
+   * Results are spread across connections of all shards - no single connection to return.
+   * @return - empty handle.
+   */
+  provider::ResourceHandle<orm::Connection> getConnection() const override;
+
+  /**
+   * Check if query succeeded on all shards.
+   * @return
+   */
+  bool isSuccess() const override;
+
+  /**
+   * Get error message of the first failed shard.
+   * @return
+   */
+  oatpp::String getErrorMessage() const override;
+
+  v_int64 getPosition() const override;
+
+  /**
+   * Sum of the known counts of the shards. `-1` if count of any shard is unknown.
+   * @return
+   */
+  v_int64 getKnownCount() const override;
+
+  bool hasMoreToFetch() const override;
+
+  oatpp::Void fetch(const oatpp::Type* const type, v_int64 count) override;
+
+};
+
+}}
+
+#endif // oatpp_mysql_ShardedQueryResult_hpp
@@ -0,0 +1,35 @@
+#include "Types.hpp"
+
+namespace oatpp { namespace mysql { namespace __class {
+
+const oatpp::data::type::ClassId Timestamp::CLASS_ID("oatpp::mysql::Timestamp");
+
+oatpp::data::type::Type* Timestamp::getType() {
+  static oatpp::data::type::Type type(CLASS_ID);
+  return &type;
+}
+
+const oatpp::data::type::ClassId BlobStream::CLASS_ID("oatpp::mysql::BlobStream");
+
+oatpp::data::type::Type* BlobStream::getType() {
+  static oatpp::data::type::Type type(CLASS_ID);
+  return &type;
+}
+
+const oatpp::data::type::ClassId Decimal::CLASS_ID("oatpp::mysql::Decimal");
+
+oatpp::data::type::Type* Decimal::getType() {
+  static oatpp::data::type::Type type(CLASS_ID);
+  return &type;
+}
+
+const oatpp::data::type::ClassId Uuid::CLASS_ID("oatpp::mysql::Uuid");
+
+oatpp::data::type::Type* Uuid::getType() {
+  static oatpp::data::type::Type type(CLASS_ID);
+  return &type;
+}
+
+const oatpp::data::type::ClassId AbstractEnumSet::CLASS_ID("oatpp::mysql::EnumSet");
+
+}}}
@@ -0,0 +1,172 @@
+#ifndef oatpp_mysql_Types_hpp
+#define oatpp_mysql_Types_hpp
+
+#include "oatpp/data/stream/Stream.hpp"
+#include "oatpp/Types.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace mysql {
+
+namespace __class {
+
+  /**
+   * Timestamp class.
+   */
+  class Timestamp {
+  public:
+    static const oatpp::data::type::ClassId CLASS_ID;
+    static oatpp::data::type::Type* getType();
+  };
+
+  /**
+   * BlobStream class.
+   */
+  class BlobStream {
+  public:
+    static const oatpp::data::type::ClassId CLASS_ID;
+    static oatpp::data::type::Type* getType();
+  };
+
+  /**
+   * Decimal class.
+   */
+  class Decimal {
+  public:
+    static const oatpp::data::type::ClassId CLASS_ID;
+    static oatpp::data::type::Type* getType();
+  };
+
+  /**
+   * Uuid class.
+   */
+  class Uuid {
+  public:
+    static const oatpp::data::type::ClassId CLASS_ID;
+    static oatpp::data::type::Type* getType();
+  };
+
+  /**
+   * Abstract EnumSet class.
+   */
+  class AbstractEnumSet {
+  public:
+    static const oatpp::data::type::ClassId CLASS_ID;
+  };
+
+  /**
+   * EnumSet class. The enum type is the first type param.
+   * @tparam EnumWrapper - &id:oatpp::Enum; interpreted as string.
+   */
+  template<class EnumWrapper>
+  class EnumSet : public AbstractEnumSet {
+  private:
+
+    static oatpp::data::type::Type* createType() {
+      oatpp::data::type::Type::Info info;
+      info.params.push_back(EnumWrapper::Class::getType());
+      return new oatpp::data::type::Type(CLASS_ID, info);
+    }
+
+  public:
+
+    static oatpp::data::type::Type* getType() {
+      static oatpp::data::type::Type* type = createType();
+      return type;
+    }
+
+  };
+
+}
+
+/**
+ * `DATE`, `DATETIME` and `TIMESTAMP` value - microseconds since the Unix epoch. <br>
+ * Values are mapped to/from `MYSQL_TIME` as they are - no time zone conversion is done.
+ * Written as `DATETIME` with microseconds.
+ */
+typedef oatpp::data::type::Primitive<v_int64, __class::Timestamp> Timestamp;
+
+/**
+ * Fixed-point decimal - `unscaled * 10^-scale`.
+ */
+struct DecimalValue {
+
+  /**
+   * Value without the point - `12.50` -> `1250`.
+   */
+  v_int64 unscaled;
+
+  /**
+   * Number of digits after the point - `12.50` -> `2`.
+   */
+  v_int32 scale;
+
+  bool operator==(const DecimalValue& other) const {
+    return unscaled == other.unscaled && scale == other.scale;
+  }
+
+  bool operator!=(const DecimalValue& other) const {
+    return !operator==(other);
+  }
+
+};
+
+/**
+ * `DECIMAL` value as &l:DecimalValue;. Scale is the scale of the column. <br>
+ * Values of more than 18 digits don't fit and fail to deserialize - read them as `String`.
+ */
+typedef oatpp::data::type::Primitive<DecimalValue, __class::Decimal> Decimal;
+
+/**
+ * UUID bytes in the network order - as stored in `BINARY(16)`.
+ */
+struct UuidValue {
+
+  /**
+   * UUID bytes.
+   */
+  v_uint8 bytes[16];
+
+  bool operator==(const UuidValue& other) const {
+    return std::memcmp(bytes, other.bytes, sizeof(bytes)) == 0;
+  }
+
+  bool operator!=(const UuidValue& other) const {
+    return !operator==(other);
+  }
+
+};
+
+/**
+ * UUID stored as `BINARY(16)` - &l:UuidValue;. Written as 16 raw bytes. <br>
+ * `CHAR(36)` and `CHAR(32)` text values are parsed as well.
+ * See &id:oatpp::mysql::mapping::UuidCodec; for the text form and UUID version 7 generation.
+ */
+typedef oatpp::data::type::Primitive<UuidValue, __class::Uuid> Uuid;
+
+/**
+ * `SET` value as the bit mask - bit `i` is the entry `i` of the enum in the order of declaration. <br>
+ * Entry names are the names of the `SET` members. Up to 64 entries.
+ * ```
+ * ENUM(Permission, v_int32, VALUE(READ, 0, "read"), VALUE(WRITE, 1, "write"))
+ * ...
+ * DTO_FIELD(oatpp::mysql::EnumSet<oatpp::Enum<Permission>::AsString>, permissions);
+ * ```
+ * Integer values (`permissions+0`) are read as the mask as is. Members should be declared in the same order as the enum entries.
+ * @tparam EnumWrapper - &id:oatpp::Enum; interpreted as string.
+ */
+template<class EnumWrapper>
+using EnumSet = oatpp::data::type::Primitive<v_uint64, __class::EnumSet<EnumWrapper>>;
+
+/**
+ * `BLOB` parameter read from the input stream. <br>
+ * The stream is uploaded in chunks with `mysql_stmt_send_long_data()` right before the statement is executed,
+ * so the value is never buffered as a whole. The stream is read till the end. <br>
+ * Not supported by the text protocol (&id:oatpp::mysql::NonBlockingEngine;). <br>
+ * `BLOB` values are read as `oatpp::String` - it's binary-safe.
+ */
+typedef oatpp::data::type::ObjectWrapper<oatpp::data::stream::InputStream, __class::BlobStream> BlobStream;
+
+}}
+
+#endif // oatpp_mysql_Types_hpp
@@ -7,4 +7,12 @@ v_int64 Utils::getLastInsertRowId(const provider::ResourceHandle<orm::Connection
   return mysql_insert_id(c->getHandle());
 }
 
+my_socket Utils::getSocket(MYSQL* handle) {
+#if defined(MARIADB_BASE_VERSION) || defined(MARIADB_PACKAGE_VERSION_ID)
+  return mysql_get_socket(handle);
+#else
+  return handle->net.fd;
+#endif
+}
+
 }}
@@ -19,6 +19,14 @@ public:
    */
   static v_int64 getLastInsertRowId(const provider::ResourceHandle<orm::Connection>& connection);
 
+  /**
+   * Get socket descriptor of the connected handle. <br>
+   * MariaDB Connector/C - `mysql_get_socket()`. libmysqlclient has no getter - `NET::fd` of the public `MYSQL` struct is used.
+   * @param handle - connected handle.
+   * @return - socket descriptor.
+   */
+  static my_socket getSocket(MYSQL* handle);
+
 };
 
 }}
@@ -0,0 +1,191 @@
+#include "WorkerPool.hpp"
+
+#include <future>
+
+namespace oatpp { namespace mysql {
+
+constexpr v_int64 WorkerPool::RETRY_INTERVAL_MICRO;
+
+namespace {
+
+// task of runAll() - run once, by a worker or by the calling thread, whichever takes it first
+struct Job {
+
+  Job(const WorkerPool::Task& pTask)
+    : task(pTask)
+    , taken(false)
+    , done(promise.get_future())
+  {}
+
+  void run() {
+    if(taken.exchange(true)) {
+      return;
+    }
+    try {
+      task();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    promise.set_value();
+  }
+
+  WorkerPool::Task task;
+  std::atomic<bool> taken;
+  std::promise<void> promise;
+  std::future<void> done;
+  std::exception_ptr error;
+
+};
+
+}
+
+WorkerPool::WorkerPool(v_int32 threadsCount, v_int64 maxQueueSize)
+  : m_threadsCount(threadsCount > 0 ? threadsCount : 1)
+  , m_maxQueueSize(maxQueueSize > 0 ? maxQueueSize : 1)
+  , m_running(true)
+{}
+
+WorkerPool::~WorkerPool() {
+  stop();
+}
+
+void WorkerPool::startThreads() {
+  for(v_int32 i = 0; i < m_threadsCount; i ++) {
+    m_threads.push_back(std::thread(&WorkerPool::run, this));
+  }
+}
+
+void WorkerPool::run() {
+
+  while(true) {
+
+    Task task;
+
+    {
+      std::unique_lock<std::mutex> guard(m_lock);
+      while(m_running && m_queue.empty()) {
+        m_hasTasks.wait(guard);
+      }
+      if(m_queue.empty()) {
+        return;
+      }
+      task = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+
+    m_hasRoom.notify_one();
+    task();
+
+  }
+
+}
+
+bool WorkerPool::tryPost(const Task& task) {
+
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    if(!m_running) {
+      throw std::runtime_error("[oatpp::mysql::WorkerPool::tryPost()]: Error. Pool is stopped.");
+    }
+
+    if((v_int64) m_queue.size() >= m_maxQueueSize) {
+      return false;
+    }
+
+    if(m_threads.empty()) {
+      startThreads();
+    }
+
+    m_queue.push_back(task);
+  }
+
+  m_hasTasks.notify_one();
+  return true;
+
+}
+
+void WorkerPool::post(const Task& task) {
+
+  {
+    std::unique_lock<std::mutex> guard(m_lock);
+
+    while(m_running && (v_int64) m_queue.size() >= m_maxQueueSize) {
+      m_hasRoom.wait(guard);
+    }
+
+    if(!m_running) {
+      throw std::runtime_error("[oatpp::mysql::WorkerPool::post()]: Error. Pool is stopped.");
+    }
+
+    if(m_threads.empty()) {
+      startThreads();
+    }
+
+    m_queue.push_back(task);
+  }
+
+  m_hasTasks.notify_one();
+
+}
+
+void WorkerPool::runAll(const std::vector<Task>& tasks) {
+
+  std::vector<std::shared_ptr<Job>> jobs;
+  jobs.reserve(tasks.size());
+  for(auto& task : tasks) {
+    jobs.push_back(std::make_shared<Job>(task));
+  }
+
+  // the first task is run by the calling thread. Tasks which don't fit the queue are left to the calling thread too
+  for(size_t i = 1; i < jobs.size(); i ++) {
+    auto job = jobs[i];
+    tryPost([job]() {
+      job->run();
+    });
+  }
+
+  // workers may all be busy - with callers of runAll() themselves
+  for(auto& job : jobs) {
+    job->run();
+  }
+
+  // wait for all tasks before rethrowing - tasks must not outlive the call
+  std::exception_ptr error;
+  for(auto& job : jobs) {
+    job->done.wait();
+    if(!error && job->error) {
+      error = job->error;
+    }
+  }
+
+  if(error) {
+    std::rethrow_exception(error);
+  }
+
+}
+
+void WorkerPool::stop() {
+
+  std::vector<std::thread> threads;
+
+  {
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_running = false;
+    threads.swap(m_threads);
+  }
+
+  m_hasTasks.notify_all();
+  m_hasRoom.notify_all();
+
+  for(auto& thread : threads) {
+    if(thread.get_id() == std::this_thread::get_id()) {
+      thread.detach();
+    } else {
+      thread.join();
+    }
+  }
+
+}
+
+}}
@@ -0,0 +1,182 @@
+#ifndef oatpp_mysql_WorkerPool_hpp
+#define oatpp_mysql_WorkerPool_hpp
+
+#include "oatpp/async/Coroutine.hpp"
+#include "oatpp/async/CoroutineWaitList.hpp"
+#include "oatpp/Environment.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace oatpp { namespace mysql {
+
+/**
+ * Bounded pool of threads running blocking mysql client calls. <br>
+ * Used to keep the async API off the event-loop threads - coroutine waits on the wait-list
+ * while the blocking call runs on the worker thread, and it is resumed once the call is done.
+ */
+class WorkerPool {
+public:
+
+  /**
+   * Task to run on the worker thread.
+   */
+  typedef std::function<void()> Task;
+
+private:
+
+  /*
+   * Result of the task shared between the worker thread and the waiting coroutine.
+   * Listener re-notifies the wait-list if the task completed before the coroutine was put to the list.
+   */
+  template<typename T>
+  struct TaskState : public async::CoroutineWaitList::Listener {
+
+    TaskState()
+      : done(false)
+    {
+      waitList.setListener(this);
+    }
+
+    void onNewItem(async::CoroutineWaitList& list) override {
+      if(done) {
+        list.notifyAll();
+      }
+    }
+
+    std::atomic<bool> done;
+    T result;
+    std::exception_ptr error;
+    async::CoroutineWaitList waitList;
+
+  };
+
+  template<typename T>
+  class TaskCoroutine : public async::CoroutineWithResult<TaskCoroutine<T>, const T&> {
+  private:
+    WorkerPool* m_pool;
+    std::function<T()> m_task;
+    std::shared_ptr<TaskState<T>> m_state;
+  public:
+
+    TaskCoroutine(WorkerPool* pool, const std::function<T()>& task)
+      : m_pool(pool)
+      , m_task(task)
+      , m_state(std::make_shared<TaskState<T>>())
+    {}
+
+    async::Action act() override {
+
+      auto state = m_state;
+      auto task = m_task;
+
+      bool posted = m_pool->tryPost([state, task]() {
+        try {
+          state->result = task();
+        } catch (...) {
+          state->error = std::current_exception();
+        }
+        state->done = true;
+        state->waitList.notifyAll();
+      });
+
+      if(!posted) {
+        // queue is full - retry later without blocking the event-loop thread
+        return async::Action::createWaitRepeatAction(oatpp::Environment::getMicroTickCount() + RETRY_INTERVAL_MICRO);
+      }
+
+      return this->yieldTo(&TaskCoroutine::waitDone);
+
+    }
+
+    async::Action waitDone() {
+      if(!m_state->done) {
+        return async::Action::createWaitListAction(&m_state->waitList);
+      }
+      if(m_state->error) {
+        std::rethrow_exception(m_state->error);
+      }
+      return this->_return(m_state->result);
+    }
+
+  };
+
+private:
+  static constexpr v_int64 RETRY_INTERVAL_MICRO = 1000;
+private:
+  v_int32 m_threadsCount;
+  v_int64 m_maxQueueSize;
+  bool m_running;
+  std::mutex m_lock;
+  std::condition_variable m_hasTasks;
+  std::condition_variable m_hasRoom;
+  std::deque<Task> m_queue;
+  std::vector<std::thread> m_threads;
+private:
+  void run();
+  void startThreads();
+public:
+
+  /**
+   * Constructor. Threads are started lazily on the first task.
+   * @param threadsCount - max number of blocking calls running at the same time.
+   * @param maxQueueSize - max number of tasks waiting for a free thread.
+   */
+  WorkerPool(v_int32 threadsCount = 4, v_int64 maxQueueSize = 1024);
+
+  /**
+   * Non-virtual destructor. Calls &l:WorkerPool::stop ();.
+   */
+  ~WorkerPool();
+
+  /**
+   * Put task to the queue if there is room for it.
+   * @param task - &l:WorkerPool::Task;.
+   * @return - `true` if task was queued, `false` if the queue is full.
+   */
+  bool tryPost(const Task& task);
+
+  /**
+   * Put task to the queue. Blocks while the queue is full.
+   * @param task - &l:WorkerPool::Task;.
+   */
+  void post(const Task& task);
+
+  /**
+   * Run tasks in parallel and wait for all of them. <br>
+   * Tasks are queued with &l:WorkerPool::tryPost ();, the calling thread runs the first task and then every task
+   * no worker has taken yet. So the call never blocks on a full queue and doesn't deadlock
+   * when made from a worker thread of the saturated pool. <br>
+   * Exception of the first failed task is rethrown after all tasks are done.
+   * @param tasks - tasks to run.
+   */
+  void runAll(const std::vector<Task>& tasks);
+
+  /**
+   * Run blocking function on the worker thread and resume the calling coroutine with its result. <br>
+   * Exception thrown by the function is rethrown in the calling coroutine.
+   * @tparam T - result type.
+   * @param task - function to run.
+   * @return - &id:oatpp::async::CoroutineStarterForResult;.
+   */
+  template<typename T>
+  async::CoroutineStarterForResult<const T&> execute(const std::function<T()>& task) {
+    return TaskCoroutine<T>::startForResult(this, task);
+  }
+
+  /**
+   * Stop the pool. Tasks already queued are executed before threads exit.
+   */
+  void stop();
+
+};
+
+}}
+
+#endif // oatpp_mysql_WorkerPool_hpp
@@ -0,0 +1,179 @@
+#include "ColumnarResult.hpp"
+#include "TimeCodec.hpp"
+
+#include <algorithm>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+ColumnarResult::ColumnarResult()
+  : m_rowsCount(0)
+{}
+
+void ColumnarResult::initColumns(const ResultMapper::ResultData* dbData) {
+
+  m_columns.resize(dbData->colCount);
+
+  for(v_int32 i = 0; i < dbData->colCount; i ++) {
+
+    Column& column = m_columns[i];
+    column.name = dbData->colNames[i];
+
+    switch(dbData->bindResults[i].buffer_type) {
+      case MYSQL_TYPE_TINY:
+      case MYSQL_TYPE_SHORT:
+      case MYSQL_TYPE_LONG:
+      case MYSQL_TYPE_LONGLONG:
+      case MYSQL_TYPE_DATE:
+      case MYSQL_TYPE_DATETIME:
+      case MYSQL_TYPE_TIMESTAMP:
+      case MYSQL_TYPE_TIME:
+        column.type = ColumnType::INT64;
+        break;
+      case MYSQL_TYPE_FLOAT:
+      case MYSQL_TYPE_DOUBLE:
+        column.type = ColumnType::DOUBLE;
+        break;
+      default:
+        column.type = ColumnType::STRING;
+        column.offsets.push_back(0);
+    }
+
+  }
+
+}
+
+void ColumnarResult::readRow(const ResultMapper::ResultData* dbData) {
+
+  bool newNullsByte = (m_rowsCount & 7) == 0;
+  v_uint8 nullBit = (v_uint8) (1 << (m_rowsCount & 7));
+
+  for(v_int32 i = 0; i < dbData->colCount; i ++) {
+
+    const MYSQL_BIND& bind = dbData->bindResults[i];
+    Column& column = m_columns[i];
+
+    bool isNull = (*bind.is_null == 1);
+    if(newNullsByte) {
+      column.nulls.push_back(0);
+    }
+    if(isNull) {
+      column.nulls.back() |= nullBit;
+    }
+
+    switch(column.type) {
+
+      case ColumnType::INT64: {
+        int64_t value = 0;
+        if(!isNull) {
+          switch(bind.buffer_type) {
+            case MYSQL_TYPE_TINY:
+              value = bind.is_unsigned ? (int64_t) *static_cast<uint8_t*>(bind.buffer) : *static_cast<int8_t*>(bind.buffer);
+              break;
+            case MYSQL_TYPE_SHORT:
+              value = bind.is_unsigned ? (int64_t) *static_cast<uint16_t*>(bind.buffer) : *static_cast<int16_t*>(bind.buffer);
+              break;
+            case MYSQL_TYPE_LONG:
+              value = bind.is_unsigned ? (int64_t) *static_cast<uint32_t*>(bind.buffer) : *static_cast<int32_t*>(bind.buffer);
+              break;
+            case MYSQL_TYPE_DATE:
+            case MYSQL_TYPE_DATETIME:
+            case MYSQL_TYPE_TIMESTAMP:
+            case MYSQL_TYPE_TIME:
+              value = TimeCodec::toEpochMicros(*static_cast<const MYSQL_TIME*>(bind.buffer));
+              break;
+            default:
+              value = *static_cast<int64_t*>(bind.buffer);
+          }
+        }
+        column.int64s.push_back(value);
+        break;
+      }
+
+      case ColumnType::DOUBLE: {
+        double value = 0;
+        if(!isNull) {
+          if(bind.buffer_type == MYSQL_TYPE_FLOAT) {
+            value = *static_cast<float*>(bind.buffer);
+          } else {
+            value = *static_cast<double*>(bind.buffer);
+          }
+        }
+        column.doubles.push_back(value);
+        break;
+      }
+
+      case ColumnType::STRING: {
+        if(!isNull) {
+          auto size = std::min(*bind.length, bind.buffer_length - 1);
+          auto data = static_cast<const char*>(bind.buffer);
+          column.arena.insert(column.arena.end(), data, data + size);
+        }
+        column.offsets.push_back(column.arena.size());
+        break;
+      }
+
+    }
+
+  }
+
+  m_rowsCount ++;
+
+}
+
+v_int64 ColumnarResult::read(ResultMapper::ResultData* dbData, v_int64 count) {
+
+  if(m_columns.empty()) {
+    initColumns(dbData);
+  } else if((v_int64) m_columns.size() != dbData->colCount) {
+    throw std::runtime_error("[oatpp::mysql::mapping::ColumnarResult::read()]: Error. "
+                             "Result columns don't match columns of the previous read.");
+  }
+
+  v_int64 rowsRead = 0;
+
+  while(dbData->hasMore && (count < 0 || rowsRead < count)) {
+    readRow(dbData);
+    ++ dbData->rowIndex;
+    ++ rowsRead;
+    dbData->next();
+  }
+
+  return rowsRead;
+
+}
+
+void ColumnarResult::clear() {
+  for(auto& column : m_columns) {
+    column.int64s.clear();
+    column.doubles.clear();
+    column.arena.clear();
+    column.nulls.clear();
+    if(column.type == ColumnType::STRING) {
+      column.offsets.resize(1);
+    }
+  }
+  m_rowsCount = 0;
+}
+
+v_int64 ColumnarResult::getRowsCount() const {
+  return m_rowsCount;
+}
+
+const std::vector<ColumnarResult::Column>& ColumnarResult::getColumns() const {
+  return m_columns;
+}
+
+const ColumnarResult::Column& ColumnarResult::getColumn(v_int32 index) const {
+  return m_columns.at(index);
+}
+
+const ColumnarResult::Column& ColumnarResult::getColumn(const oatpp::String& name) const {
+  for(auto& column : m_columns) {
+    if(column.name == name) {
+      return column;
+    }
+  }
+  throw std::runtime_error("[oatpp::mysql::mapping::ColumnarResult::getColumn()]: Error. No column '" + *name + "'.");
+}
+
+}}}
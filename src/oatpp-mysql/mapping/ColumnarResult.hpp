@@ -0,0 +1,170 @@
+#ifndef oatpp_mysql_mapping_ColumnarResult_hpp
+#define oatpp_mysql_mapping_ColumnarResult_hpp
+
+#include "ResultMapper.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+/**
+ * Rows stored column by column in contiguous typed buffers. <br>
+ * Integer columns are stored as `int64_t`, floating point columns as `double`,
+ * and everything else as strings packed into one arena per column. <br>
+ * Values are copied straight from the result bind buffers - no oatpp objects are created.
+ * Buffers keep their capacity on &l:ColumnarResult::clear ();, so the same instance can be reused for batches.
+ */
+class ColumnarResult {
+public:
+
+  /**
+   * Storage type of the column.
+   */
+  enum class ColumnType : v_int32 {
+
+    /**
+     * `TINYINT`, `SMALLINT`, `INT`, `BIGINT` - stored in &l:ColumnarResult::Column::int64s;.
+     * `BIGINT UNSIGNED` is stored bit-for-bit. <br>
+     * `DATE`, `DATETIME`, `TIMESTAMP` - microseconds since the Unix epoch, `TIME` - microseconds.
+     */
+    INT64 = 0,
+
+    /**
+     * `FLOAT`, `DOUBLE` - stored in &l:ColumnarResult::Column::doubles;.
+     */
+    DOUBLE = 1,
+
+    /**
+     * Other types - stored in &l:ColumnarResult::Column::arena;.
+     */
+    STRING = 2
+
+  };
+
+  /**
+   * Values of one column.
+   */
+  struct Column {
+
+    /**
+     * Column name.
+     */
+    oatpp::String name;
+
+    /**
+     * &l:ColumnarResult::ColumnType;.
+     */
+    ColumnType type;
+
+    /**
+     * Values of the &l:ColumnarResult::ColumnType::INT64; column. Null values are `0`.
+     */
+    std::vector<int64_t> int64s;
+
+    /**
+     * Values of the &l:ColumnarResult::ColumnType::DOUBLE; column. Null values are `0`.
+     */
+    std::vector<double> doubles;
+
+    /**
+     * Values of the &l:ColumnarResult::ColumnType::STRING; column, one after another without separators.
+     */
+    std::vector<char> arena;
+
+    /**
+     * Start of each string in the arena, plus the end of the last one - `rowsCount + 1` entries.
+     */
+    std::vector<v_buff_size> offsets;
+
+    /**
+     * Null bitmap - bit `row % 8` of byte `row / 8` is set if the value is null.
+     */
+    std::vector<v_uint8> nulls;
+
+    /**
+     * Check if value is null.
+     * @param row - row index.
+     * @return
+     */
+    bool isNull(v_int64 row) const {
+      return (nulls[row >> 3] & (1 << (row & 7))) != 0;
+    }
+
+    /**
+     * Pointer to the string value in the arena. Not null-terminated.
+     * @param row - row index.
+     * @return
+     */
+    const char* getStringData(v_int64 row) const {
+      return arena.data() + offsets[row];
+    }
+
+    /**
+     * Size of the string value.
+     * @param row - row index.
+     * @return
+     */
+    v_buff_size getStringSize(v_int64 row) const {
+      return offsets[row + 1] - offsets[row];
+    }
+
+  };
+
+private:
+  std::vector<Column> m_columns;
+  v_int64 m_rowsCount;
+private:
+  void initColumns(const ResultMapper::ResultData* dbData);
+  void readRow(const ResultMapper::ResultData* dbData);
+public:
+
+  /**
+   * Default constructor.
+   */
+  ColumnarResult();
+
+  /**
+   * Read `count` of rows and append them to columns. <br>
+   * Columns are created on the first read. Result with different columns can't be appended.
+   * @param dbData - result positioned at the first row to read.
+   * @param count - how many rows to read. `-1` - read all remaining rows.
+   * @return - number of rows read.
+   */
+  v_int64 read(ResultMapper::ResultData* dbData, v_int64 count);
+
+  /**
+   * Remove all rows. Column buffers keep allocated memory.
+   */
+  void clear();
+
+  /**
+   * Get number of rows.
+   * @return
+   */
+  v_int64 getRowsCount() const;
+
+  /**
+   * Get columns.
+   * @return
+   */
+  const std::vector<Column>& getColumns() const;
+
+  /**
+   * Get column by index.
+   * @param index
+   * @return
+   */
+  const Column& getColumn(v_int32 index) const;
+
+  /**
+   * Get column by name.
+   * @param name
+   * @return
+   */
+  const Column& getColumn(const oatpp::String& name) const;
+
+};
+
+}}}
+
+#endif // oatpp_mysql_mapping_ColumnarResult_hpp
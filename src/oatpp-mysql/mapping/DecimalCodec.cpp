@@ -0,0 +1,174 @@
+#include "DecimalCodec.hpp"
+
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+constexpr v_int32 DecimalCodec::MAX_DIGITS;
+constexpr v_int32 DecimalCodec::MAX_SCALE;
+constexpr v_buff_size DecimalCodec::MAX_TEXT_SIZE;
+
+namespace {
+
+// powers of ten exactly representable as double
+const v_float64 POW10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+  1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+constexpr v_int32 MAX_EXACT_POW10 = 22;
+
+// max integer exactly representable as double - 2^53
+constexpr v_uint64 MAX_EXACT_MANTISSA = 9007199254740992ULL;
+
+}
+
+bool DecimalCodec::parse(const char* text, v_buff_size size, v_int64& unscaled, v_int32& scale) {
+
+  const char* p = text;
+  const char* end = text + size;
+
+  bool negative = false;
+  if(p < end && (*p == '-' || *p == '+')) {
+    negative = (*p == '-');
+    ++ p;
+  }
+
+  v_uint64 value = 0;
+  v_int32 fraction = -1;
+  bool hasDigits = false;
+
+  for(; p < end; ++ p) {
+    char c = *p;
+    if(c >= '0' && c <= '9') {
+      v_uint64 d = (v_uint64) (c - '0');
+      // checked before the multiplication - the wrapped value would pass the check after it
+      if(value > ((v_uint64) std::numeric_limits<v_int64>::max() - d) / 10) {
+        return false;
+      }
+      value = value * 10 + d;
+      hasDigits = true;
+      if(fraction >= 0) {
+        ++ fraction;
+      }
+    } else if(c == '.' && fraction < 0) {
+      fraction = 0;
+    } else {
+      return false;
+    }
+  }
+
+  // the formatted value must fit MAX_TEXT_SIZE - scale is checked here, not in every format() call
+  if(!hasDigits || fraction > MAX_SCALE) {
+    return false;
+  }
+
+  unscaled = negative ? -(v_int64) value : (v_int64) value;
+  scale = fraction > 0 ? fraction : 0;
+  return true;
+
+}
+
+v_float64 DecimalCodec::toFloat64(const char* text, v_buff_size size) {
+
+  const char* p = text;
+  const char* end = text + size;
+
+  bool negative = false;
+  if(p < end && (*p == '-' || *p == '+')) {
+    negative = (*p == '-');
+    ++ p;
+  }
+
+  v_uint64 mantissa = 0;
+  v_int32 scale = -1;
+  bool fast = p < end;
+
+  for(; p < end && fast; ++ p) {
+    char c = *p;
+    if(c >= '0' && c <= '9') {
+      mantissa = mantissa * 10 + (c - '0');
+      fast = mantissa <= MAX_EXACT_MANTISSA;
+      if(scale >= 0) {
+        ++ scale;
+      }
+    } else if(c == '.' && scale < 0) {
+      scale = 0;
+    } else {
+      fast = false;
+    }
+  }
+
+  if(fast && scale <= MAX_EXACT_POW10) {
+    // both operands are exact - one IEEE division gives the correctly rounded result
+    v_float64 result = scale > 0 ? (v_float64) mantissa / POW10[scale] : (v_float64) mantissa;
+    return negative ? -result : result;
+  }
+
+  // text in the bind buffers is not always null-terminated at size
+  std::string copy(text, size);
+  return std::strtod(copy.c_str(), nullptr);
+
+}
+
+v_float64 DecimalCodec::toFloat64(v_int64 unscaled, v_int32 scale) {
+  v_uint64 magnitude = unscaled < 0 ? 0 - (v_uint64) unscaled : (v_uint64) unscaled;
+  if(magnitude <= MAX_EXACT_MANTISSA && scale >= 0 && scale <= MAX_EXACT_POW10) {
+    v_float64 result = (v_float64) magnitude / POW10[scale];
+    return unscaled < 0 ? -result : result;
+  }
+  char buffer[MAX_TEXT_SIZE];
+  auto size = format(unscaled, scale, buffer);
+  return toFloat64(buffer, size);
+}
+
+v_buff_size DecimalCodec::format(v_int64 unscaled, v_int32 scale, char* buffer) {
+
+  char digits[MAX_SCALE + 1];
+  v_int32 count = 0;
+
+  v_uint64 magnitude = unscaled < 0 ? 0 - (v_uint64) unscaled : (v_uint64) unscaled;
+  do {
+    digits[count ++] = (char) ('0' + magnitude % 10);
+    magnitude /= 10;
+  } while(magnitude > 0);
+
+  // at least one digit before the point
+  while(count <= scale) {
+    digits[count ++] = '0';
+  }
+
+  v_buff_size size = 0;
+  if(unscaled < 0) {
+    buffer[size ++] = '-';
+  }
+  for(v_int32 i = count - 1; i >= 0; i --) {
+    buffer[size ++] = digits[i];
+    if(i == scale && scale > 0) {
+      buffer[size ++] = '.';
+    }
+  }
+  buffer[size] = 0;
+
+  return size;
+
+}
+
+v_int32 DecimalCodec::compare(const char* a, v_buff_size aSize, const char* b, v_buff_size bSize) {
+
+  v_int64 x, y;
+  v_int32 xScale, yScale;
+
+  if(parse(a, aSize, x, xScale) && parse(b, bSize, y, yScale) && xScale == yScale) {
+    return (x > y) - (x < y);
+  }
+
+  v_float64 fx = toFloat64(a, aSize);
+  v_float64 fy = toFloat64(b, bSize);
+  return (fx > fy) - (fx < fy);
+
+}
+
+}}}
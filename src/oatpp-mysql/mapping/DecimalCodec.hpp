@@ -0,0 +1,83 @@
+#ifndef oatpp_mysql_mapping_DecimalCodec_hpp
+#define oatpp_mysql_mapping_DecimalCodec_hpp
+
+#include "oatpp/Environment.hpp"
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+/**
+ * Conversions of `DECIMAL` text - `[-]digits[.digits]`, as sent by the server. <br>
+ * The server always writes `MYSQL_FIELD::decimals` digits after the point, so the scale of the text
+ * is the scale of the column.
+ */
+class DecimalCodec {
+public:
+
+  /**
+   * Max number of digits which fit the scaled int64.
+   */
+  static constexpr v_int32 MAX_DIGITS = 18;
+
+  /**
+   * Max scale - max scale of the `DECIMAL` column. Small values of such columns fit int64 - `0.000...01`.
+   */
+  static constexpr v_int32 MAX_SCALE = 30;
+
+  /**
+   * Max size of the formatted value - sign, &l:DecimalCodec::MAX_SCALE; + 1 digits, point and terminating zero.
+   */
+  static constexpr v_buff_size MAX_TEXT_SIZE = 40;
+
+public:
+
+  /**
+   * Parse decimal text to the scaled integer - `"-12.50"` -> `unscaled = -1250, scale = 2`.
+   * @param text
+   * @param size
+   * @param unscaled - out.
+   * @param scale - out. Number of digits after the point - `[0..MAX_SCALE]`.
+   * @return - `false` if text is not a decimal, doesn't fit int64 or has more than &l:DecimalCodec::MAX_SCALE; digits after the point.
+   */
+  static bool parse(const char* text, v_buff_size size, v_int64& unscaled, v_int32& scale);
+
+  /**
+   * Convert decimal text to double. Values of up to 15 significant digits are converted
+   * with one exact division, others with `strtod`. Result is correctly rounded in both cases.
+   * @param text
+   * @param size
+   * @return
+   */
+  static v_float64 toFloat64(const char* text, v_buff_size size);
+
+  /**
+   * Convert scaled integer to double.
+   * @param unscaled
+   * @param scale
+   * @return
+   */
+  static v_float64 toFloat64(v_int64 unscaled, v_int32 scale);
+
+  /**
+   * Format scaled integer as decimal text - `unscaled = -1250, scale = 2` -> `"-12.50"`.
+   * @param unscaled
+   * @param scale - `[0..MAX_SCALE]`.
+   * @param buffer - buffer of at least &l:DecimalCodec::MAX_TEXT_SIZE; bytes.
+   * @return - size of the text.
+   */
+  static v_buff_size format(v_int64 unscaled, v_int32 scale, char* buffer);
+
+  /**
+   * Compare values of the same column.
+   * @param a
+   * @param aSize
+   * @param b
+   * @param bSize
+   * @return - negative, zero or positive.
+   */
+  static v_int32 compare(const char* a, v_buff_size aSize, const char* b, v_buff_size bSize);
+
+};
+
+}}}
+
+#endif // oatpp_mysql_mapping_DecimalCodec_hpp
@@ -0,0 +1,74 @@
+#include "DecodePlan.hpp"
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+DecodePlan::DecodePlan(const Deserializer* deserializer,
+                       const std::vector<oatpp::String>& colNames,
+                       const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+                       const Type* objectType)
+  : m_deserializer(deserializer)
+  , m_dispatcher(static_cast<const data::type::__class::AbstractObject::PolymorphicDispatcher*>(objectType->polymorphicDispatcher))
+  , m_typeResolver(typeResolver)
+{
+
+  if(objectType->classId.id != data::type::__class::AbstractObject::CLASS_ID.id) {
+    throw std::runtime_error("[oatpp::mysql::mapping::DecodePlan::DecodePlan()]: Error. "
+                             "Type '" + std::string(objectType->classId.name) + "' is not an oatpp::Object.");
+  }
+
+  const auto& fieldsMap = m_dispatcher->getProperties()->getMap();
+
+  for(v_int32 i = 0; i < (v_int32) colNames.size(); i ++) {
+
+    auto it = fieldsMap.find(*colNames[i]);
+    if(it == fieldsMap.end()) {
+      throw std::runtime_error("[oatpp::mysql::mapping::DecodePlan::DecodePlan()]: Error. "
+                               "The object of type " + std::string(objectType->nameQualifier) +
+                               " has no field to map column " + *colNames[i] + ".");
+    }
+
+    Step step;
+    step.column = i;
+    step.property = it->second;
+    step.type = it->second->type;
+    step.method = m_deserializer->getMethod(step.type);
+
+    if(step.property->info.typeSelector && step.type == oatpp::Any::Class::getType()) {
+      // type is known per object only - decoded after other fields are set
+      m_polymorphs.push_back(step);
+    } else {
+      m_steps.push_back(step);
+    }
+
+  }
+
+}
+
+oatpp::Void DecodePlan::decodeValue(const Step& step, MYSQL_BIND* bind, const Type* type) const {
+  Deserializer::InData inData(bind, m_typeResolver);
+  if(step.method && type == step.type) {
+    return (*step.method)(m_deserializer, inData, type);
+  }
+  return m_deserializer->deserialize(inData, type);
+}
+
+oatpp::Void DecodePlan::decode(std::vector<MYSQL_BIND>& binds) const {
+
+  auto object = m_dispatcher->createObject();
+  auto base = static_cast<oatpp::BaseObject*>(object.get());
+
+  for(auto& step : m_steps) {
+    step.property->set(base, decodeValue(step, &binds[step.column], step.type));
+  }
+
+  for(auto& step : m_polymorphs) {
+    auto selectedType = step.property->info.typeSelector->selectType(base);
+    oatpp::Any any(decodeValue(step, &binds[step.column], selectedType));
+    step.property->set(base, oatpp::Void(any.getPtr(), step.property->type));
+  }
+
+  return object;
+
+}
+
+}}}
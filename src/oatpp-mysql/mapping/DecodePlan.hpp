@@ -0,0 +1,62 @@
+#ifndef oatpp_mysql_mapping_DecodePlan_hpp
+#define oatpp_mysql_mapping_DecodePlan_hpp
+
+#include "Deserializer.hpp"
+
+#include "oatpp/Types.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+/**
+ * Row decoder for the DTO type bound to the columns of one result. <br>
+ * Column-to-field lookup, field types, and deserializer methods are resolved once when the plan is created.
+ * Per row the plan only creates the object and runs a fixed sequence of `column -> method -> field` steps.
+ */
+class DecodePlan {
+public:
+  typedef oatpp::data::type::Type Type;
+private:
+
+  struct Step {
+    v_int32 column;
+    oatpp::BaseObject::Property* property;
+    const Type* type;
+    Deserializer::DeserializerMethod method;
+  };
+
+private:
+  const Deserializer* m_deserializer;
+  const data::type::__class::AbstractObject::PolymorphicDispatcher* m_dispatcher;
+  std::shared_ptr<const data::mapping::TypeResolver> m_typeResolver;
+  std::vector<Step> m_steps;
+  std::vector<Step> m_polymorphs;
+private:
+  oatpp::Void decodeValue(const Step& step, MYSQL_BIND* bind, const Type* type) const;
+public:
+
+  /**
+   * Constructor. Bind DTO fields to the columns.
+   * @param deserializer - &id:oatpp::mysql::mapping::Deserializer;.
+   * @param colNames - names of the result columns.
+   * @param typeResolver - &id:oatpp::data::mapping::TypeResolver;.
+   * @param objectType - DTO type - &id:oatpp::Object;.
+   */
+  DecodePlan(const Deserializer* deserializer,
+             const std::vector<oatpp::String>& colNames,
+             const std::shared_ptr<const data::mapping::TypeResolver>& typeResolver,
+             const Type* objectType);
+
+  /**
+   * Decode row from the bind buffers.
+   * @param binds - binds of the result columns holding the current row.
+   * @return - DTO object.
+   */
+  oatpp::Void decode(std::vector<MYSQL_BIND>& binds) const;
+
+};
+
+}}}
+
+#endif // oatpp_mysql_mapping_DecodePlan_hpp
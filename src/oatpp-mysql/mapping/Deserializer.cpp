@@ -1,4 +1,13 @@
 ﻿#include "Deserializer.hpp"
+#include "DecimalCodec.hpp"
+#include "EnumCodec.hpp"
+#include "TimeCodec.hpp"
+#include "UuidCodec.hpp"
+
+#include "oatpp-mysql/Types.hpp"
+
+#include "oatpp/json/ObjectMapper.hpp"
+#include "oatpp/utils/parser/Caret.hpp"
 
 namespace oatpp { namespace mysql { namespace mapping {
 
@@ -11,7 +20,9 @@ Deserializer::InData::InData(MYSQL_BIND* pBind,
   isNull = (*bind->is_null == 1);
 }
 
-Deserializer::Deserializer() {
+Deserializer::Deserializer()
+  : m_jsonObjectMapper(std::make_shared<oatpp::json::ObjectMapper>())
+{
 
   m_methods.resize(data::type::ClassId::getClassCount(), nullptr);
 
@@ -35,15 +46,21 @@ Deserializer::Deserializer() {
   setDeserializerMethod(data::type::__class::Float32::CLASS_ID, &Deserializer::deserializeFloat32);
   setDeserializerMethod(data::type::__class::Float64::CLASS_ID, &Deserializer::deserializeFloat64);
 
-  setDeserializerMethod(data::type::__class::AbstractObject::CLASS_ID, nullptr);
+  setDeserializerMethod(mysql::__class::Timestamp::CLASS_ID, &Deserializer::deserializeTimestamp);
+  setDeserializerMethod(mysql::__class::Decimal::CLASS_ID, &Deserializer::deserializeDecimal);
+  setDeserializerMethod(mysql::__class::Uuid::CLASS_ID, &Deserializer::deserializeUuid);
+  setDeserializerMethod(mysql::__class::AbstractEnumSet::CLASS_ID, &Deserializer::deserializeEnumSet);
+
+  // objects and collections are stored as JSON documents - JSON_OBJECT(), JSON_ARRAYAGG()...
+  setDeserializerMethod(data::type::__class::AbstractObject::CLASS_ID, &Deserializer::deserializeJson);
   setDeserializerMethod(data::type::__class::AbstractEnum::CLASS_ID, &Deserializer::deserializeEnum);
 
-  setDeserializerMethod(data::type::__class::AbstractVector::CLASS_ID, nullptr);
-  setDeserializerMethod(data::type::__class::AbstractList::CLASS_ID, nullptr);
-  setDeserializerMethod(data::type::__class::AbstractUnorderedSet::CLASS_ID, nullptr);
+  setDeserializerMethod(data::type::__class::AbstractVector::CLASS_ID, &Deserializer::deserializeJson);
+  setDeserializerMethod(data::type::__class::AbstractList::CLASS_ID, &Deserializer::deserializeJson);
+  setDeserializerMethod(data::type::__class::AbstractUnorderedSet::CLASS_ID, &Deserializer::deserializeJson);
 
-  setDeserializerMethod(data::type::__class::AbstractPairList::CLASS_ID, nullptr);
-  setDeserializerMethod(data::type::__class::AbstractUnorderedMap::CLASS_ID, nullptr);
+  setDeserializerMethod(data::type::__class::AbstractPairList::CLASS_ID, &Deserializer::deserializeJson);
+  setDeserializerMethod(data::type::__class::AbstractUnorderedMap::CLASS_ID, &Deserializer::deserializeJson);
 
 }
 
@@ -55,6 +72,10 @@ void Deserializer::setDeserializerMethod(const data::type::ClassId& classId, Des
   m_methods[id] = method;
 }
 
+void Deserializer::setJsonObjectMapper(const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper) {
+  m_jsonObjectMapper = objectMapper;
+}
+
 oatpp::Void Deserializer::deserialize(const InData& data, const Type* type) const {
 
   // OATPP_LOGd("Deserializer::deserialize()", "type={}, oid={}, isNull={}", type->classId.name, data.oid, data.isNull);
@@ -76,6 +97,14 @@ oatpp::Void Deserializer::deserialize(const InData& data, const Type* type) cons
 
 }
 
+Deserializer::DeserializerMethod Deserializer::getMethod(const Type* type) const {
+  auto id = type->classId.id;
+  if(id >= m_methods.size()) {
+    return nullptr;
+  }
+  return m_methods[id];
+}
+
 v_int64 Deserializer::deInt(const InData& data) {
   v_int64 value;
 
@@ -100,11 +129,42 @@ v_int64 Deserializer::deInt(const InData& data) {
       std::memset(data.bind->buffer, 0, sizeof(int64_t));
       return value;
     }
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_TIME: {
+      return TimeCodec::toEpochMicros(*(const MYSQL_TIME*) data.bind->buffer);
+    }
+    case MYSQL_TYPE_NEWDECIMAL: {
+      // integer part, the fraction is truncated
+      v_buff_size size;
+      auto text = getText(data, size);
+      v_int64 unscaled;
+      v_int32 scale;
+      if(!DecimalCodec::parse(text, size, unscaled, scale)) {
+        throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deInt()]: Error. "
+                                 "Decimal '" + std::string(text, size) + "' doesn't fit int64.");
+      }
+      for(v_int32 i = 0; i < scale; i ++) {
+        unscaled /= 10;
+      }
+      return unscaled;
+    }
   }
 
   throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deInt()]: Error. Unknown OID.");
 }
 
+const char* Deserializer::getText(const InData& data, v_buff_size& size) {
+  auto ptr = (const char*) data.bind->buffer;
+  if(data.bind->length) {
+    size = (v_buff_size) std::min(*data.bind->length, data.bind->buffer_length - 1);
+  } else {
+    size = (v_buff_size) std::strlen(ptr);
+  }
+  return ptr;
+}
+
 oatpp::Void Deserializer::deserializeString(const Deserializer* _this, const InData& data, const Type* type)
 {
 
@@ -115,16 +175,22 @@ oatpp::Void Deserializer::deserializeString(const Deserializer* _this, const InD
     return oatpp::String();
   }
 
-  auto ptr = (const char*) data.bind->buffer;
-  auto size = std::strlen(ptr);             // not including null-terminator
-  // TODO: check buffer_length vs size
-  size = std::min((unsigned long)size, data.bind->buffer_length - 1);
+  if(TimeCodec::isTemporal((enum_field_types) data.oid)) {
+    // keep the mysql text form for String fields
+    char buffer[TimeCodec::MAX_TEXT_SIZE];
+    auto size = TimeCodec::format(*(const MYSQL_TIME*) data.bind->buffer, buffer);
+    return oatpp::String(buffer, size);
+  }
+
+  // size from the bind length - BLOB and VARBINARY values may contain zero bytes
+  v_buff_size size;
+  auto ptr = getText(data, size);
 
   oatpp::String value(ptr, size);
 
   // OATPP_LOGd("Deserializer::deserializeString()", "value='{}', size={}, buffer_length={}", value->c_str(), size, data.bind->buffer_length);
 
-  std::memset(data.bind->buffer, 0, data.bind->buffer_length);
+  std::memset(data.bind->buffer, 0, size);
 
   return value;
 
@@ -149,6 +215,11 @@ oatpp::Void Deserializer::deserializeFloat32(const Deserializer* _this, const In
       std::memset(data.bind->buffer, 0, sizeof(float));
       return oatpp::Float32(value);
     }
+    case MYSQL_TYPE_NEWDECIMAL: {
+      v_buff_size size;
+      auto text = getText(data, size);
+      return oatpp::Float32((float) DecimalCodec::toFloat64(text, size));
+    }
   }
 
   throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeFloat32()]: Error. Unknown OID.");
@@ -173,12 +244,116 @@ oatpp::Void Deserializer::deserializeFloat64(const Deserializer* _this, const In
       std::memset(data.bind->buffer, 0, sizeof(double));
       return oatpp::Float64(value);
     }
+    case MYSQL_TYPE_NEWDECIMAL: {
+      v_buff_size size;
+      auto text = getText(data, size);
+      return oatpp::Float64(DecimalCodec::toFloat64(text, size));
+    }
   }
 
   throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeFloat64()]: Error. Unknown OID.");
 
 }
 
+oatpp::Void Deserializer::deserializeDecimal(const Deserializer* _this, const InData& data, const Type* type) {
+
+  (void) _this;
+  (void) type;
+
+  if(data.isNull) {
+    return mysql::Decimal();
+  }
+
+  DecimalValue value;
+
+  switch(data.oid) {
+    case MYSQL_TYPE_TINY:
+    case MYSQL_TYPE_SHORT:
+    case MYSQL_TYPE_LONG:
+    case MYSQL_TYPE_LONGLONG: {
+      value.unscaled = deInt(data);
+      value.scale = 0;
+      return mysql::Decimal(value);
+    }
+    case MYSQL_TYPE_NEWDECIMAL:
+    case MYSQL_TYPE_STRING: {
+      v_buff_size size;
+      auto text = getText(data, size);
+      if(DecimalCodec::parse(text, size, value.unscaled, value.scale)) {
+        return mysql::Decimal(value);
+      }
+      throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeDecimal()]: Error. "
+                               "Value '" + std::string(text, size) + "' is not a decimal or doesn't fit int64.");
+    }
+  }
+
+  throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeDecimal()]: Error. Unknown OID.");
+
+}
+
+oatpp::Void Deserializer::deserializeUuid(const Deserializer* _this, const InData& data, const Type* type) {
+
+  (void) _this;
+  (void) type;
+
+  if(data.isNull) {
+    return mysql::Uuid();
+  }
+
+  switch(data.oid) {
+    case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_BLOB: {
+      v_buff_size size;
+      auto text = getText(data, size);
+      UuidValue value;
+      if(size == UuidCodec::SIZE) {
+        std::memcpy(value.bytes, text, UuidCodec::SIZE);
+        return mysql::Uuid(value);
+      }
+      if(UuidCodec::parse(text, size, value.bytes)) {
+        return mysql::Uuid(value);
+      }
+      throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeUuid()]: Error. "
+                               "Value of " + std::to_string(size) + " bytes is not a UUID.");
+    }
+  }
+
+  throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeUuid()]: Error. Unknown OID.");
+
+}
+
+oatpp::Void Deserializer::deserializeTimestamp(const Deserializer* _this, const InData& data, const Type* type) {
+
+  (void) _this;
+  (void) type;
+
+  if(data.isNull) {
+    return mysql::Timestamp();
+  }
+
+  switch(data.oid) {
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_TIME:
+    case MYSQL_TYPE_LONGLONG: {
+      return mysql::Timestamp(deInt(data));
+    }
+    case MYSQL_TYPE_STRING: {
+      MYSQL_TIME time;
+      auto ptr = (const char*) data.bind->buffer;
+      if(TimeCodec::parse(ptr, std::strlen(ptr), MYSQL_TYPE_DATETIME, time)) {
+        return mysql::Timestamp(TimeCodec::toEpochMicros(time));
+      }
+      throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeTimestamp()]: Error. "
+                               "Can't parse timestamp '" + std::string(ptr) + "'.");
+    }
+  }
+
+  throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeTimestamp()]: Error. Unknown OID.");
+
+}
+
 oatpp::Void Deserializer::deserializeAny(const Deserializer* _this, const InData& data, const Type* type) {
 
   (void) type;
@@ -209,6 +384,12 @@ oatpp::Void Deserializer::deserializeAny(const Deserializer* _this, const InData
       valueType = oatpp::Float64::Class::getType();
       break;
     case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_BLOB:
+    case MYSQL_TYPE_NEWDECIMAL:
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_TIME:
       valueType = oatpp::String::Class::getType();
       break;
     default:
@@ -223,6 +404,19 @@ oatpp::Void Deserializer::deserializeAny(const Deserializer* _this, const InData
 
 oatpp::Void Deserializer::deserializeEnum(const Deserializer* _this, const InData& data, const Type* type) {
 
+  // ENUM text is looked up in place, other values go through the interpretation
+  if(!data.isNull && (data.oid == MYSQL_TYPE_STRING || data.oid == MYSQL_TYPE_BLOB)) {
+    auto codec = EnumCodec::get(type);
+    if(codec) {
+      v_buff_size size;
+      auto text = getText(data, size);
+      auto index = codec->find(text, size);
+      if(index >= 0) {
+        return codec->getValue(index);
+      }
+    }
+  }
+
   auto polymorphicDispatcher = static_cast<const data::type::__class::AbstractEnum::PolymorphicDispatcher*>(
     type->polymorphicDispatcher
   );
@@ -246,4 +440,71 @@ oatpp::Void Deserializer::deserializeEnum(const Deserializer* _this, const InDat
 
 }
 
+oatpp::Void Deserializer::deserializeEnumSet(const Deserializer* _this, const InData& data, const Type* type) {
+
+  (void) _this;
+
+  if(data.isNull) {
+    return oatpp::Void(type);
+  }
+
+  v_uint64 mask;
+
+  switch(data.oid) {
+    case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_BLOB: {
+      auto codec = EnumCodec::get(type->params.front());
+      if(codec == nullptr) {
+        throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeEnumSet()]: Error. "
+                                 "Enum of the set must be interpreted as string.");
+      }
+      v_buff_size size;
+      auto text = getText(data, size);
+      if(!codec->parseSet(text, size, mask)) {
+        throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeEnumSet()]: Error. "
+                                 "Unknown member in '" + std::string(text, size) + "'.");
+      }
+      break;
+    }
+    default:
+      // SET column in numeric context - the mask as is
+      mask = (v_uint64) deInt(data);
+  }
+
+  return oatpp::Void(std::make_shared<v_uint64>(mask), type);
+
+}
+
+oatpp::Void Deserializer::deserializeJson(const Deserializer* _this, const InData& data, const Type* type) {
+
+  if(data.isNull) {
+    return oatpp::Void(type);
+  }
+
+  switch(data.oid) {
+    case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_BLOB:
+      break;
+    default:
+      throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeJson()]: Error. "
+                               "Can't deserialize '" + std::string(type->classId.name) + "' from a non-text column.");
+  }
+
+  // parse straight from the bind buffer
+  v_buff_size size;
+  auto text = getText(data, size);
+  utils::parser::Caret caret(text, size);
+
+  data::mapping::ErrorStack errorStack;
+  auto result = _this->m_jsonObjectMapper->read(caret, type, errorStack);
+  if(!errorStack.empty()) {
+    throw std::runtime_error("[oatpp::mysql::mapping::Deserializer::deserializeJson()]: Error. "
+                             "Can't parse JSON value of '" + std::string(type->classId.name) + "': " +
+                             *errorStack.stacktrace());
+  }
+
+  return result;
+
+}
+
 }}}
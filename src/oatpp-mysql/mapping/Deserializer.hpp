@@ -1,6 +1,7 @@
 ﻿#ifndef oatpp_mysql_mapping_Deserializer_hpp
 #define oatpp_mysql_mapping_Deserializer_hpp
 
+#include "oatpp/data/mapping/ObjectMapper.hpp"
 #include "oatpp/data/mapping/TypeResolver.hpp"
 #include "oatpp/Types.hpp"
 
@@ -41,16 +42,32 @@ public:
   typedef oatpp::Void (*DeserializerMethod)(const Deserializer*, const InData&, const Type*);
 private:
   static v_int64 deInt(const InData& data);
+  static const char* getText(const InData& data, v_buff_size& size);
 private:
   std::vector<DeserializerMethod> m_methods;
+  std::shared_ptr<data::mapping::ObjectMapper> m_jsonObjectMapper;
 public:
 
   Deserializer();
 
+  /**
+   * Set object mapper used to decode `JSON` columns into nested objects and collections.
+   * Default is &id:oatpp::json::ObjectMapper; with default config.
+   * @param objectMapper - &id:oatpp::data::mapping::ObjectMapper;.
+   */
+  void setJsonObjectMapper(const std::shared_ptr<data::mapping::ObjectMapper>& objectMapper);
+
   void setDeserializerMethod(const data::type::ClassId& classId, DeserializerMethod method);
 
   oatpp::Void deserialize(const InData& data, const Type* type) const;
 
+  /**
+   * Get deserializer method registered for the type class.
+   * @param type
+   * @return - method. `nullptr` if type is deserialized through its interpretation.
+   */
+  DeserializerMethod getMethod(const Type* type) const;
+
 private:
 
   static oatpp::Void deserializeString(const Deserializer* _this, const InData& data, const Type* type);
@@ -71,10 +88,20 @@ private:
 
   static oatpp::Void deserializeFloat64(const Deserializer* _this, const InData& data, const Type* type);
 
+  static oatpp::Void deserializeDecimal(const Deserializer* _this, const InData& data, const Type* type);
+
+  static oatpp::Void deserializeTimestamp(const Deserializer* _this, const InData& data, const Type* type);
+
+  static oatpp::Void deserializeUuid(const Deserializer* _this, const InData& data, const Type* type);
+
   static oatpp::Void deserializeAny(const Deserializer* _this, const InData& data, const Type* type);
 
   static oatpp::Void deserializeEnum(const Deserializer* _this, const InData& data, const Type* type);
 
+  static oatpp::Void deserializeEnumSet(const Deserializer* _this, const InData& data, const Type* type);
+
+  static oatpp::Void deserializeJson(const Deserializer* _this, const InData& data, const Type* type);
+
 };
 
 }}}
@@ -0,0 +1,251 @@
+#include "EnumCodec.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+constexpr v_int32 EnumCodec::MAX_SET_SIZE;
+
+namespace {
+
+// seeds tried per bucket before the table is doubled
+constexpr v_uint32 MAX_SEED = 1 << 12;
+
+v_uint32 roundUpPow2(v_uint32 value) {
+  v_uint32 result = 1;
+  while(result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+}
+
+v_uint32 EnumCodec::hash(const char* data, v_buff_size size, v_uint32 seed) {
+  // FNV-1a with the seeded basis and the final mix
+  v_uint32 h = 2166136261U ^ (seed * 0x9E3779B9U);
+  for(v_buff_size i = 0; i < size; i ++) {
+    h ^= (v_uint8) data[i];
+    h *= 16777619U;
+  }
+  h ^= h >> 16;
+  h *= 0x85EBCA6BU;
+  h ^= h >> 13;
+  return h;
+}
+
+EnumCodec::EnumCodec(const std::vector<std::string>& names)
+  : m_names(names)
+{
+
+  std::unordered_set<std::string> distinct(m_names.begin(), m_names.end());
+  if(distinct.size() != m_names.size()) {
+    throw std::runtime_error("[oatpp::mysql::mapping::EnumCodec::EnumCodec()]: Error. Names are not distinct.");
+  }
+
+  // hash and displace - names are split to buckets by the seed 0,
+  // then each bucket, the largest first, gets the seed which places all its names to free slots
+  const v_uint32 count = (v_uint32) m_names.size();
+  const v_uint32 bucketCount = roundUpPow2(std::max<v_uint32>(count / 4, 1));
+  m_bucketMask = bucketCount - 1;
+
+  std::vector<std::vector<v_int32>> buckets(bucketCount);
+  for(v_uint32 i = 0; i < count; i ++) {
+    buckets[hash(m_names[i].data(), m_names[i].size(), 0) & m_bucketMask].push_back((v_int32) i);
+  }
+
+  std::vector<v_uint32> order(bucketCount);
+  for(v_uint32 i = 0; i < bucketCount; i ++) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&buckets](v_uint32 a, v_uint32 b) {
+    return buckets[a].size() > buckets[b].size();
+  });
+
+  for(v_uint32 slotCount = roundUpPow2(std::max<v_uint32>(count * 2, 2)); ; slotCount <<= 1) {
+
+    m_slotMask = slotCount - 1;
+    m_slots.assign(slotCount, -1);
+    m_seeds.assign(bucketCount, 0);
+
+    bool placed = true;
+    std::vector<v_uint32> bucketSlots;
+
+    for(auto b : order) {
+
+      const auto& bucket = buckets[b];
+      if(bucket.empty()) {
+        break;
+      }
+
+      bool found = false;
+      for(v_uint32 seed = 1; seed < MAX_SEED && !found; seed ++) {
+        bucketSlots.clear();
+        found = true;
+        for(auto index : bucket) {
+          auto slot = hash(m_names[index].data(), m_names[index].size(), seed) & m_slotMask;
+          if(m_slots[slot] != -1 || std::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end()) {
+            found = false;
+            break;
+          }
+          bucketSlots.push_back(slot);
+        }
+        if(found) {
+          m_seeds[b] = seed;
+          for(size_t i = 0; i < bucket.size(); i ++) {
+            m_slots[bucketSlots[i]] = bucket[i];
+          }
+        }
+      }
+
+      if(!found) {
+        placed = false;
+        break;
+      }
+
+    }
+
+    if(placed) {
+      break;
+    }
+
+    if(slotCount >= (1U << 24)) {
+      throw std::runtime_error("[oatpp::mysql::mapping::EnumCodec::EnumCodec()]: Error. Can't build the hash.");
+    }
+
+  }
+
+}
+
+const EnumCodec* EnumCodec::get(const oatpp::Type* enumType) {
+
+  // codecs are never removed - the thread cache keeps pointers without locking
+  static std::mutex mutex;
+  static std::unordered_map<const oatpp::Type*, std::unique_ptr<EnumCodec>> codecs;
+  thread_local std::unordered_map<const oatpp::Type*, const EnumCodec*> cache;
+
+  auto cached = cache.find(enumType);
+  if(cached != cache.end()) {
+    return cached->second;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto it = codecs.find(enumType);
+  if(it == codecs.end()) {
+
+    auto dispatcher = static_cast<const data::type::__class::AbstractEnum::PolymorphicDispatcher*>(
+      enumType->polymorphicDispatcher
+    );
+
+    std::unique_ptr<EnumCodec> codec;
+
+    if(dispatcher->getInterpretationType() == oatpp::String::Class::getType()) {
+
+      std::vector<std::string> names;
+      std::vector<oatpp::Void> values;
+
+      for(const auto& interpretation : dispatcher->getInterpretedEnum(true)) {
+        auto name = interpretation.retrieve<oatpp::String>();
+        data::type::EnumInterpreterError e = data::type::EnumInterpreterError::OK;
+        values.push_back(dispatcher->fromInterpretation(name, true, e));
+        names.push_back(*name);
+      }
+
+      codec.reset(new EnumCodec(names));
+      codec->m_values = std::move(values);
+
+    }
+
+    it = codecs.insert({enumType, std::move(codec)}).first;
+
+  }
+
+  cache.insert({enumType, it->second.get()});
+  return it->second.get();
+
+}
+
+v_int32 EnumCodec::find(const char* data, v_buff_size size) const {
+  auto seed = m_seeds[hash(data, size, 0) & m_bucketMask];
+  auto index = m_slots[hash(data, size, seed) & m_slotMask];
+  if(index < 0) {
+    return -1;
+  }
+  const auto& name = m_names[index];
+  if(name.size() != (size_t) size || std::memcmp(name.data(), data, size) != 0) {
+    return -1;
+  }
+  return index;
+}
+
+const oatpp::Void& EnumCodec::getValue(v_int32 index) const {
+  return m_values[index];
+}
+
+const std::string& EnumCodec::getName(v_int32 index) const {
+  return m_names[index];
+}
+
+v_int32 EnumCodec::getCount() const {
+  return (v_int32) m_names.size();
+}
+
+bool EnumCodec::parseSet(const char* data, v_buff_size size, v_uint64& mask) const {
+
+  mask = 0;
+
+  v_buff_size start = 0;
+  for(v_buff_size i = 0; i <= size; i ++) {
+
+    if(i < size && data[i] != ',') {
+      continue;
+    }
+
+    // empty SET value is the empty string
+    if(size > 0) {
+      auto index = find(data + start, i - start);
+      if(index < 0 || index >= MAX_SET_SIZE) {
+        return false;
+      }
+      mask |= ((v_uint64) 1) << index;
+    }
+
+    start = i + 1;
+
+  }
+
+  return true;
+
+}
+
+bool EnumCodec::formatSet(v_uint64 mask, std::string& text) const {
+
+  text.clear();
+
+  for(v_int32 i = 0; i < MAX_SET_SIZE && mask != 0; i ++) {
+    v_uint64 bit = ((v_uint64) 1) << i;
+    if((mask & bit) == 0) {
+      continue;
+    }
+    if(i >= getCount()) {
+      return false;
+    }
+    if(!text.empty()) {
+      text.push_back(',');
+    }
+    text.append(m_names[i]);
+    mask &= ~bit;
+  }
+
+  return mask == 0;
+
+}
+
+}}}
@@ -0,0 +1,100 @@
+#ifndef oatpp_mysql_mapping_EnumCodec_hpp
+#define oatpp_mysql_mapping_EnumCodec_hpp
+
+#include "oatpp/Types.hpp"
+
+#include <string>
+#include <vector>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+/**
+ * Lookup of `ENUM` and `SET` member names. <br>
+ * Names are placed with the perfect hash built once - find is two hashes of the raw text and one compare,
+ * no allocations.
+ */
+class EnumCodec {
+public:
+
+  /**
+   * Max number of `SET` members - bits of the mask.
+   */
+  static constexpr v_int32 MAX_SET_SIZE = 64;
+
+private:
+  static v_uint32 hash(const char* data, v_buff_size size, v_uint32 seed);
+private:
+  std::vector<std::string> m_names;
+  std::vector<oatpp::Void> m_values;
+  std::vector<v_uint32> m_seeds;
+  std::vector<v_int32> m_slots;
+  v_uint32 m_bucketMask;
+  v_uint32 m_slotMask;
+public:
+
+  /**
+   * Constructor. Builds the hash.
+   * @param names - distinct member names. Index of the name is its index in the vector.
+   */
+  EnumCodec(const std::vector<std::string>& names);
+
+  /**
+   * Get codec of the &id:oatpp::Enum; interpreted as string. Codec is built on the first call and cached. <br>
+   * Names are unqualified names of the enum entries in the order of declaration.
+   * @param enumType - enum type.
+   * @return - codec. `nullptr` if enum is not interpreted as string.
+   */
+  static const EnumCodec* get(const oatpp::Type* enumType);
+
+  /**
+   * Find member by name.
+   * @param data
+   * @param size
+   * @return - index of the member. `-1` if not found.
+   */
+  v_int32 find(const char* data, v_buff_size size) const;
+
+  /**
+   * Get enum value of the member. Only for codecs of &l:EnumCodec::get ();. <br>
+   * Value is created once when the codec is built and shared by all the rows -
+   * enum fields are assigned, not modified in place.
+   * @param index
+   * @return
+   */
+  const oatpp::Void& getValue(v_int32 index) const;
+
+  /**
+   * Get name of the member.
+   * @param index
+   * @return
+   */
+  const std::string& getName(v_int32 index) const;
+
+  /**
+   * Get number of members.
+   * @return
+   */
+  v_int32 getCount() const;
+
+  /**
+   * Parse `SET` value - comma-separated member names, to the bit mask. Bit `i` is member `i`.
+   * @param data
+   * @param size
+   * @param mask - out.
+   * @return - `false` if some name is unknown.
+   */
+  bool parseSet(const char* data, v_buff_size size, v_uint64& mask) const;
+
+  /**
+   * Format bit mask as `SET` value.
+   * @param mask
+   * @param text - out.
+   * @return - `false` if mask has bits of unknown members.
+   */
+  bool formatSet(v_uint64 mask, std::string& text) const;
+
+};
+
+}}}
+
+#endif // oatpp_mysql_mapping_EnumCodec_hpp
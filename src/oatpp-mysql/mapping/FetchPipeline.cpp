@@ -0,0 +1,261 @@
+#include "FetchPipeline.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+FetchPipeline::FetchPipeline(const std::shared_ptr<ResultMapper>& resultMapper,
+                             const std::shared_ptr<WorkerPool>& workerPool,
+                             const Config& config)
+  : m_resultMapper(resultMapper)
+  , m_workerPool(workerPool)
+  , m_config(config)
+{
+  if(!m_workerPool) {
+    throw std::runtime_error("[oatpp::mysql::mapping::FetchPipeline::FetchPipeline()]: Error. WorkerPool is not set.");
+  }
+  m_config.batchSize = std::max<v_int64>(m_config.batchSize, 1);
+  m_config.depth = std::max<v_int32>(m_config.depth, 1);
+}
+
+v_buff_size FetchPipeline::getFixedSize(enum_field_types bufferType) {
+  switch(bufferType) {
+    case MYSQL_TYPE_TINY: return sizeof(int8_t);
+    case MYSQL_TYPE_SHORT: return sizeof(int16_t);
+    case MYSQL_TYPE_LONG: return sizeof(int32_t);
+    case MYSQL_TYPE_LONGLONG: return sizeof(int64_t);
+    case MYSQL_TYPE_FLOAT: return sizeof(float);
+    case MYSQL_TYPE_DOUBLE: return sizeof(double);
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_TIME: return sizeof(MYSQL_TIME);
+    default:
+      return 0;
+  }
+}
+
+void FetchPipeline::readRow(const ResultData* dbData, Batch& batch) {
+
+  v_int64 base = batch.rowsCount * dbData->colCount;
+
+  for(v_int32 i = 0; i < dbData->colCount; i ++) {
+
+    const MYSQL_BIND& bind = dbData->bindResults[i];
+    auto fixedSize = getFixedSize(bind.buffer_type);
+
+    batch.nulls[base + i] = (*bind.is_null == 1);
+
+    if(fixedSize > 0) {
+      // keep numbers aligned - deserializers read them in place
+      v_buff_size offset = (batch.arena.size() + 7) & ~((v_buff_size) 7);
+      batch.arena.resize(offset + fixedSize);
+      std::memcpy(batch.arena.data() + offset, bind.buffer, fixedSize);
+      batch.offsets.push_back(offset);
+      batch.lengths.push_back((unsigned long) fixedSize);
+      batch.sizes.push_back((unsigned long) fixedSize);
+    } else {
+      unsigned long length = *bind.length;
+      v_buff_size size = std::min(length, bind.buffer_length - 1);
+      v_buff_size offset = batch.arena.size();
+      batch.arena.resize(offset + size + 1);
+      std::memcpy(batch.arena.data() + offset, bind.buffer, size);
+      batch.arena[offset + size] = 0;
+      batch.offsets.push_back(offset);
+      batch.lengths.push_back(length);
+      batch.sizes.push_back((unsigned long) size);
+    }
+
+  }
+
+  batch.rowsCount ++;
+
+}
+
+void FetchPipeline::decode(State* state, Batch& batch) {
+
+  // row view - points binds to the row images in the arena
+  ResultData view(state->columns.get());
+
+  for(v_int64 row = 0; row < batch.rowsCount; row ++) {
+
+    v_int64 base = row * view.colCount;
+
+    for(v_int32 i = 0; i < view.colCount; i ++) {
+      MYSQL_BIND& bind = view.bindResults[i];
+      bind.buffer = batch.arena.data() + batch.offsets[base + i];
+      bind.is_null = &batch.nulls[base + i];
+      bind.length = &batch.lengths[base + i];
+      if(getFixedSize(bind.buffer_type) == 0) {
+        // sized by the stored image - column buffers may have grown after the columns snapshot was taken
+        bind.buffer_length = batch.sizes[base + i] + 1;
+      }
+    }
+
+    view.rowIndex = row;
+    batch.items.push_back(state->resultMapper->readOneRow(&view, state->itemType));
+
+  }
+
+}
+
+void FetchPipeline::runDecode(const std::shared_ptr<State>& state, v_int32 slot) {
+
+  Batch& batch = state->batches[slot];
+
+  {
+    std::lock_guard<std::mutex> guard(state->lock);
+    if(batch.claimed) {
+      return;
+    }
+    batch.claimed = true;
+  }
+
+  try {
+    decode(state.get(), batch);
+  } catch (...) {
+    batch.error = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(state->lock);
+    batch.decoded = true;
+  }
+  state->decodedCondition.notify_all();
+
+}
+
+void FetchPipeline::post(const std::shared_ptr<State>& state, v_int32 slot) {
+
+  Batch& batch = state->batches[slot];
+  batch.posted = true;
+  batch.claimed = false;
+  batch.decoded = false;
+
+  // queue is full - the batch is decoded by the calling thread when it is drained
+  m_workerPool->tryPost([state, slot]() {
+    runDecode(state, slot);
+  });
+
+}
+
+void FetchPipeline::waitDecoded(const std::shared_ptr<State>& state, v_int32 slot) {
+
+  Batch& batch = state->batches[slot];
+  if(!batch.posted) {
+    return;
+  }
+
+  // decode on the calling thread if no worker has taken the batch yet - workers may be busy with the caller itself
+  runDecode(state, slot);
+
+  std::unique_lock<std::mutex> guard(state->lock);
+  while(!batch.decoded) {
+    state->decodedCondition.wait(guard);
+  }
+  batch.posted = false;
+
+}
+
+oatpp::Void FetchPipeline::fetch(ResultData* dbData, const Type* type, v_int64 count) {
+
+  auto id = type->classId.id;
+  if(id != data::type::__class::AbstractVector::CLASS_ID.id &&
+     id != data::type::__class::AbstractList::CLASS_ID.id &&
+     id != data::type::__class::AbstractUnorderedSet::CLASS_ID.id)
+  {
+    throw std::runtime_error("[oatpp::mysql::mapping::FetchPipeline::fetch()]: Error. Invalid result container type. "
+                             "Allowed types are oatpp::Vector, oatpp::List, oatpp::UnorderedSet");
+  }
+
+  auto dispatcher = static_cast<const data::type::__class::Collection::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  auto collection = dispatcher->createObject();
+
+  if(!dbData->hasMore || count == 0) {
+    return collection;
+  }
+
+  auto state = std::make_shared<State>();
+  state->resultMapper = m_resultMapper;
+  state->columns = std::make_shared<ResultData>(dbData);
+  state->itemType = dispatcher->getItemType();
+  state->batches.resize(m_config.depth);
+
+  for(auto& batch : state->batches) {
+    batch.nulls.reset(new bool[m_config.batchSize * dbData->colCount + 1]);
+    batch.offsets.reserve(m_config.batchSize * dbData->colCount);
+    batch.lengths.reserve(m_config.batchSize * dbData->colCount);
+    batch.sizes.reserve(m_config.batchSize * dbData->colCount);
+    batch.items.reserve(m_config.batchSize);
+  }
+
+  auto append = [&](Batch& batch) {
+    if(batch.error) {
+      std::rethrow_exception(batch.error);
+    }
+    for(auto& item : batch.items) {
+      dispatcher->addItem(collection, item);
+    }
+    batch.items.clear();
+  };
+
+  v_int64 seq = 0;
+  v_int64 rowsRead = 0;
+  std::exception_ptr error;
+
+  try {
+
+    while(dbData->hasMore && (count < 0 || rowsRead < count)) {
+
+      v_int32 slot = (v_int32) (seq % m_config.depth);
+      Batch& batch = state->batches[slot];
+
+      // slot is reused - the oldest batch in the ring, it goes to the result next
+      waitDecoded(state, slot);
+      append(batch);
+
+      batch.arena.clear();
+      batch.offsets.clear();
+      batch.lengths.clear();
+      batch.sizes.clear();
+      batch.rowsCount = 0;
+
+      while(batch.rowsCount < m_config.batchSize && dbData->hasMore && (count < 0 || rowsRead < count)) {
+        readRow(dbData, batch);
+        ++ dbData->rowIndex;
+        ++ rowsRead;
+        dbData->next();
+      }
+
+      post(state, slot);
+      ++ seq;
+
+    }
+
+  } catch (...) {
+    error = std::current_exception();
+  }
+
+  // drain the ring in order. All posted batches are waited for, even on error.
+  for(v_int64 i = std::max<v_int64>(seq - m_config.depth, 0); i < seq; i ++) {
+    v_int32 slot = (v_int32) (i % m_config.depth);
+    waitDecoded(state, slot);
+    if(!error) {
+      try {
+        append(state->batches[slot]);
+      } catch (...) {
+        error = std::current_exception();
+      }
+    }
+  }
+
+  if(error) {
+    std::rethrow_exception(error);
+  }
+
+  return collection;
+
+}
+
+}}}
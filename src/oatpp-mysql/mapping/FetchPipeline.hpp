@@ -0,0 +1,123 @@
+#ifndef oatpp_mysql_mapping_FetchPipeline_hpp
+#define oatpp_mysql_mapping_FetchPipeline_hpp
+
+#include "ResultMapper.hpp"
+
+#include "oatpp-mysql/WorkerPool.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+/**
+ * Fetch rows with network reads overlapped with deserialization. <br>
+ * The calling thread reads rows from the result and copies raw row images into a bounded ring of
+ * pre-allocated batches. Filled batches are decoded to oatpp objects on the &id:oatpp::mysql::WorkerPool; threads,
+ * while the calling thread keeps reading. Decoded batches are appended to the result in the order rows were read.
+ */
+class FetchPipeline {
+public:
+  typedef oatpp::data::type::Type Type;
+public:
+
+  /**
+   * Pipeline config.
+   */
+  struct Config {
+
+    /**
+     * Max number of rows in one batch.
+     */
+    v_int64 batchSize = 1024;
+
+    /**
+     * Number of batches in the ring - max number of batches being decoded while the next one is read.
+     */
+    v_int32 depth = 4;
+
+  };
+
+private:
+
+  /*
+   * Raw row images and decoded rows of the batch.
+   * Fixed-size values and strings are copied to the arena one after another,
+   * `offsets`, `lengths`, `sizes` and `nulls` have an entry per value - `row * colCount + col`.
+   * `lengths` are the value lengths reported by the server, `sizes` - bytes of the value stored in the arena.
+   */
+  struct Batch {
+
+    std::vector<char> arena;
+    std::vector<v_buff_size> offsets;
+    std::vector<unsigned long> lengths;
+    std::vector<unsigned long> sizes;
+    std::unique_ptr<bool[]> nulls;
+    v_int64 rowsCount = 0;
+
+    std::vector<oatpp::Void> items;
+    std::exception_ptr error;
+
+    /*
+     * Batch is queued for decoding / decoding is taken by a worker or by the calling thread / decoding is done.
+     */
+    bool posted = false;
+    bool claimed = false;
+    bool decoded = false;
+
+  };
+
+  /*
+   * State shared with the decode tasks.
+   */
+  struct State {
+    std::shared_ptr<ResultMapper> resultMapper;
+    std::shared_ptr<ResultData> columns;
+    const Type* itemType;
+    std::mutex lock;
+    std::condition_variable decodedCondition;
+    std::vector<Batch> batches;
+  };
+
+private:
+  static v_buff_size getFixedSize(enum_field_types bufferType);
+  static void readRow(const ResultData* dbData, Batch& batch);
+  static void decode(State* state, Batch& batch);
+  static void runDecode(const std::shared_ptr<State>& state, v_int32 slot);
+private:
+  std::shared_ptr<ResultMapper> m_resultMapper;
+  std::shared_ptr<WorkerPool> m_workerPool;
+  Config m_config;
+private:
+  void post(const std::shared_ptr<State>& state, v_int32 slot);
+  void waitDecoded(const std::shared_ptr<State>& state, v_int32 slot);
+public:
+
+  /**
+   * Constructor.
+   * @param resultMapper - &id:oatpp::mysql::mapping::ResultMapper; to decode rows with.
+   * @param workerPool - &id:oatpp::mysql::WorkerPool; to run decoders on.
+   * @param config - &l:FetchPipeline::Config;.
+   */
+  FetchPipeline(const std::shared_ptr<ResultMapper>& resultMapper,
+                const std::shared_ptr<WorkerPool>& workerPool,
+                const Config& config);
+
+  /**
+   * Read `count` of rows to oatpp collection. <br>
+   * Allowed collections are the same as for &id:oatpp::mysql::mapping::ResultMapper::readRows;.
+   * @param dbData - result positioned at the first row to read.
+   * @param type - result container type.
+   * @param count - how many rows to fetch. `-1` - fetch all remaining rows.
+   * @return - collection of rows.
+   */
+  oatpp::Void fetch(ResultData* dbData, const Type* type, v_int64 count);
+
+};
+
+}}}
+
+#endif // oatpp_mysql_mapping_FetchPipeline_hpp
@@ -1,18 +1,76 @@
 ﻿#include "ResultMapper.hpp"
+#include "TimeCodec.hpp"
 #include "oatpp/base/Log.hpp"
 
 namespace oatpp { namespace mysql { namespace mapping {
 
+constexpr unsigned long ResultMapper::ResultData::MAX_INITIAL_BLOB_BUFFER_SIZE;
+constexpr v_buff_size ResultMapper::ResultData::DEFAULT_STREAM_CHUNK_SIZE;
+
+bool ResultMapper::ResultData::isVariableLength(enum_field_types type) {
+  switch(type) {
+    case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_VAR_STRING:
+    case MYSQL_TYPE_BLOB:
+    case MYSQL_TYPE_NEWDECIMAL:
+      return true;
+    default:
+      return false;
+  }
+}
+
 ResultMapper::ResultData::ResultData(MYSQL_STMT* pStmt, const std::shared_ptr<const data::mapping::TypeResolver>& pTypeResolver)
   : stmt(pStmt)
+  , textResults(nullptr)
+  , typeResolver(pTypeResolver)
+  , colCount(0)
+  , rowIndex(0)
+  , hasMore(false)
+  , isSuccess(false)
+  , metaResults(nullptr)
+  , ownsBinds(true)
+  , truncated(false)
+{
+  bindResultsForCache();
+}
+
+ResultMapper::ResultData::ResultData(MYSQL_RES* pTextResults, const std::shared_ptr<const data::mapping::TypeResolver>& pTypeResolver)
+  : stmt(nullptr)
+  , textResults(pTextResults)
   , typeResolver(pTypeResolver)
+  , colCount(0)
+  , rowIndex(0)
+  , hasMore(false)
+  , isSuccess(false)
+  , metaResults(nullptr)
+  , ownsBinds(true)
+  , truncated(false)
 {
   bindResultsForCache();
 }
 
+ResultMapper::ResultData::ResultData(const ResultData* source)
+  : stmt(nullptr)
+  , textResults(nullptr)
+  , typeResolver(source->typeResolver)
+  , colNames(source->colNames)
+  , colIndices(source->colIndices)
+  , colCount(source->colCount)
+  , rowIndex(0)
+  , hasMore(false)
+  , isSuccess(source->isSuccess)
+  , bindResults(source->bindResults)
+  , metaResults(nullptr)
+  , ownsBinds(false)
+  , truncated(false)
+{}
+
 ResultMapper::ResultData::~ResultData() {
   // free bind results
   for (auto& bind : bindResults) {
+    if (!ownsBinds) {
+      break;
+    }
     if (bind.buffer) {
       free(bind.buffer);
       bind.buffer = nullptr;
@@ -21,20 +79,123 @@ ResultMapper::ResultData::~ResultData() {
       free(bind.is_null);
       bind.is_null = nullptr;
     }
+    if (bind.length) {
+      free(bind.length);
+      bind.length = nullptr;
+    }
   }
 
   if (metaResults) {
     mysql_free_result(metaResults);
   }
+
+  if (textResults) {
+    mysql_free_result(textResults);
+  }
 }
 
 void ResultMapper::ResultData::init() {
-  isSuccess = (mysql_stmt_errno(stmt) == 0);
-  next();
+  // text protocol results are created for successful queries only
+  isSuccess = stmt ? (mysql_stmt_errno(stmt) == 0) : true;
   rowIndex = 0;
+  // statements without result set (INSERT, UPDATE, DELETE...) have nothing to fetch
+  // truncated values of the first row are fetched by completeRow() - columns may be marked streamed before
+  if(isSuccess && (metaResults || textResults)) {
+    fetchRow();
+  }
 }
 
 void ResultMapper::ResultData::next() {
+  fetchRow();
+  completeRow();
+}
+
+void ResultMapper::ResultData::completeRow() {
+  if(truncated) {
+    truncated = false;
+    fetchTruncatedColumns();
+  }
+}
+
+v_int64 ResultMapper::ResultData::streamColumn(v_int32 index, data::stream::OutputStream* stream, v_buff_size chunkSize) {
+
+  if(index < 0 || index >= colCount) {
+    throw std::runtime_error("[oatpp::mysql::mapping::ResultMapper::ResultData::streamColumn()]: Error. "
+                             "Invalid column index - " + std::to_string(index) + ".");
+  }
+
+  const auto& bind = bindResults[index];
+  if(!isVariableLength(bind.buffer_type)) {
+    throw std::runtime_error("[oatpp::mysql::mapping::ResultMapper::ResultData::streamColumn()]: Error. "
+                             "Column '" + *colNames[index] + "' is not a text or binary column.");
+  }
+
+  streamedColumns[index] = true;
+
+  auto write = [stream](const void* data, v_buff_size size) {
+    if(size > 0 && stream->writeExactSizeDataSimple(data, size) != size) {
+      throw std::runtime_error("[oatpp::mysql::mapping::ResultMapper::ResultData::streamColumn()]: Error. "
+                               "Failed to write to the output stream.");
+    }
+  };
+
+  // the whole text protocol row is in memory already
+  if(textResults) {
+    if(*bind.is_null) {
+      return 0;
+    }
+    write(bind.buffer, (v_buff_size) *bind.length);
+    return (v_int64) *bind.length;
+  }
+
+  if(chunkSize <= 0) {
+    chunkSize = DEFAULT_STREAM_CHUNK_SIZE;
+  }
+
+  std::unique_ptr<char[]> chunk(new char[chunkSize]);
+
+  bool isNull = false;
+  unsigned long length = 0;
+
+  MYSQL_BIND chunkBind;
+  std::memset(&chunkBind, 0, sizeof(chunkBind));
+  chunkBind.buffer_type = bind.buffer_type;
+  chunkBind.buffer = chunk.get();
+  chunkBind.buffer_length = (unsigned long) chunkSize;
+  chunkBind.is_null = &isNull;
+  chunkBind.length = &length;
+
+  unsigned long offset = 0;
+
+  do {
+
+    if(mysql_stmt_fetch_column(stmt, &chunkBind, index, offset)) {
+      throw std::runtime_error("[oatpp::mysql::mapping::ResultMapper::ResultData::streamColumn()]: Error. "
+                               "mysql_stmt_fetch_column() failed: " + std::string(mysql_stmt_error(stmt)));
+    }
+
+    // length is the full length of the value
+    if(isNull || length <= offset) {
+      break;
+    }
+
+    auto size = std::min<unsigned long>(length - offset, chunkBind.buffer_length);
+    write(chunk.get(), (v_buff_size) size);
+    offset += size;
+
+  } while(offset < length);
+
+  return (v_int64) offset;
+
+}
+
+void ResultMapper::ResultData::fetchRow() {
+
+  if(textResults) {
+    readTextRow();
+    return;
+  }
+
   auto res = mysql_stmt_fetch(stmt);
 
   switch(res) {
@@ -50,7 +211,9 @@ void ResultMapper::ResultData::next() {
     };
     // data truncated
     case MYSQL_DATA_TRUNCATED: {
-      // TODO: handle data truncation
+      truncated = true;
+      hasMore = true;
+      break;
     }
     // fetch row success
     default: {
@@ -61,14 +224,139 @@ void ResultMapper::ResultData::next() {
 
 }
 
+void ResultMapper::ResultData::readTextRow() {
+
+  MYSQL_ROW row = mysql_fetch_row(textResults);
+  if(row == nullptr) {
+    hasMore = false;
+    return;
+  }
+
+  unsigned long* lengths = mysql_fetch_lengths(textResults);
+
+  for(v_int32 i = 0; i < colCount; i ++) {
+
+    auto& bind = bindResults[i];
+    *bind.is_null = (row[i] == nullptr);
+    if(row[i] == nullptr) {
+      continue;
+    }
+
+    switch(bind.buffer_type) {
+      case MYSQL_TYPE_TINY:
+        *(int8_t*) bind.buffer = (int8_t) std::strtol(row[i], nullptr, 10);
+        break;
+      case MYSQL_TYPE_SHORT:
+        *(int16_t*) bind.buffer = (int16_t) std::strtol(row[i], nullptr, 10);
+        break;
+      case MYSQL_TYPE_LONG:
+        *(int32_t*) bind.buffer = (int32_t) std::strtoll(row[i], nullptr, 10);
+        break;
+      case MYSQL_TYPE_LONGLONG:
+        if(bind.is_unsigned) {
+          *(uint64_t*) bind.buffer = std::strtoull(row[i], nullptr, 10);
+        } else {
+          *(int64_t*) bind.buffer = std::strtoll(row[i], nullptr, 10);
+        }
+        break;
+      case MYSQL_TYPE_FLOAT:
+        *(float*) bind.buffer = std::strtof(row[i], nullptr);
+        break;
+      case MYSQL_TYPE_DOUBLE:
+        *(double*) bind.buffer = std::strtod(row[i], nullptr);
+        break;
+      case MYSQL_TYPE_DATE:
+      case MYSQL_TYPE_DATETIME:
+      case MYSQL_TYPE_TIMESTAMP:
+      case MYSQL_TYPE_TIME:
+        if(!TimeCodec::parse(row[i], lengths[i], bind.buffer_type, *static_cast<MYSQL_TIME*>(bind.buffer))) {
+          throw std::runtime_error("[oatpp::mysql::mapping::ResultMapper::ResultData::readTextRow()]: Error. "
+                                   "Can't parse temporal value '" + std::string(row[i], lengths[i]) + "'.");
+        }
+        break;
+      default: {
+        if(lengths[i] >= bind.buffer_length) {
+          growBuffer(bind, lengths[i] + 1);
+        }
+        auto size = std::min(lengths[i], bind.buffer_length - 1);
+        std::memcpy(bind.buffer, row[i], size);
+        static_cast<char*>(bind.buffer)[size] = 0;
+        *bind.length = lengths[i];
+      }
+    }
+
+  }
+
+  hasMore = true;
+
+}
+
+void ResultMapper::ResultData::growBuffer(MYSQL_BIND& bind, unsigned long size) {
+  // grow at least twice - values of the column tend to grow together
+  size = std::max(size, bind.buffer_length * 2);
+  free(bind.buffer);
+  bind.buffer = malloc(size);
+  if(bind.buffer == nullptr) {
+    bind.buffer_length = 0;
+    throw std::runtime_error("[oatpp::mysql::mapping::ResultMapper::ResultData::growBuffer()]: Error. "
+                             "Can't allocate " + std::to_string(size) + " bytes.");
+  }
+  bind.buffer_length = size;
+}
+
+void ResultMapper::ResultData::fetchTruncatedColumns() {
+
+  bool rebind = false;
+
+  for(v_int32 i = 0; i < colCount; i ++) {
+
+    auto& bind = bindResults[i];
+    if(!isVariableLength(bind.buffer_type) || *bind.is_null || *bind.length < bind.buffer_length) {
+      continue;
+    }
+
+    // streamed values stay in the stream - readers get the prefix which fits the buffer
+    if(streamedColumns[i]) {
+      *bind.length = bind.buffer_length - 1;
+      continue;
+    }
+
+    growBuffer(bind, *bind.length + 1);
+    rebind = true;
+
+    if(mysql_stmt_fetch_column(stmt, &bind, i, 0)) {
+      throw std::runtime_error("[oatpp::mysql::mapping::ResultMapper::ResultData::fetchTruncatedColumns()]: Error. "
+                               "mysql_stmt_fetch_column() failed: " + std::string(mysql_stmt_error(stmt)));
+    }
+
+  }
+
+  // the statement keeps the old buffer pointers until rebound
+  if(rebind && mysql_stmt_bind_result(stmt, bindResults.data())) {
+    throw std::runtime_error("[oatpp::mysql::mapping::ResultMapper::ResultData::fetchTruncatedColumns()]: Error. "
+                             "mysql_stmt_bind_result() failed: " + std::string(mysql_stmt_error(stmt)));
+  }
+
+}
+
 void ResultMapper::ResultData::bindResultsForCache()
 {
-  metaResults = mysql_stmt_result_metadata(stmt);
+  MYSQL_FIELD* fields = nullptr;
+
+  if(stmt) {
+    metaResults = mysql_stmt_result_metadata(stmt);
+    if(metaResults) {
+      colCount = mysql_num_fields(metaResults);
+      fields = mysql_fetch_fields(metaResults);
+    }
+  } else if(textResults) {
+    colCount = mysql_num_fields(textResults);
+    fields = mysql_fetch_fields(textResults);
+  }
+
   // if null, no result set
-  if (metaResults)
+  if (fields)
   {
-    colCount = mysql_num_fields(metaResults);
-    MYSQL_FIELD* fields = mysql_fetch_fields(metaResults);
 
     for (v_int32 i = 0; i < colCount; i++) {
       oatpp::String colName = fields[i].name;
@@ -83,11 +371,17 @@ void ResultMapper::ResultData::bindResultsForCache()
       std::memset(&bind, 0, sizeof(bind));
 
       bind.buffer_type = fields[i].type;
+      bind.is_unsigned = (fields[i].flags & UNSIGNED_FLAG) != 0;
 
       // indicate through is_null pointer if the value is null
       bool* is_null = static_cast<bool*>(malloc(sizeof(bool)));
       bind.is_null = is_null;
 
+      // actual length of the value - strings don't need strlen, and truncation can be detected
+      auto length = static_cast<unsigned long*>(malloc(sizeof(unsigned long)));
+      *length = 0;
+      bind.length = length;
+
       if (fields[i].type == MYSQL_TYPE_TINY) {
         auto p_int8 = static_cast<int8_t*>(malloc(sizeof(int8_t)));
         bind.buffer = p_int8;
@@ -103,7 +397,7 @@ void ResultMapper::ResultData::bindResultsForCache()
         bind.buffer = p_int32;
         bind.buffer_length = 0;
       }
-      else if (fields[i].type == MYSQL_TYPE_LONGLONG || fields[i].type == MYSQL_TYPE_TIMESTAMP2) {
+      else if (fields[i].type == MYSQL_TYPE_LONGLONG) {
         auto p_int64 = static_cast<int64_t*>(malloc(sizeof(int64_t)));
         bind.buffer_type = MYSQL_TYPE_LONGLONG;
         bind.buffer = p_int64;
@@ -119,9 +413,33 @@ void ResultMapper::ResultData::bindResultsForCache()
         bind.buffer = p_double;
         bind.buffer_length = 0;
       }
-      else if (fields[i].type == MYSQL_TYPE_STRING || fields[i].type == MYSQL_TYPE_VAR_STRING || 
-               fields[i].type == MYSQL_TYPE_VARCHAR || fields[i].type == MYSQL_TYPE_DATETIME ||
-               fields[i].type == MYSQL_TYPE_DATE) {
+      else if (TimeCodec::isTemporal(TimeCodec::getBufferType(fields[i].type))) {
+        // dates and times are fetched in binary form - no text formatting and parsing on the server and client
+        auto p_time = static_cast<MYSQL_TIME*>(malloc(sizeof(MYSQL_TIME)));
+        std::memset(p_time, 0, sizeof(MYSQL_TIME));
+        bind.buffer_type = TimeCodec::getBufferType(fields[i].type);
+        bind.buffer = p_time;
+        bind.buffer_length = sizeof(MYSQL_TIME);
+      }
+      else if (fields[i].type == MYSQL_TYPE_DECIMAL || fields[i].type == MYSQL_TYPE_NEWDECIMAL) {
+        // decimals are read as text - exact, and parsed by the deserializers without strtod
+        auto p_decimal = static_cast<char*>(malloc(fields[i].length + 2));
+        bind.buffer_type = MYSQL_TYPE_NEWDECIMAL;
+        bind.buffer = p_decimal;
+        bind.buffer_length = fields[i].length + 2;
+      }
+      else if (fields[i].type == MYSQL_TYPE_TINY_BLOB || fields[i].type == MYSQL_TYPE_BLOB ||
+               fields[i].type == MYSQL_TYPE_MEDIUM_BLOB || fields[i].type == MYSQL_TYPE_LONG_BLOB ||
+               fields[i].type == MYSQL_TYPE_JSON) {
+        // BLOB, TEXT and JSON - don't allocate max column size (up to 4GB), larger values are fetched on demand
+        auto size = std::min<unsigned long>(fields[i].length, MAX_INITIAL_BLOB_BUFFER_SIZE) + 1;
+        auto p_blob = static_cast<char*>(malloc(size));
+        bind.buffer_type = MYSQL_TYPE_BLOB;
+        bind.buffer = p_blob;
+        bind.buffer_length = size;
+      }
+      else if (fields[i].type == MYSQL_TYPE_STRING || fields[i].type == MYSQL_TYPE_VAR_STRING ||
+               fields[i].type == MYSQL_TYPE_VARCHAR) {
         auto p_string = static_cast<char*>(malloc(fields[i].length + 1));
         bind.buffer_type = MYSQL_TYPE_STRING;
         bind.buffer = p_string;
@@ -135,7 +453,9 @@ void ResultMapper::ResultData::bindResultsForCache()
       bindResults.push_back(bind);
     }
 
-    if (mysql_stmt_bind_result(stmt, bindResults.data())) {
+    streamedColumns.assign(colCount, false);
+
+    if (stmt && mysql_stmt_bind_result(stmt, bindResults.data())) {
       throw std::runtime_error("[oatpp::mysql::mapping::ResultMapper::ResultData::ResultData()]: mysql_stmt_bind_result() failed");
     }
   }
@@ -347,6 +667,42 @@ oatpp::Void ResultMapper::readRows(ResultData* dbData, const Type* type, v_int64
 
 }
 
+oatpp::Void ResultMapper::readRowsTyped(ResultData* dbData, const Type* type, v_int64 count) {
+
+  auto id = type->classId.id;
+  if(id != data::type::__class::AbstractVector::CLASS_ID.id &&
+     id != data::type::__class::AbstractList::CLASS_ID.id &&
+     id != data::type::__class::AbstractUnorderedSet::CLASS_ID.id)
+  {
+    return readRows(dbData, type, count);
+  }
+
+  auto dispatcher = static_cast<const data::type::__class::Collection::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+  const Type* itemType = dispatcher->getItemType();
+
+  if(itemType->classId.id != data::type::__class::AbstractObject::CLASS_ID.id) {
+    return readRows(dbData, type, count);
+  }
+
+  auto collection = dispatcher->createObject();
+
+  if(!dbData->hasMore || count == 0) {
+    return collection;
+  }
+
+  DecodePlan plan(&m_deserializer, dbData->colNames, dbData->typeResolver, itemType);
+
+  v_int64 counter = 0;
+  while(dbData->hasMore && (count < 0 || counter < count)) {
+    dispatcher->addItem(collection, plan.decode(dbData->bindResults));
+    ++ dbData->rowIndex;
+    ++ counter;
+    dbData->next();
+  }
+
+  return collection;
+
+}
 
   v_int64 ResultMapper::getKnownCount(ResultData* dbData) const 
   {
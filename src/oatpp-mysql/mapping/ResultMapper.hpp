@@ -1,8 +1,10 @@
 ﻿#ifndef oatpp_mysql_mapping_ResultMapper_hpp
 #define oatpp_mysql_mapping_ResultMapper_hpp
 
+#include "DecodePlan.hpp"
 #include "Deserializer.hpp"
 #include "oatpp/data/mapping/TypeResolver.hpp"
+#include "oatpp/data/stream/Stream.hpp"
 #include "oatpp/Types.hpp"
 
 #ifdef _WIN32
@@ -24,6 +26,24 @@ public:
    */
   struct ResultData {
 
+    /**
+     * Max initial size of the `BLOB`/`TEXT` bind buffer. Larger values are fetched with
+     * `mysql_stmt_fetch_column()` into the grown buffer.
+     */
+    static constexpr unsigned long MAX_INITIAL_BLOB_BUFFER_SIZE = 64 * 1024;
+
+    /**
+     * Default chunk size of &l:ResultMapper::ResultData::streamColumn ();.
+     */
+    static constexpr v_buff_size DEFAULT_STREAM_CHUNK_SIZE = 64 * 1024;
+
+    /**
+     * Check if values of the buffer type are variable-length text or bytes.
+     * @param type
+     * @return
+     */
+    static bool isVariableLength(enum_field_types type);
+
     /**
      * Constructor.
      * @param pStmt
@@ -31,16 +51,37 @@ public:
      */
     ResultData(MYSQL_STMT* pStmt, const std::shared_ptr<const data::mapping::TypeResolver>& pTypeResolver);
 
+    /**
+     * Constructor for the result of the text protocol query (&id:oatpp::mysql::NonBlockingEngine;).
+     * Takes ownership of the result.
+     * @param pTextResults - result of `mysql_store_result`. May be `nullptr` if query has no result set.
+     * @param pTypeResolver
+     */
+    ResultData(MYSQL_RES* pTextResults, const std::shared_ptr<const data::mapping::TypeResolver>& pTypeResolver);
+
+    /**
+     * Constructor of the row view - columns are copied from the source result,
+     * bind buffers are set by the caller and are not owned by the view. <br>
+     * Used to deserialize row images copied out of the source result on other threads.
+     * @param source - result to copy columns from.
+     */
+    explicit ResultData(const ResultData* source);
+
     /**
      * Destructor. Free mysql resources.
      */
     ~ResultData();
 
     /**
-     * mysql statement.
+     * mysql statement. `nullptr` for the result of the text protocol query.
      */
     MYSQL_STMT* stmt;
 
+    /**
+     * Stored result of the text protocol query. `nullptr` for the statement result.
+     */
+    MYSQL_RES* textResults;
+
     /**
      * &id:oatpp::data::mapping::TypeResolver;.
      */
@@ -86,6 +127,22 @@ public:
      */
     MYSQL_RES* metaResults;
 
+    /**
+     * Bind buffers are allocated and freed by this result data.
+     */
+    bool ownsBinds;
+
+    /**
+     * Columns read with &l:ResultMapper::ResultData::streamColumn ();. Their values are never fetched whole -
+     * the bind buffer keeps the prefix which fits it.
+     */
+    std::vector<bool> streamedColumns;
+
+    /**
+     * Current row has values which didn't fit the bind buffers and are not fetched yet.
+     */
+    bool truncated;
+
   public:
 
     /**
@@ -98,11 +155,54 @@ public:
      */
     void next();
 
+    /**
+     * Fetch values of the current row which didn't fit the bind buffers. Values of the streamed columns are skipped. <br>
+     * The first row is fetched by &l:ResultMapper::ResultData::init (); without this step,
+     * so columns can be marked streamed before any value is fetched whole.
+     */
+    void completeRow();
+
+    /**
+     * Write value of the column of the current row to the stream in chunks with `mysql_stmt_fetch_column()`. <br>
+     * The column is marked streamed - its values of the following rows are not fetched whole either.
+     * Memory used is one chunk regardless of the value size. Values of the text protocol result are already in memory
+     * and are written as is.
+     * @param index - column index.
+     * @param stream - &id:oatpp::data::stream::OutputStream;.
+     * @param chunkSize - size of the chunk.
+     * @return - number of bytes written. `0` for null.
+     */
+    v_int64 streamColumn(v_int32 index, data::stream::OutputStream* stream, v_buff_size chunkSize = DEFAULT_STREAM_CHUNK_SIZE);
+
     /**
      * Bind results for cache.
      */
     void bindResultsForCache();
 
+  private:
+
+    /**
+     * Fetch next row into the bind buffers.
+     */
+    void fetchRow();
+
+    /**
+     * Convert text row of the text protocol result to the bind results cache.
+     */
+    void readTextRow();
+
+    /**
+     * Grow the buffer of the variable-length bind. Content is not kept.
+     * @param bind
+     * @param size - new buffer size including the null-terminator.
+     */
+    void growBuffer(MYSQL_BIND& bind, unsigned long size);
+
+    /**
+     * Fetch values which didn't fit the bind buffers of the current statement row.
+     */
+    void fetchTruncatedColumns();
+
   };
 
 private:
@@ -176,6 +276,17 @@ public:
    */
   oatpp::Void readRows(ResultData* dbData, const Type* type, v_int64 count);
 
+  /**
+   * Read `count` of rows to the collection of &id:oatpp::Object; using &id:oatpp::mysql::mapping::DecodePlan;
+   * bound to the result columns once. <br>
+   * Collections of other item types are read with &l:ResultMapper::readRows ();.
+   * @param dbData
+   * @param type
+   * @param count
+   * @return
+   */
+  oatpp::Void readRowsTyped(ResultData* dbData, const Type* type, v_int64 count);
+
   /**
    * Get result entries count in the case it's known.
    * @param dbData
@@ -0,0 +1,245 @@
+#include "RowBatch.hpp"
+#include "DecimalCodec.hpp"
+#include "TimeCodec.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// RowBatch::StringView
+
+bool RowBatch::StringView::equals(const char* str) const {
+  if(data == nullptr || str == nullptr) {
+    return data == str;
+  }
+  return (v_buff_size) std::strlen(str) == size && std::memcmp(data, str, size) == 0;
+}
+
+oatpp::String RowBatch::StringView::toString() const {
+  if(data == nullptr) {
+    return nullptr;
+  }
+  return oatpp::String(data, size);
+}
+
+std::string RowBatch::StringView::toStdString() const {
+  if(data == nullptr) {
+    return std::string();
+  }
+  return std::string(data, size);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// RowBatch::Row
+
+RowBatch::Row::Row(const RowBatch* batch, v_int64 index)
+  : m_batch(batch)
+  , m_index(index)
+{}
+
+bool RowBatch::Row::isNull(v_int32 col) const {
+  return m_batch->m_nulls[m_batch->getValueIndex(m_index, col)] != 0;
+}
+
+v_int64 RowBatch::Row::getInt64(v_int32 col) const {
+
+  auto index = m_batch->getValueIndex(m_index, col);
+  if(m_batch->m_nulls[index]) {
+    return 0;
+  }
+
+  const MYSQL_BIND& bind = m_batch->m_columns[col];
+  const char* value = m_batch->m_arena.data() + m_batch->m_offsets[index];
+
+  switch(bind.buffer_type) {
+    case MYSQL_TYPE_TINY:
+      return bind.is_unsigned ? (v_int64) *reinterpret_cast<const v_uint8*>(value) : *reinterpret_cast<const v_int8*>(value);
+    case MYSQL_TYPE_SHORT:
+      return bind.is_unsigned ? (v_int64) *reinterpret_cast<const v_uint16*>(value) : *reinterpret_cast<const v_int16*>(value);
+    case MYSQL_TYPE_LONG:
+      return bind.is_unsigned ? (v_int64) *reinterpret_cast<const v_uint32*>(value) : *reinterpret_cast<const v_int32*>(value);
+    case MYSQL_TYPE_LONGLONG:
+      return *reinterpret_cast<const v_int64*>(value);
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_TIME:
+      return TimeCodec::toEpochMicros(*reinterpret_cast<const MYSQL_TIME*>(value));
+    default:
+      throw std::runtime_error("[oatpp::mysql::mapping::RowBatch::Row::getInt64()]: Error. "
+                               "Column '" + *m_batch->m_colNames[col] + "' is not an integer column.");
+  }
+
+}
+
+v_float64 RowBatch::Row::getFloat64(v_int32 col) const {
+
+  auto index = m_batch->getValueIndex(m_index, col);
+  if(m_batch->m_nulls[index]) {
+    return 0;
+  }
+
+  const MYSQL_BIND& bind = m_batch->m_columns[col];
+  const char* value = m_batch->m_arena.data() + m_batch->m_offsets[index];
+
+  switch(bind.buffer_type) {
+    case MYSQL_TYPE_FLOAT:
+      return *reinterpret_cast<const v_float32*>(value);
+    case MYSQL_TYPE_DOUBLE:
+      return *reinterpret_cast<const v_float64*>(value);
+    case MYSQL_TYPE_NEWDECIMAL:
+      return DecimalCodec::toFloat64(value, (v_buff_size) m_batch->m_lengths[index]);
+    default:
+      throw std::runtime_error("[oatpp::mysql::mapping::RowBatch::Row::getFloat64()]: Error. "
+                               "Column '" + *m_batch->m_colNames[col] + "' is not a floating point column.");
+  }
+
+}
+
+RowBatch::StringView RowBatch::Row::getString(v_int32 col) const {
+
+  auto index = m_batch->getValueIndex(m_index, col);
+
+  StringView view;
+  if(m_batch->m_nulls[index]) {
+    view.data = nullptr;
+    view.size = 0;
+  } else {
+    view.data = m_batch->m_arena.data() + m_batch->m_offsets[index];
+    view.size = (v_buff_size) m_batch->m_lengths[index];
+  }
+  return view;
+
+}
+
+oatpp::Void RowBatch::Row::get(v_int32 col, const Type* type) const {
+
+  auto index = m_batch->getValueIndex(m_index, col);
+
+  // deserializers clear the buffer after read - give them a copy of the value
+  std::vector<char> buffer(m_batch->m_arena.data() + m_batch->m_offsets[index],
+                           m_batch->m_arena.data() + m_batch->m_offsets[index] + m_batch->m_lengths[index]);
+  buffer.resize(std::max<size_t>(buffer.size() + 1, sizeof(v_int64)), 0);
+
+  bool isNull = m_batch->m_nulls[index] != 0;
+  unsigned long length = m_batch->m_lengths[index];
+
+  MYSQL_BIND bind = m_batch->m_columns[col];
+  bind.buffer = buffer.data();
+  bind.buffer_length = buffer.size();
+  bind.is_null = &isNull;
+  bind.length = &length;
+
+  Deserializer::InData inData(&bind, m_batch->m_typeResolver);
+  return m_batch->m_deserializer.deserialize(inData, type);
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// RowBatch
+
+RowBatch::RowBatch()
+  : m_rowsCount(0)
+{}
+
+v_buff_size RowBatch::getFixedSize(enum_field_types bufferType) {
+  switch(bufferType) {
+    case MYSQL_TYPE_TINY: return sizeof(v_int8);
+    case MYSQL_TYPE_SHORT: return sizeof(v_int16);
+    case MYSQL_TYPE_LONG: return sizeof(v_int32);
+    case MYSQL_TYPE_LONGLONG: return sizeof(v_int64);
+    case MYSQL_TYPE_FLOAT: return sizeof(v_float32);
+    case MYSQL_TYPE_DOUBLE: return sizeof(v_float64);
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_TIME: return sizeof(MYSQL_TIME);
+    default:
+      return 0;
+  }
+}
+
+v_int64 RowBatch::getValueIndex(v_int64 row, v_int32 col) const {
+  if(row < 0 || row >= m_rowsCount || col < 0 || col >= (v_int32) m_columns.size()) {
+    throw std::runtime_error("[oatpp::mysql::mapping::RowBatch::getValueIndex()]: Error. Index out of bounds.");
+  }
+  return row * m_columns.size() + col;
+}
+
+void RowBatch::readRow(const ResultMapper::ResultData* dbData) {
+
+  for(v_int32 i = 0; i < dbData->colCount; i ++) {
+
+    const MYSQL_BIND& bind = dbData->bindResults[i];
+    auto fixedSize = getFixedSize(bind.buffer_type);
+
+    m_nulls.push_back(*bind.is_null == 1 ? 1 : 0);
+
+    if(fixedSize > 0) {
+      // keep numbers aligned - they are read in place
+      v_buff_size offset = (m_arena.size() + 7) & ~((v_buff_size) 7);
+      m_arena.resize(offset + fixedSize);
+      std::memcpy(m_arena.data() + offset, bind.buffer, fixedSize);
+      m_offsets.push_back(offset);
+      m_lengths.push_back((unsigned long) fixedSize);
+    } else {
+      unsigned long size = std::min(*bind.length, bind.buffer_length - 1);
+      v_buff_size offset = m_arena.size();
+      m_arena.insert(m_arena.end(), static_cast<const char*>(bind.buffer), static_cast<const char*>(bind.buffer) + size);
+      m_offsets.push_back(offset);
+      m_lengths.push_back(size);
+    }
+
+  }
+
+  m_rowsCount ++;
+
+}
+
+v_int64 RowBatch::read(ResultMapper::ResultData* dbData, v_int64 count) {
+
+  // only types of columns are used - buffers of the result binds are not accessed through m_columns
+  m_typeResolver = dbData->typeResolver;
+  m_colNames = dbData->colNames;
+  m_columns = dbData->bindResults;
+
+  m_arena.clear();
+  m_offsets.clear();
+  m_lengths.clear();
+  m_nulls.clear();
+  m_rowsCount = 0;
+
+  while(dbData->hasMore && (count < 0 || m_rowsCount < count)) {
+    readRow(dbData);
+    ++ dbData->rowIndex;
+    dbData->next();
+  }
+
+  return m_rowsCount;
+
+}
+
+v_int64 RowBatch::getRowsCount() const {
+  return m_rowsCount;
+}
+
+RowBatch::Row RowBatch::getRow(v_int64 index) const {
+  return Row(this, index);
+}
+
+v_int32 RowBatch::getColumnsCount() const {
+  return (v_int32) m_columns.size();
+}
+
+v_int32 RowBatch::getColumnIndex(const oatpp::String& name) const {
+  for(v_int32 i = 0; i < (v_int32) m_colNames.size(); i ++) {
+    if(m_colNames[i] == name) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+}}}
@@ -0,0 +1,178 @@
+#ifndef oatpp_mysql_mapping_RowBatch_hpp
+#define oatpp_mysql_mapping_RowBatch_hpp
+
+#include "ResultMapper.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+/**
+ * Reusable batch of rows with values stored in one arena. <br>
+ * Rows are read without creating oatpp objects - values are accessed through &l:RowBatch::Row; views
+ * which point to the arena and stay valid until the next &l:RowBatch::read (); call.
+ * Selected values can be converted to oatpp types on demand with &l:RowBatch::Row::get ();.
+ */
+class RowBatch {
+public:
+  typedef oatpp::data::type::Type Type;
+public:
+
+  /**
+   * Non-owning view of the string value in the batch arena. Not null-terminated.
+   */
+  struct StringView {
+
+    /**
+     * Pointer to the first char. `nullptr` for null value.
+     */
+    const char* data;
+
+    /**
+     * Size in bytes.
+     */
+    v_buff_size size;
+
+    /**
+     * Compare with string.
+     * @param str
+     * @return
+     */
+    bool equals(const char* str) const;
+
+    /**
+     * Copy value to &id:oatpp::String;.
+     * @return - &id:oatpp::String;. `nullptr` for null value.
+     */
+    oatpp::String toString() const;
+
+    /**
+     * Copy value to `std::string`.
+     * @return
+     */
+    std::string toStdString() const;
+
+  };
+
+  /**
+   * View of one row in the batch. Valid until the next &l:RowBatch::read (); call.
+   */
+  class Row {
+  private:
+    const RowBatch* m_batch;
+    v_int64 m_index;
+  public:
+
+    Row(const RowBatch* batch, v_int64 index);
+
+    /**
+     * Check if value is null.
+     * @param col - column index.
+     * @return
+     */
+    bool isNull(v_int32 col) const;
+
+    /**
+     * Get value of the integer column. Date and time columns - microseconds since the Unix epoch.
+     * @param col - column index.
+     * @return - value. `0` for null.
+     */
+    v_int64 getInt64(v_int32 col) const;
+
+    /**
+     * Get value of the floating point or `DECIMAL` column.
+     * @param col - column index.
+     * @return - value. `0` for null.
+     */
+    v_float64 getFloat64(v_int32 col) const;
+
+    /**
+     * Get view of the string column.
+     * @param col - column index.
+     * @return - &l:RowBatch::StringView;.
+     */
+    StringView getString(v_int32 col) const;
+
+    /**
+     * Convert value to oatpp type. Same conversion as for fetched DTO fields.
+     * @param col - column index.
+     * @param type - value type.
+     * @return
+     */
+    oatpp::Void get(v_int32 col, const Type* type) const;
+
+    /**
+     * Convert value to `Wrapper`.
+     * @tparam Wrapper - value type.
+     * @param col - column index.
+     * @return
+     */
+    template<class Wrapper>
+    Wrapper get(v_int32 col) const {
+      return get(col, Wrapper::Class::getType()).template cast<Wrapper>();
+    }
+
+  };
+
+private:
+  static v_buff_size getFixedSize(enum_field_types bufferType);
+private:
+  Deserializer m_deserializer;
+  std::shared_ptr<const data::mapping::TypeResolver> m_typeResolver;
+  std::vector<oatpp::String> m_colNames;
+  std::vector<MYSQL_BIND> m_columns;
+  std::vector<char> m_arena;
+  std::vector<v_buff_size> m_offsets;
+  std::vector<unsigned long> m_lengths;
+  std::vector<v_uint8> m_nulls;
+  v_int64 m_rowsCount;
+private:
+  void readRow(const ResultMapper::ResultData* dbData);
+  v_int64 getValueIndex(v_int64 row, v_int32 col) const;
+public:
+
+  /**
+   * Default constructor.
+   */
+  RowBatch();
+
+  /**
+   * Replace rows of the batch with the next `count` rows of the result. Arena memory is reused. <br>
+   * Row views of the previous batch are invalidated.
+   * @param dbData - result positioned at the first row to read.
+   * @param count - max number of rows to read. `-1` - read all remaining rows.
+   * @return - number of rows read.
+   */
+  v_int64 read(ResultMapper::ResultData* dbData, v_int64 count);
+
+  /**
+   * Get number of rows in the batch.
+   * @return
+   */
+  v_int64 getRowsCount() const;
+
+  /**
+   * Get row view.
+   * @param index - row index in the batch.
+   * @return - &l:RowBatch::Row;.
+   */
+  Row getRow(v_int64 index) const;
+
+  /**
+   * Get number of columns.
+   * @return
+   */
+  v_int32 getColumnsCount() const;
+
+  /**
+   * Get index of the column by name.
+   * @param name - column name.
+   * @return - column index. `-1` if there is no such column.
+   */
+  v_int32 getColumnIndex(const oatpp::String& name) const;
+
+};
+
+}}}
+
+#endif // oatpp_mysql_mapping_RowBatch_hpp
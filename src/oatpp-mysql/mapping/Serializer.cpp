@@ -23,11 +23,18 @@
  ***************************************************************************/
 
 #include "Serializer.hpp"
+#include "DecimalCodec.hpp"
+#include "EnumCodec.hpp"
+#include "TimeCodec.hpp"
+
+#include "oatpp-mysql/Types.hpp"
 #include "oatpp/base/Log.hpp"
 
 
 namespace oatpp { namespace mysql { namespace mapping {
 
+constexpr v_buff_size Serializer::LONG_DATA_CHUNK_SIZE;
+
 Serializer::Serializer() {
 
   m_methods.resize(data::type::ClassId::getClassCount(), nullptr);
@@ -51,6 +58,12 @@ Serializer::Serializer() {
   setSerializerMethod(data::type::__class::Float32::CLASS_ID, &Serializer::serializeFloat32);
   setSerializerMethod(data::type::__class::Float64::CLASS_ID, &Serializer::serializeFloat64);
 
+  setSerializerMethod(mysql::__class::Timestamp::CLASS_ID, &Serializer::serializeTimestamp);
+  setSerializerMethod(mysql::__class::Decimal::CLASS_ID, &Serializer::serializeDecimal);
+  setSerializerMethod(mysql::__class::BlobStream::CLASS_ID, &Serializer::serializeBlobStream);
+  setSerializerMethod(mysql::__class::Uuid::CLASS_ID, &Serializer::serializeUuid);
+  setSerializerMethod(mysql::__class::AbstractEnumSet::CLASS_ID, &Serializer::serializeEnumSet);
+
   setSerializerMethod(data::type::__class::AbstractObject::CLASS_ID, nullptr);
   setSerializerMethod(data::type::__class::AbstractEnum::CLASS_ID, &Serializer::serializeEnum);
 
@@ -89,6 +102,7 @@ void Serializer::serialize(MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::V
     id, polymorph.getValueType()->classId.name, paramIndex, method);
 
   if(method) {
+    m_values.push_back(polymorph);
     (*method)(this, stmt, paramIndex, polymorph);
   } else {
     throw std::runtime_error("[oatpp::mysql::mapping::Serializer::serialize()]: "
@@ -101,6 +115,45 @@ std::vector<MYSQL_BIND>& Serializer::getBindParams() const {
   return m_bindParams;
 }
 
+void Serializer::sendLongData(MYSQL_STMT* stmt) const {
+
+  if(m_longData.empty()) {
+    return;
+  }
+
+  // one chunk in memory at a time
+  std::unique_ptr<char[]> buffer(new char[LONG_DATA_CHUNK_SIZE]);
+
+  for(auto& longData : m_longData) {
+
+    while(true) {
+
+      auto res = longData.stream->readSimple(buffer.get(), LONG_DATA_CHUNK_SIZE);
+
+      if(res == IOError::RETRY_READ || res == IOError::RETRY_WRITE) {
+        continue;
+      }
+
+      if(res < 0) {
+        throw std::runtime_error("[oatpp::mysql::mapping::Serializer::sendLongData()]: Error. "
+                                 "Can't read stream of the parameter " + std::to_string(longData.paramIndex) + ".");
+      }
+
+      if(res == 0) {
+        break;
+      }
+
+      if(mysql_stmt_send_long_data(stmt, longData.paramIndex, buffer.get(), static_cast<unsigned long>(res))) {
+        throw std::runtime_error("[oatpp::mysql::mapping::Serializer::sendLongData()]: Error. "
+                                 "mysql_stmt_send_long_data() failed: " + std::string(mysql_stmt_error(stmt)));
+      }
+
+    }
+
+  }
+
+}
+
 void Serializer::setBindParam(MYSQL_BIND& bind, v_uint32 paramIndex) const {
   if (paramIndex >= m_bindParams.size()) {
     m_bindParams.resize(paramIndex + 1);
@@ -184,6 +237,7 @@ void Serializer::serializeUInt8(const Serializer* _this, MYSQL_STMT* stmt, v_uin
     bindParam.buffer = v.get();
     bindParam.buffer_length = 0;
     bindParam.is_null = 0;
+    bindParam.is_unsigned = true;
   } else {
     bindParam.is_null = static_cast<bool*>(malloc(sizeof(bool)));
     *bindParam.is_null = 1;
@@ -222,6 +276,7 @@ void Serializer::serializeUInt16(const Serializer* _this, MYSQL_STMT* stmt, v_ui
     bindParam.buffer = v.get();
     bindParam.buffer_length = 0;
     bindParam.is_null = 0;
+    bindParam.is_unsigned = true;
   } else {
     bindParam.is_null = static_cast<bool*>(malloc(sizeof(bool)));
     *bindParam.is_null = 1;
@@ -260,6 +315,7 @@ void Serializer::serializeUInt32(const Serializer* _this, MYSQL_STMT* stmt, v_ui
     bindParam.buffer = v.get();
     bindParam.buffer_length = 0;
     bindParam.is_null = 0;
+    bindParam.is_unsigned = true;
   } else {
     bindParam.is_null = static_cast<bool*>(malloc(sizeof(bool)));
     *bindParam.is_null = 1;
@@ -298,6 +354,7 @@ void Serializer::serializeUInt64(const Serializer* _this, MYSQL_STMT* stmt, v_ui
     bindParam.buffer = v.get();
     bindParam.buffer_length = 0;
     bindParam.is_null = 0;
+    bindParam.is_unsigned = true;
   } else {
     bindParam.is_null = static_cast<bool*>(malloc(sizeof(bool)));
     *bindParam.is_null = 1;
@@ -344,6 +401,133 @@ void Serializer::serializeFloat64(const Serializer* _this, MYSQL_STMT* stmt, v_u
   _this->setBindParam(bindParam, paramIndex);
 }
 
+void Serializer::serializeBlobStream(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph) {
+  MYSQL_BIND bindParam;
+  std::memset(&bindParam, 0, sizeof(bindParam));
+  bindParam.buffer_type = MYSQL_TYPE_LONG_BLOB;
+
+  if(polymorph) {
+    auto v = polymorph.cast<mysql::BlobStream>();
+
+    // no buffer - the value is sent with mysql_stmt_send_long_data()
+    bindParam.buffer = nullptr;
+    bindParam.buffer_length = 0;
+    bindParam.is_null = 0;
+
+    _this->m_longData.push_back({paramIndex, v.getPtr()});
+  } else {
+    bindParam.is_null = static_cast<bool*>(malloc(sizeof(bool)));
+    *bindParam.is_null = 1;
+  }
+
+  _this->setBindParam(bindParam, paramIndex);
+}
+
+void Serializer::serializeDecimal(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph) {
+  MYSQL_BIND bindParam;
+  std::memset(&bindParam, 0, sizeof(bindParam));
+  bindParam.buffer_type = MYSQL_TYPE_NEWDECIMAL;
+
+  if(polymorph) {
+    auto v = polymorph.cast<mysql::Decimal>();
+    const DecimalValue& value = *static_cast<DecimalValue*>(v.get());
+
+    if(value.scale < 0 || value.scale > DecimalCodec::MAX_SCALE) {
+      throw std::runtime_error("[oatpp::mysql::mapping::Serializer::serializeDecimal()]: Error. "
+                               "Invalid scale " + std::to_string(value.scale) + ".");
+    }
+
+    // exact decimal text - the server converts it to the column scale without going through double
+    char buffer[DecimalCodec::MAX_TEXT_SIZE];
+    auto size = DecimalCodec::format(value.unscaled, value.scale, buffer);
+    _this->m_texts.emplace_back(buffer, size);
+    auto& text = _this->m_texts.back();
+
+    bindParam.buffer = static_cast<void*>(const_cast<char*>(text.data()));
+    bindParam.buffer_length = static_cast<unsigned long>(text.size());
+    bindParam.is_null = 0;
+  } else {
+    bindParam.is_null = static_cast<bool*>(malloc(sizeof(bool)));
+    *bindParam.is_null = 1;
+  }
+
+  _this->setBindParam(bindParam, paramIndex);
+}
+
+void Serializer::serializeTimestamp(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph) {
+  MYSQL_BIND bindParam;
+  std::memset(&bindParam, 0, sizeof(bindParam));
+  bindParam.buffer_type = MYSQL_TYPE_DATETIME;
+
+  if(polymorph) {
+    auto v = polymorph.cast<mysql::Timestamp>();
+
+    // sent as binary MYSQL_TIME - the server doesn't parse text
+    _this->m_times.emplace_back();
+    auto& time = _this->m_times.back();
+    TimeCodec::fromEpochMicros(*v, MYSQL_TIMESTAMP_DATETIME, time);
+
+    bindParam.buffer = &time;
+    bindParam.buffer_length = sizeof(MYSQL_TIME);
+    bindParam.is_null = 0;
+  } else {
+    bindParam.is_null = static_cast<bool*>(malloc(sizeof(bool)));
+    *bindParam.is_null = 1;
+  }
+
+  _this->setBindParam(bindParam, paramIndex);
+}
+
+void Serializer::serializeUuid(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph) {
+  MYSQL_BIND bindParam;
+  std::memset(&bindParam, 0, sizeof(bindParam));
+  bindParam.buffer_type = MYSQL_TYPE_BLOB;
+
+  if(polymorph) {
+    // raw bytes of the value - it's kept alive by the params till the statement is executed
+    auto value = static_cast<UuidValue*>(polymorph.get());
+    bindParam.buffer = value->bytes;
+    bindParam.buffer_length = sizeof(value->bytes);
+    bindParam.is_null = 0;
+  } else {
+    bindParam.is_null = static_cast<bool*>(malloc(sizeof(bool)));
+    *bindParam.is_null = 1;
+  }
+
+  _this->setBindParam(bindParam, paramIndex);
+}
+
+void Serializer::serializeEnumSet(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph) {
+  MYSQL_BIND bindParam;
+  std::memset(&bindParam, 0, sizeof(bindParam));
+  bindParam.buffer_type = MYSQL_TYPE_STRING;
+
+  if(polymorph) {
+    auto codec = EnumCodec::get(polymorph.getValueType()->params.front());
+    if(codec == nullptr) {
+      throw std::runtime_error("[oatpp::mysql::mapping::Serializer::serializeEnumSet()]: Error. "
+                               "Enum of the set must be interpreted as string.");
+    }
+
+    // comma-separated member names - the server maps them to the column bits
+    _this->m_texts.emplace_back();
+    auto& text = _this->m_texts.back();
+    if(!codec->formatSet(*static_cast<v_uint64*>(polymorph.get()), text)) {
+      throw std::runtime_error("[oatpp::mysql::mapping::Serializer::serializeEnumSet()]: Error. "
+                               "Mask has bits of unknown members.");
+    }
+
+    bindParam.buffer = static_cast<void*>(const_cast<char*>(text.data()));
+    bindParam.buffer_length = static_cast<unsigned long>(text.size());
+    bindParam.is_null = 0;
+  } else {
+    bindParam.is_null = static_cast<bool*>(malloc(sizeof(bool)));
+    *bindParam.is_null = 1;
+  }
+
+  _this->setBindParam(bindParam, paramIndex);
+}
+
 void Serializer::serializeEnum(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph) {
 
   auto polymorphicDispatcher = static_cast<const data::type::__class::AbstractEnum::PolymorphicDispatcher*>(
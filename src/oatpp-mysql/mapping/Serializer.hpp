@@ -1,7 +1,11 @@
 ﻿#ifndef oatpp_mysql_mapping_Serializer_hpp
 #define oatpp_mysql_mapping_Serializer_hpp
 
+#include "oatpp/data/stream/Stream.hpp"
 #include "oatpp/Types.hpp"
+
+#include <list>
+
 #ifdef _WIN32
     #include "mysql.h"
 #else
@@ -16,9 +20,38 @@ namespace oatpp { namespace mysql { namespace mapping {
 class Serializer {
 public:
   typedef void (*SerializerMethod)(const Serializer*, MYSQL_STMT*, v_uint32, const oatpp::Void&);
+public:
+
+  /**
+   * Size of the chunk sent with `mysql_stmt_send_long_data()`.
+   */
+  static constexpr v_buff_size LONG_DATA_CHUNK_SIZE = 64 * 1024;
+
+private:
+
+  struct LongData {
+    v_uint32 paramIndex;
+    std::shared_ptr<data::stream::InputStream> stream;
+  };
+
 private:
   std::vector<SerializerMethod> m_methods;
   mutable std::vector<MYSQL_BIND> m_bindParams;
+  /*
+   * Serialized values. MYSQL_BIND buffers point to the memory of these values,
+   * so they are kept alive until the statement is executed.
+   */
+  mutable std::vector<oatpp::Void> m_values;
+  /*
+   * Values converted from oatpp values (MYSQL_TIME of Timestamp, text of Decimal and EnumSet).
+   * std::list - pointers stay valid while new values are added.
+   */
+  mutable std::list<MYSQL_TIME> m_times;
+  mutable std::list<std::string> m_texts;
+  /*
+   * Parameters sent with mysql_stmt_send_long_data() after the binds are set.
+   */
+  mutable std::vector<LongData> m_longData;
 public:
 
   Serializer();
@@ -31,6 +64,13 @@ public:
 
   std::vector<MYSQL_BIND>& getBindParams() const;
 
+  /**
+   * Upload streamed parameters (&id:oatpp::mysql::BlobStream;).
+   * Call after `mysql_stmt_bind_param()` and before `mysql_stmt_execute()`.
+   * @param stmt
+   */
+  void sendLongData(MYSQL_STMT* stmt) const;
+
 private:
 
   void setBindParam(MYSQL_BIND& bind, v_uint32 paramIndex) const;
@@ -61,8 +101,18 @@ private:
 
   static void serializeFloat64(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph);
 
+  static void serializeBlobStream(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph);
+
+  static void serializeDecimal(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph);
+
+  static void serializeTimestamp(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph);
+
   static void serializeEnum(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph);
 
+  static void serializeEnumSet(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph);
+
+  static void serializeUuid(const Serializer* _this, MYSQL_STMT* stmt, v_uint32 paramIndex, const oatpp::Void& polymorph);
+
 };
 
 }}}
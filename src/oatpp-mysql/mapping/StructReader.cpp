@@ -0,0 +1,375 @@
+#include "StructReader.hpp"
+#include "DecimalCodec.hpp"
+#include "TimeCodec.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+StructReader::StructReader(const std::vector<Member>& members)
+  : m_members(members)
+{}
+
+enum_field_types StructReader::getBufferType(MemberType type, bool& isUnsigned) {
+  isUnsigned = (type == MemberType::UINT8 || type == MemberType::UINT16 ||
+                type == MemberType::UINT32 || type == MemberType::UINT64);
+  switch(type) {
+    case MemberType::INT8:
+    case MemberType::UINT8: return MYSQL_TYPE_TINY;
+    case MemberType::INT16:
+    case MemberType::UINT16: return MYSQL_TYPE_SHORT;
+    case MemberType::INT32:
+    case MemberType::UINT32: return MYSQL_TYPE_LONG;
+    case MemberType::INT64:
+    case MemberType::UINT64: return MYSQL_TYPE_LONGLONG;
+    case MemberType::FLOAT32: return MYSQL_TYPE_FLOAT;
+    case MemberType::FLOAT64: return MYSQL_TYPE_DOUBLE;
+    default:
+      return MYSQL_TYPE_STRING;
+  }
+}
+
+v_buff_size StructReader::getMemberSize(MemberType type) {
+  switch(type) {
+    case MemberType::INT8:
+    case MemberType::UINT8: return sizeof(v_int8);
+    case MemberType::INT16:
+    case MemberType::UINT16: return sizeof(v_int16);
+    case MemberType::INT32:
+    case MemberType::UINT32: return sizeof(v_int32);
+    case MemberType::FLOAT32: return sizeof(v_float32);
+    case MemberType::STRING: return sizeof(StringRef);
+    default:
+      return sizeof(v_int64);
+  }
+}
+
+void StructReader::writeNull(const Member& member, char* row) {
+  if(member.type == MemberType::STRING) {
+    StringRef ref {0, -1};
+    std::memcpy(row + member.offset, &ref, sizeof(StringRef));
+    return;
+  }
+  bool isUnsigned;
+  switch(getBufferType(member.type, isUnsigned)) {
+    case MYSQL_TYPE_TINY: std::memset(row + member.offset, 0, sizeof(v_int8)); break;
+    case MYSQL_TYPE_SHORT: std::memset(row + member.offset, 0, sizeof(v_int16)); break;
+    case MYSQL_TYPE_LONG: std::memset(row + member.offset, 0, sizeof(v_int32)); break;
+    case MYSQL_TYPE_FLOAT: std::memset(row + member.offset, 0, sizeof(v_float32)); break;
+    default:
+      std::memset(row + member.offset, 0, sizeof(v_int64));
+  }
+}
+
+void StructReader::writeValue(const Member& member, const MYSQL_BIND& bind, char* row, std::vector<char>& arena) {
+
+  if(*bind.is_null == 1) {
+    writeNull(member, row);
+    return;
+  }
+
+  bool isString = false;
+  bool isTime = false;
+  v_int64 intValue = 0;
+  v_float64 floatValue = 0;
+  const char* str = static_cast<const char*>(bind.buffer);
+  unsigned long strSize = 0;
+
+  switch(bind.buffer_type) {
+    case MYSQL_TYPE_TINY:
+      intValue = bind.is_unsigned ? (v_int64) *static_cast<v_uint8*>(bind.buffer) : *static_cast<v_int8*>(bind.buffer);
+      floatValue = (v_float64) intValue;
+      break;
+    case MYSQL_TYPE_SHORT:
+      intValue = bind.is_unsigned ? (v_int64) *static_cast<v_uint16*>(bind.buffer) : *static_cast<v_int16*>(bind.buffer);
+      floatValue = (v_float64) intValue;
+      break;
+    case MYSQL_TYPE_LONG:
+      intValue = bind.is_unsigned ? (v_int64) *static_cast<v_uint32*>(bind.buffer) : *static_cast<v_int32*>(bind.buffer);
+      floatValue = (v_float64) intValue;
+      break;
+    case MYSQL_TYPE_LONGLONG:
+      intValue = *static_cast<v_int64*>(bind.buffer);
+      floatValue = bind.is_unsigned ? (v_float64) (v_uint64) intValue : (v_float64) intValue;
+      break;
+    case MYSQL_TYPE_FLOAT:
+      floatValue = *static_cast<v_float32*>(bind.buffer);
+      intValue = (v_int64) floatValue;
+      break;
+    case MYSQL_TYPE_DOUBLE:
+      floatValue = *static_cast<v_float64*>(bind.buffer);
+      intValue = (v_int64) floatValue;
+      break;
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_TIME:
+      isTime = true;
+      intValue = TimeCodec::toEpochMicros(*static_cast<const MYSQL_TIME*>(bind.buffer));
+      floatValue = (v_float64) intValue;
+      break;
+    default:
+      isString = true;
+      strSize = std::min(*bind.length, bind.buffer_length - 1);
+  }
+
+  char* dst = row + member.offset;
+
+  if(member.type == MemberType::STRING) {
+    StringRef ref;
+    ref.offset = arena.size();
+    if(isString) {
+      arena.insert(arena.end(), str, str + strSize);
+    } else if(isTime) {
+      char text[TimeCodec::MAX_TEXT_SIZE];
+      auto size = TimeCodec::format(*static_cast<const MYSQL_TIME*>(bind.buffer), text);
+      arena.insert(arena.end(), text, text + size);
+    } else {
+      auto text = (bind.buffer_type == MYSQL_TYPE_FLOAT || bind.buffer_type == MYSQL_TYPE_DOUBLE)
+                  ? std::to_string(floatValue) : std::to_string(intValue);
+      arena.insert(arena.end(), text.begin(), text.end());
+    }
+    ref.size = arena.size() - ref.offset;
+    std::memcpy(dst, &ref, sizeof(StringRef));
+    return;
+  }
+
+  if(isString) {
+    // str is null-terminated in the result bind buffer
+    if(member.type == MemberType::FLOAT32 || member.type == MemberType::FLOAT64) {
+      floatValue = DecimalCodec::toFloat64(str, strSize);
+    } else {
+      intValue = (v_int64) std::strtoll(str, nullptr, 10);
+    }
+  }
+
+  switch(member.type) {
+    case MemberType::INT8: { v_int8 v = (v_int8) intValue; std::memcpy(dst, &v, sizeof(v)); break; }
+    case MemberType::UINT8: { v_uint8 v = (v_uint8) intValue; std::memcpy(dst, &v, sizeof(v)); break; }
+    case MemberType::INT16: { v_int16 v = (v_int16) intValue; std::memcpy(dst, &v, sizeof(v)); break; }
+    case MemberType::UINT16: { v_uint16 v = (v_uint16) intValue; std::memcpy(dst, &v, sizeof(v)); break; }
+    case MemberType::INT32: { v_int32 v = (v_int32) intValue; std::memcpy(dst, &v, sizeof(v)); break; }
+    case MemberType::UINT32: { v_uint32 v = (v_uint32) intValue; std::memcpy(dst, &v, sizeof(v)); break; }
+    case MemberType::INT64: { std::memcpy(dst, &intValue, sizeof(intValue)); break; }
+    case MemberType::UINT64: { v_uint64 v = (v_uint64) intValue; std::memcpy(dst, &v, sizeof(v)); break; }
+    case MemberType::FLOAT32: { v_float32 v = (v_float32) floatValue; std::memcpy(dst, &v, sizeof(v)); break; }
+    case MemberType::FLOAT64: { std::memcpy(dst, &floatValue, sizeof(floatValue)); break; }
+    default:
+      break;
+  }
+
+}
+
+std::vector<v_int32> StructReader::resolveColumns(const ResultMapper::ResultData* dbData) const {
+  std::vector<v_int32> columns;
+  columns.reserve(m_members.size());
+  for(auto& member : m_members) {
+    auto it = dbData->colIndices.find(oatpp::String(member.column));
+    if(it == dbData->colIndices.end()) {
+      throw std::runtime_error("[oatpp::mysql::mapping::StructReader::resolveColumns()]: Error. "
+                               "No column to map member '" + std::string(member.column) + "'.");
+    }
+    columns.push_back(it->second);
+  }
+  return columns;
+}
+
+void StructReader::copyRow(const ResultMapper::ResultData* dbData, const std::vector<v_int32>& columns, char* row) {
+  for(size_t i = 0; i < m_members.size(); i ++) {
+    writeValue(m_members[i], dbData->bindResults[columns[i]], row, m_arena);
+  }
+}
+
+void StructReader::fetchRemainder(MYSQL_STMT* stmt, v_int32 col, unsigned long length, StringRef& ref) {
+
+  // value didn't fit the scratch buffer - fetch the rest straight to the arena
+  unsigned long remainderLength = 0;
+  bool isNull = false;
+
+  MYSQL_BIND bind;
+  std::memset(&bind, 0, sizeof(MYSQL_BIND));
+  bind.buffer_type = MYSQL_TYPE_STRING;
+  bind.is_null = &isNull;
+  bind.length = &remainderLength;
+
+  m_arena.resize(ref.offset + length);
+  bind.buffer = m_arena.data() + ref.offset + ref.size;
+  bind.buffer_length = length - ref.size;
+
+  if(mysql_stmt_fetch_column(stmt, &bind, col, (unsigned long) ref.size)) {
+    throw std::runtime_error("[oatpp::mysql::mapping::StructReader::fetchRemainder()]: Error. "
+                             "mysql_stmt_fetch_column() failed: " + std::string(mysql_stmt_error(stmt)));
+  }
+
+  ref.size = length;
+
+}
+
+v_int64 StructReader::readStatementRows(ResultMapper::ResultData* dbData, const std::vector<v_int32>& columns,
+                                        char* rows, v_buff_size stride, v_int64 capacity)
+{
+
+  // binds of the columns without members are skipped by the client library
+  std::vector<MYSQL_BIND> binds(dbData->colCount);
+  std::unique_ptr<bool[]> nulls(new bool[dbData->colCount + 1]);
+  std::vector<unsigned long> lengths(dbData->colCount, 0);
+  std::vector<std::vector<char>> scratch(dbData->colCount);
+  // members read to the scratch buffer and converted with writeValue()
+  std::vector<bool> converted(m_members.size(), false);
+  // fixed-size members are fetched to the staging row and copied to the caller's struct -
+  // binds point to the same memory for every row, so they are bound once per call, not per row
+  std::vector<char> staging(stride);
+
+  for(v_int32 i = 0; i < dbData->colCount; i ++) {
+    std::memset(&binds[i], 0, sizeof(MYSQL_BIND));
+    binds[i].buffer_type = MYSQL_TYPE_NULL;
+    binds[i].is_null = &nulls[i];
+    binds[i].length = &lengths[i];
+  }
+
+  for(size_t i = 0; i < m_members.size(); i ++) {
+    MYSQL_BIND& bind = binds[columns[i]];
+    const MYSQL_BIND& source = dbData->bindResults[columns[i]];
+    if(TimeCodec::isTemporal(source.buffer_type)) {
+      // dates are read as MYSQL_TIME - the client library would convert them to YYYYMMDDhhmmss numbers
+      auto& buffer = scratch[columns[i]];
+      buffer.resize(sizeof(MYSQL_TIME));
+      bind.buffer_type = source.buffer_type;
+      bind.buffer = buffer.data();
+      bind.buffer_length = buffer.size();
+      converted[i] = true;
+    } else if(m_members[i].type == MemberType::STRING) {
+      // variable-length values are read to the scratch buffer and appended to the arena
+      auto& buffer = scratch[columns[i]];
+      // numeric columns have no buffer in the result binds - enough room for the number text
+      buffer.resize(std::max<unsigned long>(source.buffer_length, 64));
+      bind.buffer_type = MYSQL_TYPE_STRING;
+      bind.buffer = buffer.data();
+      bind.buffer_length = buffer.size();
+    } else {
+      bool isUnsigned;
+      bind.buffer_type = getBufferType(m_members[i].type, isUnsigned);
+      bind.is_unsigned = isUnsigned;
+      bind.buffer = staging.data() + m_members[i].offset;
+    }
+  }
+
+  v_int64 rowsRead = 0;
+  bool hasMore = true;
+
+  if(mysql_stmt_bind_result(dbData->stmt, binds.data())) {
+    mysql_stmt_bind_result(dbData->stmt, dbData->bindResults.data());
+    throw std::runtime_error("[oatpp::mysql::mapping::StructReader::readStatementRows()]: Error. "
+                             "mysql_stmt_bind_result() failed: " + std::string(mysql_stmt_error(dbData->stmt)));
+  }
+
+  try {
+
+    while(rowsRead < capacity) {
+
+      char* row = rows + rowsRead * stride;
+
+      auto res = mysql_stmt_fetch(dbData->stmt);
+      if(res == 1 || res == MYSQL_NO_DATA) {
+        hasMore = false;
+        break;
+      }
+
+      for(size_t i = 0; i < m_members.size(); i ++) {
+        v_int32 col = columns[i];
+        if(nulls[col]) {
+          writeNull(m_members[i], row);
+        } else if(converted[i]) {
+          writeValue(m_members[i], binds[col], row, m_arena);
+        } else if(m_members[i].type == MemberType::STRING) {
+          StringRef ref;
+          ref.offset = m_arena.size();
+          ref.size = std::min(lengths[col], binds[col].buffer_length - 1);
+          m_arena.insert(m_arena.end(), scratch[col].data(), scratch[col].data() + ref.size);
+          if((unsigned long) ref.size < lengths[col]) {
+            fetchRemainder(dbData->stmt, col, lengths[col], ref);
+          }
+          std::memcpy(row + m_members[i].offset, &ref, sizeof(StringRef));
+        } else {
+          std::memcpy(row + m_members[i].offset, staging.data() + m_members[i].offset, getMemberSize(m_members[i].type));
+        }
+      }
+
+      ++ rowsRead;
+      ++ dbData->rowIndex;
+
+    }
+
+  } catch (...) {
+    mysql_stmt_bind_result(dbData->stmt, dbData->bindResults.data());
+    throw;
+  }
+
+  // give the statement back to the result data, and read the next row the usual way
+  if(mysql_stmt_bind_result(dbData->stmt, dbData->bindResults.data())) {
+    throw std::runtime_error("[oatpp::mysql::mapping::StructReader::readStatementRows()]: Error. "
+                             "mysql_stmt_bind_result() failed: " + std::string(mysql_stmt_error(dbData->stmt)));
+  }
+
+  if(hasMore) {
+    dbData->next();
+  } else {
+    dbData->hasMore = false;
+  }
+
+  return rowsRead;
+
+}
+
+v_int64 StructReader::read(ResultMapper::ResultData* dbData, void* rows, v_buff_size stride, v_int64 capacity) {
+
+  if(!dbData->hasMore || capacity <= 0) {
+    return 0;
+  }
+
+  auto columns = resolveColumns(dbData);
+  char* data = static_cast<char*>(rows);
+
+  // the current row is already in the result binds
+  copyRow(dbData, columns, data);
+  ++ dbData->rowIndex;
+
+  if(dbData->stmt) {
+    return 1 + readStatementRows(dbData, columns, data + stride, stride, capacity - 1);
+  }
+
+  v_int64 rowsRead = 1;
+  dbData->next();
+  while(dbData->hasMore && rowsRead < capacity) {
+    copyRow(dbData, columns, data + rowsRead * stride);
+    ++ dbData->rowIndex;
+    ++ rowsRead;
+    dbData->next();
+  }
+
+  return rowsRead;
+
+}
+
+const char* StructReader::getData(const StringRef& ref) const {
+  if(ref.isNull()) {
+    return nullptr;
+  }
+  return m_arena.data() + ref.offset;
+}
+
+oatpp::String StructReader::getString(const StringRef& ref) const {
+  if(ref.isNull()) {
+    return nullptr;
+  }
+  return oatpp::String(m_arena.data() + ref.offset, ref.size);
+}
+
+void StructReader::clearArena() {
+  m_arena.clear();
+}
+
+}}}
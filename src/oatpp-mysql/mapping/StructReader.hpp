@@ -0,0 +1,201 @@
+#ifndef oatpp_mysql_mapping_StructReader_hpp
+#define oatpp_mysql_mapping_StructReader_hpp
+
+#include "ResultMapper.hpp"
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * Describe member of the plain struct for &id:oatpp::mysql::mapping::StructReader;.
+ * Member is mapped to the column with the same name.
+ * @param STRUCT - struct type.
+ * @param MEMBER - member name.
+ */
+#define OATPP_MYSQL_STRUCT_MEMBER(STRUCT, MEMBER) \
+  oatpp::mysql::mapping::StructReader::member<decltype(STRUCT::MEMBER)>(#MEMBER, offsetof(STRUCT, MEMBER))
+
+/**
+ * Describe member of the plain struct mapped to the column with a different name.
+ * @param STRUCT - struct type.
+ * @param MEMBER - member name.
+ * @param COLUMN - column name.
+ */
+#define OATPP_MYSQL_STRUCT_MEMBER_AS(STRUCT, MEMBER, COLUMN) \
+  oatpp::mysql::mapping::StructReader::member<decltype(STRUCT::MEMBER)>(COLUMN, offsetof(STRUCT, MEMBER))
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+/**
+ * Read rows straight into the caller's array of plain structs. <br>
+ * For prepared statements the result is bound once per read to a staging row with the struct layout -
+ * the client library writes fixed-size values there and they are copied to the caller's row,
+ * a few bytes per member instead of `mysql_stmt_bind_result()` per row. Variable-length values are stored
+ * in the arena owned by the reader and members keep &l:StructReader::StringRef; to them. <br>
+ * Example:
+ * ```cpp
+ * struct Price {
+ *   v_int64 id;
+ *   v_float64 value;
+ *   StructReader::StringRef currency;
+ * };
+ *
+ * StructReader reader({
+ *   OATPP_MYSQL_STRUCT_MEMBER(Price, id),
+ *   OATPP_MYSQL_STRUCT_MEMBER(Price, value),
+ *   OATPP_MYSQL_STRUCT_MEMBER(Price, currency)
+ * });
+ *
+ * std::vector<Price> prices(count);
+ * auto fetched = queryResult->fetchInto(reader, prices.data(), count);
+ * ```
+ */
+class StructReader {
+public:
+
+  /**
+   * Reference to the variable-length value in the reader arena.
+   */
+  struct StringRef {
+
+    /**
+     * Offset of the value in the arena.
+     */
+    v_buff_size offset;
+
+    /**
+     * Size of the value. `-1` - value is null.
+     */
+    v_buff_size size;
+
+    /**
+     * Check if value is null.
+     * @return
+     */
+    bool isNull() const {
+      return size < 0;
+    }
+
+  };
+
+  /**
+   * Type of the struct member.
+   */
+  enum class MemberType : v_int32 {
+    INT8, UINT8,
+    INT16, UINT16,
+    INT32, UINT32,
+    INT64, UINT64,
+    FLOAT32, FLOAT64,
+    STRING
+  };
+
+  /**
+   * Compile-time mapping of the member type to &l:StructReader::MemberType;.
+   * @tparam T - member type.
+   */
+  template<typename T>
+  struct MemberTypeOf;
+
+  /**
+   * Member descriptor.
+   */
+  struct Member {
+
+    /**
+     * Column name.
+     */
+    const char* column;
+
+    /**
+     * Offset of the member in the struct.
+     */
+    v_buff_size offset;
+
+    /**
+     * &l:StructReader::MemberType;.
+     */
+    MemberType type;
+
+  };
+
+  /**
+   * Create member descriptor. Use &l:OATPP_MYSQL_STRUCT_MEMBER (); macro.
+   * @tparam T - member type.
+   * @param column - column name.
+   * @param offset - offset of the member in the struct.
+   * @return - &l:StructReader::Member;.
+   */
+  template<typename T>
+  static Member member(const char* column, v_buff_size offset) {
+    return Member {column, offset, MemberTypeOf<T>::value};
+  }
+
+private:
+  static enum_field_types getBufferType(MemberType type, bool& isUnsigned);
+  static v_buff_size getMemberSize(MemberType type);
+  static void writeNull(const Member& member, char* row);
+  static void writeValue(const Member& member, const MYSQL_BIND& bind, char* row, std::vector<char>& arena);
+private:
+  std::vector<Member> m_members;
+  std::vector<char> m_arena;
+private:
+  std::vector<v_int32> resolveColumns(const ResultMapper::ResultData* dbData) const;
+  void copyRow(const ResultMapper::ResultData* dbData, const std::vector<v_int32>& columns, char* row);
+  void fetchRemainder(MYSQL_STMT* stmt, v_int32 col, unsigned long length, StringRef& ref);
+  v_int64 readStatementRows(ResultMapper::ResultData* dbData, const std::vector<v_int32>& columns,
+                            char* rows, v_buff_size stride, v_int64 capacity);
+public:
+
+  /**
+   * Constructor.
+   * @param members - member descriptors.
+   */
+  StructReader(const std::vector<Member>& members);
+
+  /**
+   * Read up to `capacity` rows into the array of structs.
+   * @param dbData - result positioned at the first row to read.
+   * @param rows - pointer to the first struct.
+   * @param stride - size of the struct.
+   * @param capacity - number of structs in the array.
+   * @return - number of rows read.
+   */
+  v_int64 read(ResultMapper::ResultData* dbData, void* rows, v_buff_size stride, v_int64 capacity);
+
+  /**
+   * Get pointer to the variable-length value. Value is not null-terminated.
+   * @param ref - &l:StructReader::StringRef;.
+   * @return - pointer to the value. `nullptr` for null value.
+   */
+  const char* getData(const StringRef& ref) const;
+
+  /**
+   * Copy variable-length value to &id:oatpp::String;.
+   * @param ref - &l:StructReader::StringRef;.
+   * @return - &id:oatpp::String;. `nullptr` for null value.
+   */
+  oatpp::String getString(const StringRef& ref) const;
+
+  /**
+   * Clear arena. &l:StructReader::StringRef; of the rows read before are invalidated.
+   */
+  void clearArena();
+
+};
+
+template<> struct StructReader::MemberTypeOf<v_int8> { static constexpr MemberType value = MemberType::INT8; };
+template<> struct StructReader::MemberTypeOf<v_uint8> { static constexpr MemberType value = MemberType::UINT8; };
+template<> struct StructReader::MemberTypeOf<v_int16> { static constexpr MemberType value = MemberType::INT16; };
+template<> struct StructReader::MemberTypeOf<v_uint16> { static constexpr MemberType value = MemberType::UINT16; };
+template<> struct StructReader::MemberTypeOf<v_int32> { static constexpr MemberType value = MemberType::INT32; };
+template<> struct StructReader::MemberTypeOf<v_uint32> { static constexpr MemberType value = MemberType::UINT32; };
+template<> struct StructReader::MemberTypeOf<v_int64> { static constexpr MemberType value = MemberType::INT64; };
+template<> struct StructReader::MemberTypeOf<v_uint64> { static constexpr MemberType value = MemberType::UINT64; };
+template<> struct StructReader::MemberTypeOf<v_float32> { static constexpr MemberType value = MemberType::FLOAT32; };
+template<> struct StructReader::MemberTypeOf<v_float64> { static constexpr MemberType value = MemberType::FLOAT64; };
+template<> struct StructReader::MemberTypeOf<StructReader::StringRef> { static constexpr MemberType value = MemberType::STRING; };
+
+}}}
+
+#endif // oatpp_mysql_mapping_StructReader_hpp
@@ -0,0 +1,248 @@
+#include "TimeCodec.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+constexpr v_buff_size TimeCodec::MAX_TEXT_SIZE;
+
+namespace {
+
+constexpr v_int64 MICROS_PER_SECOND = 1000000;
+constexpr v_int64 MICROS_PER_DAY = 86400 * MICROS_PER_SECOND;
+
+// read unsigned number of at most maxDigits digits. Returns false if there are no digits
+bool readNumber(const char*& p, const char* end, v_int32 maxDigits, v_uint64& value) {
+  value = 0;
+  v_int32 digits = 0;
+  while(p < end && digits < maxDigits && *p >= '0' && *p <= '9') {
+    value = value * 10 + (*p - '0');
+    ++ p;
+    ++ digits;
+  }
+  return digits > 0;
+}
+
+bool expect(const char*& p, const char* end, char c) {
+  if(p < end && *p == c) {
+    ++ p;
+    return true;
+  }
+  return false;
+}
+
+// fraction digits to microseconds - ".5" -> 500000
+bool readFraction(const char*& p, const char* end, unsigned long& secondPart) {
+  secondPart = 0;
+  if(!expect(p, end, '.')) {
+    return true;
+  }
+  v_int64 scale = 100000;
+  bool hasDigits = false;
+  while(p < end && *p >= '0' && *p <= '9') {
+    secondPart += (*p - '0') * scale;
+    scale /= 10;
+    hasDigits = true;
+    ++ p;
+  }
+  return hasDigits;
+}
+
+}
+
+bool TimeCodec::isTemporal(enum_field_types type) {
+  switch(type) {
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_TIME:
+      return true;
+    default:
+      return false;
+  }
+}
+
+enum_field_types TimeCodec::getBufferType(enum_field_types type) {
+  switch(type) {
+    case MYSQL_TYPE_NEWDATE:
+      return MYSQL_TYPE_DATE;
+    case MYSQL_TYPE_DATETIME2:
+      return MYSQL_TYPE_DATETIME;
+    case MYSQL_TYPE_TIMESTAMP2:
+      return MYSQL_TYPE_TIMESTAMP;
+    case MYSQL_TYPE_TIME2:
+      return MYSQL_TYPE_TIME;
+    default:
+      return type;
+  }
+}
+
+// http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+v_int64 TimeCodec::daysFromCivil(v_int64 year, v_uint32 month, v_uint32 day) {
+  year -= month <= 2;
+  const v_int64 era = (year >= 0 ? year : year - 399) / 400;
+  const v_uint32 yoe = (v_uint32) (year - era * 400);
+  const v_uint32 doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const v_uint32 doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (v_int64) doe - 719468;
+}
+
+v_int64 TimeCodec::toEpochMicros(const MYSQL_TIME& time) {
+
+  v_int64 timeOfDay = ((v_int64) time.hour * 3600 + time.minute * 60 + time.second) * MICROS_PER_SECOND + time.second_part;
+
+  if(time.time_type == MYSQL_TIMESTAMP_TIME) {
+    v_int64 duration = time.day * MICROS_PER_DAY + timeOfDay;
+    return time.neg ? -duration : duration;
+  }
+
+  // zero dates '0000-00-00' have zero month and day
+  v_uint32 month = time.month > 0 ? time.month : 1;
+  v_uint32 day = time.day > 0 ? time.day : 1;
+  v_int64 days = daysFromCivil(time.year, month, day);
+
+  if(time.time_type == MYSQL_TIMESTAMP_DATE) {
+    return days * MICROS_PER_DAY;
+  }
+  return days * MICROS_PER_DAY + timeOfDay;
+
+}
+
+// http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+void TimeCodec::fromEpochMicros(v_int64 micros, enum_mysql_timestamp_type type, MYSQL_TIME& time) {
+
+  std::memset(&time, 0, sizeof(MYSQL_TIME));
+  time.time_type = type;
+
+  if(type == MYSQL_TIMESTAMP_TIME) {
+    if(micros < 0) {
+      time.neg = true;
+      micros = -micros;
+    }
+    time.second_part = (unsigned long) (micros % MICROS_PER_SECOND);
+    v_int64 seconds = micros / MICROS_PER_SECOND;
+    time.second = (unsigned int) (seconds % 60);
+    time.minute = (unsigned int) ((seconds / 60) % 60);
+    time.hour = (unsigned int) (seconds / 3600);
+    return;
+  }
+
+  v_int64 days = micros / MICROS_PER_DAY;
+  v_int64 timeOfDay = micros % MICROS_PER_DAY;
+  if(timeOfDay < 0) {
+    timeOfDay += MICROS_PER_DAY;
+    days -= 1;
+  }
+
+  days += 719468;
+  const v_int64 era = (days >= 0 ? days : days - 146096) / 146097;
+  const v_uint32 doe = (v_uint32) (days - era * 146097);
+  const v_uint32 yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const v_uint32 doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const v_uint32 mp = (5 * doy + 2) / 153;
+  time.day = doy - (153 * mp + 2) / 5 + 1;
+  time.month = mp < 10 ? mp + 3 : mp - 9;
+  time.year = (unsigned int) (yoe + era * 400 + (time.month <= 2));
+
+  if(type == MYSQL_TIMESTAMP_DATE) {
+    return;
+  }
+
+  time.second_part = (unsigned long) (timeOfDay % MICROS_PER_SECOND);
+  v_int64 seconds = timeOfDay / MICROS_PER_SECOND;
+  time.second = (unsigned int) (seconds % 60);
+  time.minute = (unsigned int) ((seconds / 60) % 60);
+  time.hour = (unsigned int) (seconds / 3600);
+
+}
+
+v_buff_size TimeCodec::format(const MYSQL_TIME& time, char* buffer) {
+
+  int size;
+
+  switch(time.time_type) {
+
+    case MYSQL_TIMESTAMP_DATE:
+      return std::snprintf(buffer, MAX_TEXT_SIZE, "%04u-%02u-%02u", time.year, time.month, time.day);
+
+    case MYSQL_TIMESTAMP_TIME:
+      size = std::snprintf(buffer, MAX_TEXT_SIZE, "%s%02u:%02u:%02u", time.neg ? "-" : "",
+                           time.day * 24 + time.hour, time.minute, time.second);
+      break;
+
+    default:
+      size = std::snprintf(buffer, MAX_TEXT_SIZE, "%04u-%02u-%02u %02u:%02u:%02u",
+                           time.year, time.month, time.day, time.hour, time.minute, time.second);
+
+  }
+
+  if(time.second_part > 0) {
+    size += std::snprintf(buffer + size, MAX_TEXT_SIZE - size, ".%06lu", time.second_part);
+  }
+
+  return size;
+
+}
+
+bool TimeCodec::parse(const char* text, v_buff_size size, enum_field_types type, MYSQL_TIME& time) {
+
+  std::memset(&time, 0, sizeof(MYSQL_TIME));
+
+  const char* p = text;
+  const char* end = text + size;
+  v_uint64 a, b, c;
+
+  if(type == MYSQL_TYPE_TIME) {
+    time.time_type = MYSQL_TIMESTAMP_TIME;
+    time.neg = expect(p, end, '-');
+    if(!readNumber(p, end, 4, a) || !expect(p, end, ':') ||
+       !readNumber(p, end, 2, b) || !expect(p, end, ':') ||
+       !readNumber(p, end, 2, c) || !readFraction(p, end, time.second_part))
+    {
+      return false;
+    }
+    time.hour = (unsigned int) a;
+    time.minute = (unsigned int) b;
+    time.second = (unsigned int) c;
+    return p == end;
+  }
+
+  if(!readNumber(p, end, 4, a) || !expect(p, end, '-') ||
+     !readNumber(p, end, 2, b) || !expect(p, end, '-') ||
+     !readNumber(p, end, 2, c))
+  {
+    return false;
+  }
+
+  time.year = (unsigned int) a;
+  time.month = (unsigned int) b;
+  time.day = (unsigned int) c;
+
+  if(type == MYSQL_TYPE_DATE) {
+    time.time_type = MYSQL_TIMESTAMP_DATE;
+    return p == end;
+  }
+
+  time.time_type = MYSQL_TIMESTAMP_DATETIME;
+  if(p == end) {
+    return true;
+  }
+
+  if(!(expect(p, end, ' ') || expect(p, end, 'T')) ||
+     !readNumber(p, end, 2, a) || !expect(p, end, ':') ||
+     !readNumber(p, end, 2, b) || !expect(p, end, ':') ||
+     !readNumber(p, end, 2, c) || !readFraction(p, end, time.second_part))
+  {
+    return false;
+  }
+
+  time.hour = (unsigned int) a;
+  time.minute = (unsigned int) b;
+  time.second = (unsigned int) c;
+
+  return p == end;
+
+}
+
+}}}
@@ -0,0 +1,90 @@
+#ifndef oatpp_mysql_mapping_TimeCodec_hpp
+#define oatpp_mysql_mapping_TimeCodec_hpp
+
+#include "oatpp/Environment.hpp"
+
+#ifdef _WIN32
+    #include "mysql.h"
+#else
+    #include "mysql/mysql.h"
+#endif // _WIN32
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+/**
+ * Conversions of `MYSQL_TIME` - binary form of `DATE`, `DATETIME`, `TIMESTAMP` and `TIME` values. <br>
+ * Dates are converted to/from microseconds since the Unix epoch as they are - no time zone is applied.
+ * `TIMESTAMP` values are in the session time zone, so set `time_zone = '+00:00'` to get UTC epoch values.
+ */
+class TimeCodec {
+public:
+
+  /**
+   * Max size of the formatted value - `-838:59:59.000000`, `9999-12-31 23:59:59.999999`.
+   */
+  static constexpr v_buff_size MAX_TEXT_SIZE = 32;
+
+public:
+
+  /**
+   * Check if buffer type is `MYSQL_TIME` based.
+   * @param type
+   * @return
+   */
+  static bool isTemporal(enum_field_types type);
+
+  /**
+   * Normalize field type to the buffer type to bind - `DATE`, `DATETIME`, `TIMESTAMP` or `TIME`.
+   * @param type - field type.
+   * @return
+   */
+  static enum_field_types getBufferType(enum_field_types type);
+
+  /**
+   * Days since the Unix epoch.
+   * @param year
+   * @param month - `[1..12]`.
+   * @param day - `[1..31]`.
+   * @return
+   */
+  static v_int64 daysFromCivil(v_int64 year, v_uint32 month, v_uint32 day);
+
+  /**
+   * Convert time to microseconds. Date values - since the Unix epoch, `TIME` values - duration.
+   * @param time
+   * @return
+   */
+  static v_int64 toEpochMicros(const MYSQL_TIME& time);
+
+  /**
+   * Convert microseconds since the Unix epoch to time.
+   * @param micros
+   * @param type - `MYSQL_TIMESTAMP_DATETIME`, `MYSQL_TIMESTAMP_DATE` or `MYSQL_TIMESTAMP_TIME`.
+   * @param time - out.
+   */
+  static void fromEpochMicros(v_int64 micros, enum_mysql_timestamp_type type, MYSQL_TIME& time);
+
+  /**
+   * Format time as mysql does - `YYYY-MM-DD`, `YYYY-MM-DD hh:mm:ss[.ffffff]`, `[-]hh:mm:ss[.ffffff]`.
+   * Fraction is written only if it's not zero.
+   * @param time
+   * @param buffer - buffer of at least &l:TimeCodec::MAX_TEXT_SIZE; bytes.
+   * @return - size of the text.
+   */
+  static v_buff_size format(const MYSQL_TIME& time, char* buffer);
+
+  /**
+   * Parse text value of the temporal column.
+   * @param text
+   * @param size
+   * @param type - buffer type - `DATE`, `DATETIME`, `TIMESTAMP` or `TIME`.
+   * @param time - out.
+   * @return - `true` on success.
+   */
+  static bool parse(const char* text, v_buff_size size, enum_field_types type, MYSQL_TIME& time);
+
+};
+
+}}}
+
+#endif // oatpp_mysql_mapping_TimeCodec_hpp
@@ -0,0 +1,190 @@
+#include "UuidCodec.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <random>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define OATPP_MYSQL_UUID_SSE2
+  #include <emmintrin.h>
+#endif
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+constexpr v_buff_size UuidCodec::SIZE;
+constexpr v_buff_size UuidCodec::TEXT_SIZE;
+
+namespace {
+
+// offsets of the hex groups in the text - 8-4-4-4-12
+const v_buff_size GROUP_START[] = {0, 9, 14, 19, 24};
+const v_buff_size GROUP_SIZE[] = {8, 4, 4, 4, 12};
+
+#ifdef OATPP_MYSQL_UUID_SSE2
+
+void encodeHex(const v_uint8* bytes, char* hex) {
+
+  const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+  const __m128i lowMask = _mm_set1_epi8(0x0F);
+
+  __m128i high = _mm_and_si128(_mm_srli_epi16(value, 4), lowMask);
+  __m128i low = _mm_and_si128(value, lowMask);
+
+  // nibble -> '0'..'9', 'a'..'f'
+  const __m128i nine = _mm_set1_epi8(9);
+  const __m128i zero = _mm_set1_epi8('0');
+  const __m128i letterOffset = _mm_set1_epi8('a' - '0' - 10);
+
+  high = _mm_add_epi8(_mm_add_epi8(high, zero), _mm_and_si128(_mm_cmpgt_epi8(high, nine), letterOffset));
+  low = _mm_add_epi8(_mm_add_epi8(low, zero), _mm_and_si128(_mm_cmpgt_epi8(low, nine), letterOffset));
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(hex), _mm_unpacklo_epi8(high, low));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(hex + 16), _mm_unpackhi_epi8(high, low));
+
+}
+
+__m128i decodeNibbles(__m128i chars, int& mask) {
+
+  // digits and letters of both cases are checked with unsigned min - value is in range if min(value, max) == value
+  const __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+  const __m128i letter = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+  const __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+  const __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+
+  mask &= _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter));
+
+  return _mm_or_si128(_mm_and_si128(isDigit, digit),
+                      _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+
+}
+
+bool decodeHex(const char* hex, v_uint8* bytes) {
+
+  int mask = 0xFFFF;
+  const __m128i first = decodeNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex)), mask);
+  const __m128i second = decodeNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex + 16)), mask);
+
+  if(mask != 0xFFFF) {
+    return false;
+  }
+
+  // pairs of nibbles as 16-bit lanes - the high nibble is the first byte
+  const __m128i byteMask = _mm_set1_epi16(0x00FF);
+  const __m128i firstBytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(first, byteMask), 4), _mm_srli_epi16(first, 8));
+  const __m128i secondBytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(second, byteMask), 4), _mm_srli_epi16(second, 8));
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), _mm_packus_epi16(firstBytes, secondBytes));
+
+  return true;
+
+}
+
+#else
+
+const char* HEX = "0123456789abcdef";
+
+v_int32 hexValue(char c) {
+  if(c >= '0' && c <= '9') return c - '0';
+  if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+void encodeHex(const v_uint8* bytes, char* hex) {
+  for(v_buff_size i = 0; i < UuidCodec::SIZE; i ++) {
+    hex[i * 2] = HEX[bytes[i] >> 4];
+    hex[i * 2 + 1] = HEX[bytes[i] & 0x0F];
+  }
+}
+
+bool decodeHex(const char* hex, v_uint8* bytes) {
+  for(v_buff_size i = 0; i < UuidCodec::SIZE; i ++) {
+    auto high = hexValue(hex[i * 2]);
+    auto low = hexValue(hex[i * 2 + 1]);
+    if(high < 0 || low < 0) {
+      return false;
+    }
+    bytes[i] = (v_uint8) ((high << 4) | low);
+  }
+  return true;
+}
+
+#endif
+
+}
+
+void UuidCodec::format(const v_uint8* bytes, char* text) {
+
+  char hex[SIZE * 2];
+  encodeHex(bytes, hex);
+
+  const char* p = hex;
+  for(v_int32 i = 0; i < 5; i ++) {
+    if(i > 0) {
+      text[GROUP_START[i] - 1] = '-';
+    }
+    std::memcpy(text + GROUP_START[i], p, GROUP_SIZE[i]);
+    p += GROUP_SIZE[i];
+  }
+
+}
+
+bool UuidCodec::parse(const char* text, v_buff_size size, v_uint8* bytes) {
+
+  if(size == SIZE * 2) {
+    return decodeHex(text, bytes);
+  }
+
+  if(size != TEXT_SIZE) {
+    return false;
+  }
+
+  char hex[SIZE * 2];
+  char* p = hex;
+  for(v_int32 i = 0; i < 5; i ++) {
+    if(i > 0 && text[GROUP_START[i] - 1] != '-') {
+      return false;
+    }
+    std::memcpy(p, text + GROUP_START[i], GROUP_SIZE[i]);
+    p += GROUP_SIZE[i];
+  }
+
+  return decodeHex(hex, bytes);
+
+}
+
+void UuidCodec::generateV7(v_int64 unixMillis, v_uint8* bytes) {
+
+  thread_local std::mt19937_64 generator(std::random_device{}());
+
+  v_uint64 a = generator();
+  v_uint64 b = generator();
+
+  // 48-bit big-endian time
+  for(v_int32 i = 0; i < 6; i ++) {
+    bytes[i] = (v_uint8) (unixMillis >> (40 - i * 8));
+  }
+
+  std::memcpy(bytes + 6, &a, 2);
+  std::memcpy(bytes + 8, &b, 8);
+
+  bytes[6] = (v_uint8) ((bytes[6] & 0x0F) | 0x70); // version 7
+  bytes[8] = (v_uint8) ((bytes[8] & 0x3F) | 0x80); // variant 10
+
+}
+
+void UuidCodec::generateV7(v_uint8* bytes) {
+  auto now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch());
+  generateV7((v_int64) now.count(), bytes);
+}
+
+v_int64 UuidCodec::getV7Millis(const v_uint8* bytes) {
+  v_int64 result = 0;
+  for(v_int32 i = 0; i < 6; i ++) {
+    result = (result << 8) | bytes[i];
+  }
+  return result;
+}
+
+}}}
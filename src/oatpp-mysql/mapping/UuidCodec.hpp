@@ -0,0 +1,68 @@
+#ifndef oatpp_mysql_mapping_UuidCodec_hpp
+#define oatpp_mysql_mapping_UuidCodec_hpp
+
+#include "oatpp/Environment.hpp"
+
+namespace oatpp { namespace mysql { namespace mapping {
+
+/**
+ * Conversions of 16-byte UUID values - `BINARY(16)` columns. <br>
+ * Hex is encoded and decoded 16 bytes at once with SSE2 where available, with the table-driven code otherwise.
+ */
+class UuidCodec {
+public:
+
+  /**
+   * Size of the UUID value in bytes.
+   */
+  static constexpr v_buff_size SIZE = 16;
+
+  /**
+   * Size of the UUID text - `xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx`.
+   */
+  static constexpr v_buff_size TEXT_SIZE = 36;
+
+public:
+
+  /**
+   * Format UUID as lowercase hex text with hyphens.
+   * @param bytes - &l:UuidCodec::SIZE; bytes.
+   * @param text - buffer of at least &l:UuidCodec::TEXT_SIZE; bytes. Not null-terminated.
+   */
+  static void format(const v_uint8* bytes, char* text);
+
+  /**
+   * Parse UUID text - 36 chars with hyphens or 32 hex chars without. Hex digits are case-insensitive.
+   * @param text
+   * @param size
+   * @param bytes - out. &l:UuidCodec::SIZE; bytes.
+   * @return - `false` if text is not a UUID.
+   */
+  static bool parse(const char* text, v_buff_size size, v_uint8* bytes);
+
+  /**
+   * Generate UUID version 7 - 48-bit Unix time in milliseconds followed by random bits. <br>
+   * Values generated later sort after the earlier ones, so inserts go to the end of the primary key index.
+   * @param unixMillis - milliseconds since the Unix epoch.
+   * @param bytes - out. &l:UuidCodec::SIZE; bytes.
+   */
+  static void generateV7(v_int64 unixMillis, v_uint8* bytes);
+
+  /**
+   * Generate UUID version 7 for the current time.
+   * @param bytes - out. &l:UuidCodec::SIZE; bytes.
+   */
+  static void generateV7(v_uint8* bytes);
+
+  /**
+   * Get Unix time in milliseconds of the UUID version 7.
+   * @param bytes - &l:UuidCodec::SIZE; bytes.
+   * @return
+   */
+  static v_int64 getV7Millis(const v_uint8* bytes);
+
+};
+
+}}}
+
+#endif // oatpp_mysql_mapping_UuidCodec_hpp
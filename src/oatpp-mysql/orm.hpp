@@ -7,7 +7,15 @@
 #define oatpp_mysql_orm_hpp
 
 #include "Executor.hpp"
+#include "ParallelScan.hpp"
+#include "RoutingExecutor.hpp"
+#include "ShardedExecutor.hpp"
+#include "Types.hpp"
 #include "Utils.hpp"
+#include "stream/CsvRowSink.hpp"
+#include "stream/JsonRowSink.hpp"
+#include "stream/NdjsonRowSink.hpp"
+#include "stream/RowStreamer.hpp"
 
 #include "oatpp/orm/SchemaMigration.hpp"
 #include "oatpp/orm/DbClient.hpp"
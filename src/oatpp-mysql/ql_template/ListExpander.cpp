@@ -0,0 +1,193 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "ListExpander.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+namespace oatpp { namespace mysql { namespace ql_template {
+
+constexpr v_int64 ListExpander::MAX_PLACEHOLDERS;
+constexpr const char* ListExpander::EMPTY_LIST;
+
+namespace {
+
+// JSON_TABLE column type of the list items. nullptr - items are not numbers and can't be bound as JSON
+const char* getJsonColumnType(const oatpp::Type* itemType) {
+
+  auto classId = itemType->classId.id;
+
+  if(classId == oatpp::Int8::Class::CLASS_ID.id ||
+     classId == oatpp::Int16::Class::CLASS_ID.id ||
+     classId == oatpp::Int32::Class::CLASS_ID.id ||
+     classId == oatpp::Int64::Class::CLASS_ID.id)
+  {
+    return "BIGINT";
+  }
+
+  if(classId == oatpp::UInt8::Class::CLASS_ID.id ||
+     classId == oatpp::UInt16::Class::CLASS_ID.id ||
+     classId == oatpp::UInt32::Class::CLASS_ID.id ||
+     classId == oatpp::UInt64::Class::CLASS_ID.id)
+  {
+    return "BIGINT UNSIGNED";
+  }
+
+  if(classId == oatpp::Float32::Class::CLASS_ID.id ||
+     classId == oatpp::Float64::Class::CLASS_ID.id)
+  {
+    return "DOUBLE";
+  }
+
+  return nullptr;
+
+}
+
+void appendJsonItem(std::string& json, const oatpp::Void& item) {
+
+  if(!item) {
+    json.append("null");
+    return;
+  }
+
+  auto classId = item.getValueType()->classId.id;
+
+  if(classId == oatpp::Int8::Class::CLASS_ID.id) {
+    json.append(std::to_string(*static_cast<v_int8*>(item.get())));
+  } else if(classId == oatpp::UInt8::Class::CLASS_ID.id) {
+    json.append(std::to_string(*static_cast<v_uint8*>(item.get())));
+  } else if(classId == oatpp::Int16::Class::CLASS_ID.id) {
+    json.append(std::to_string(*static_cast<v_int16*>(item.get())));
+  } else if(classId == oatpp::UInt16::Class::CLASS_ID.id) {
+    json.append(std::to_string(*static_cast<v_uint16*>(item.get())));
+  } else if(classId == oatpp::Int32::Class::CLASS_ID.id) {
+    json.append(std::to_string(*static_cast<v_int32*>(item.get())));
+  } else if(classId == oatpp::UInt32::Class::CLASS_ID.id) {
+    json.append(std::to_string(*static_cast<v_uint32*>(item.get())));
+  } else if(classId == oatpp::Int64::Class::CLASS_ID.id) {
+    json.append(std::to_string(*static_cast<v_int64*>(item.get())));
+  } else if(classId == oatpp::UInt64::Class::CLASS_ID.id) {
+    json.append(std::to_string(*static_cast<v_uint64*>(item.get())));
+  } else {
+    bool isFloat32 = classId == oatpp::Float32::Class::CLASS_ID.id;
+    v_float64 value = isFloat32 ? (v_float64) *static_cast<v_float32*>(item.get()) : *static_cast<v_float64*>(item.get());
+    // JSON has no NaN and infinity - snprintf() would write nan/inf and the server would reject the document
+    if(!std::isfinite(value)) {
+      throw std::runtime_error("[oatpp::mysql::ql_template::ListExpander::expand()]: Error. "
+                               "NaN and infinity can't be used in the list parameter.");
+    }
+    char buff[32];
+    std::snprintf(buff, sizeof(buff), isFloat32 ? "%.9g" : "%.17g", value);
+    json.append(buff);
+  }
+
+}
+
+}
+
+bool ListExpander::isList(const oatpp::Type* type) {
+  auto classId = type->classId.id;
+  return classId == data::type::__class::AbstractVector::CLASS_ID.id ||
+         classId == data::type::__class::AbstractList::CLASS_ID.id ||
+         classId == data::type::__class::AbstractUnorderedSet::CLASS_ID.id;
+}
+
+v_int64 ListExpander::getBucketSize(v_int64 size) {
+  v_int64 result = 1;
+  while(result < size) {
+    result <<= 1;
+  }
+  return result;
+}
+
+// e.g. id IN (:ids), ids = [1, 2, 3]
+//   -> id IN (?,?,?,?) with values 1, 2, 3, 3
+//   -> id IN (SELECT v FROM JSON_TABLE(?, '$[*]' COLUMNS(v BIGINT PATH '$')) AS oatpp_list_0) for large lists
+//   -> id IN (SELECT NULL FROM DUAL WHERE FALSE) for the empty list
+oatpp::String ListExpander::expand(const oatpp::Void& list, bool prepared, v_uint32 listIndex, std::vector<oatpp::Void>& values) {
+
+  auto type = list.getValueType();
+
+  std::vector<oatpp::Void> items;
+  if(list) {
+    auto dispatcher = static_cast<const data::type::__class::Collection::PolymorphicDispatcher*>(type->polymorphicDispatcher);
+    auto iterator = dispatcher->beginIteration(list);
+    while(!iterator->finished()) {
+      items.push_back(iterator->get());
+      iterator->next();
+    }
+  }
+
+  if(items.empty()) {
+    return EMPTY_LIST;
+  }
+
+  v_int64 size = (v_int64) items.size();
+
+  if(prepared && size > MAX_PLACEHOLDERS) {
+    auto columnType = getJsonColumnType(type->params.front());
+    if(columnType) {
+
+      std::string json;
+      json.reserve(items.size() * 8 + 2);
+      json.push_back('[');
+      for(size_t i = 0; i < items.size(); i ++) {
+        if(i > 0) {
+          json.push_back(',');
+        }
+        appendJsonItem(json, items[i]);
+      }
+      json.push_back(']');
+      values.push_back(oatpp::String(std::move(json)));
+
+      return oatpp::String("SELECT v FROM JSON_TABLE(?, '$[*]' COLUMNS(v " + std::string(columnType) + " PATH '$')) "
+                           "AS oatpp_list_" + std::to_string(listIndex));
+
+    }
+  }
+
+  // lists which can't go as JSON are not padded past the limit - the next bucket may exceed max statement params
+  v_int64 count = size;
+  if(prepared && size <= MAX_PLACEHOLDERS) {
+    count = getBucketSize(size);
+  }
+
+  std::string placeholders;
+  placeholders.reserve(count * 2);
+  for(v_int64 i = 0; i < count; i ++) {
+    if(i > 0) {
+      placeholders.push_back(',');
+    }
+    placeholders.push_back('?');
+    values.push_back(items[i < size ? i : size - 1]);
+  }
+
+  return oatpp::String(std::move(placeholders));
+
+}
+
+}}}
@@ -0,0 +1,91 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mysql_ql_template_ListExpander_hpp
+#define oatpp_mysql_ql_template_ListExpander_hpp
+
+#include "oatpp/Types.hpp"
+
+#include <vector>
+
+namespace oatpp { namespace mysql { namespace ql_template {
+
+/**
+ * Expansion of collection parameters to the value lists - `WHERE id IN (:ids)`. <br>
+ * For prepared statements the number of placeholders is rounded up to the power of two by repeating the last value,
+ * so lists of any size produce a few distinct statements - duplicates don't change the `IN` result. <br>
+ * Numeric lists longer than &l:ListExpander::MAX_PLACEHOLDERS; are bound as one JSON array parameter
+ * and unpacked with `JSON_TABLE` (MySQL 8.0.4+). <br>
+ * The parameter must be the whole `IN` list - `IN (:ids)`, not `IN (:ids, 1)`.
+ */
+class ListExpander {
+public:
+
+  /**
+   * Max number of placeholders of one list. Larger numeric lists are bound as the JSON array,
+   * larger lists of other types get one placeholder per item without padding.
+   */
+  static constexpr v_int64 MAX_PLACEHOLDERS = 512;
+
+  /**
+   * Substitution of the empty list - empty subquery. `IN` matches no rows, `NOT IN` matches all rows
+   * (`IN (NULL)` would make `NOT IN` match nothing).
+   */
+  static constexpr const char* EMPTY_LIST = "SELECT NULL FROM DUAL WHERE FALSE";
+
+public:
+
+  /**
+   * Check if the parameter of this type is expanded to the list - &id:oatpp::Vector;, &id:oatpp::List;
+   * or &id:oatpp::UnorderedSet;.
+   * @param type
+   * @return
+   */
+  static bool isList(const oatpp::Type* type);
+
+  /**
+   * Get number of placeholders for the list size - the smallest power of two not less than the size.
+   * @param size - list size.
+   * @return
+   */
+  static v_int64 getBucketSize(v_int64 size);
+
+  /**
+   * Expand list.
+   * @param list - list value. See &l:ListExpander::isList ();.
+   * @param prepared - `true` - placeholders of the prepared statement, padded to the bucket size,
+   * large numeric lists as `JSON_TABLE`. <br>
+   * `false` - one value per item, for the literal substitution of the text protocol.
+   * @param listIndex - index of the template variable. Makes the `JSON_TABLE` alias unique within the query.
+   * @param values - out. Values to bind are appended in the placeholder order.
+   * @return - placeholder text. &l:ListExpander::EMPTY_LIST; for the empty list.
+   * @throws - `std::runtime_error` if the list bound as JSON array has NaN or infinity.
+   */
+  static oatpp::String expand(const oatpp::Void& list, bool prepared, v_uint32 listIndex, std::vector<oatpp::Void>& values);
+
+};
+
+}}}
+
+#endif // oatpp_mysql_ql_template_ListExpander_hpp
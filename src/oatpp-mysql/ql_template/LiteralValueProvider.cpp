@@ -0,0 +1,186 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#include "LiteralValueProvider.hpp"
+#include "ListExpander.hpp"
+
+#include "oatpp-mysql/mapping/TimeCodec.hpp"
+
+#include <cstdio>
+
+namespace oatpp { namespace mysql { namespace ql_template {
+
+LiteralValueProvider::LiteralValueProvider(MYSQL* handle, const std::vector<MYSQL_BIND>& binds)
+  : m_handle(handle)
+  , m_binds(binds)
+{}
+
+LiteralValueProvider::LiteralValueProvider(MYSQL* handle, const std::vector<MYSQL_BIND>& binds, const std::vector<v_uint32>& counts)
+  : m_handle(handle)
+  , m_binds(binds)
+  , m_counts(counts)
+{
+  v_uint32 offset = 0;
+  m_offsets.reserve(m_counts.size());
+  for(auto count : m_counts) {
+    m_offsets.push_back(offset);
+    offset += count;
+  }
+}
+
+// e.g. select * from t_user where id = :user.id and name = :user.name
+//   -> select * from t_user where id = 1 and name = 'O\'Neil'
+// e.g. select * from t_user where id in (:ids)
+//   -> select * from t_user where id in (1,2,3)
+oatpp::String LiteralValueProvider::getValue(const data::share::StringTemplate::Variable& variable, v_uint32 index) {
+
+  v_uint32 offset = index;
+  v_uint32 count = 1;
+  if(!m_counts.empty()) {
+    offset = m_offsets[index];
+    count = m_counts[index];
+  }
+
+  if(count == 0) {
+    return ListExpander::EMPTY_LIST;
+  }
+
+  if(offset + count > m_binds.size()) {
+    throw std::runtime_error("[oatpp::mysql::ql_template::LiteralValueProvider::getValue()]: Error. "
+                             "Parameter is not bound. Parameter name: " + variable.name);
+  }
+
+  if(count == 1) {
+    return getLiteral(m_binds[offset], variable);
+  }
+
+  std::string result;
+  for(v_uint32 i = 0; i < count; i ++) {
+    if(i > 0) {
+      result.push_back(',');
+    }
+    result.append(*getLiteral(m_binds[offset + i], variable));
+  }
+  return oatpp::String(std::move(result));
+
+}
+
+oatpp::String LiteralValueProvider::getLiteral(const MYSQL_BIND& bind, const data::share::StringTemplate::Variable& variable) {
+
+  if(bind.buffer_type == MYSQL_TYPE_LONG_BLOB && !(bind.is_null && *bind.is_null)) {
+    throw std::runtime_error("[oatpp::mysql::ql_template::LiteralValueProvider::getLiteral()]: Error. "
+                             "Streamed parameters are not supported by the text protocol. Parameter name: " + variable.name);
+  }
+
+  if((bind.is_null && *bind.is_null) || bind.buffer == nullptr) {
+    return "NULL";
+  }
+
+  switch(bind.buffer_type) {
+
+    case MYSQL_TYPE_TINY:
+      if(bind.is_unsigned) return oatpp::String(std::to_string(*(uint8_t*) bind.buffer));
+      return oatpp::String(std::to_string(*(int8_t*) bind.buffer));
+
+    case MYSQL_TYPE_SHORT:
+      if(bind.is_unsigned) return oatpp::String(std::to_string(*(uint16_t*) bind.buffer));
+      return oatpp::String(std::to_string(*(int16_t*) bind.buffer));
+
+    case MYSQL_TYPE_LONG:
+      if(bind.is_unsigned) return oatpp::String(std::to_string(*(uint32_t*) bind.buffer));
+      return oatpp::String(std::to_string(*(int32_t*) bind.buffer));
+
+    case MYSQL_TYPE_LONGLONG:
+      if(bind.is_unsigned) return oatpp::String(std::to_string(*(uint64_t*) bind.buffer));
+      return oatpp::String(std::to_string(*(int64_t*) bind.buffer));
+
+    case MYSQL_TYPE_FLOAT: {
+      char buff[32];
+      std::snprintf(buff, sizeof(buff), "%.9g", (double) *(float*) bind.buffer);
+      return oatpp::String(buff);
+    }
+
+    case MYSQL_TYPE_DOUBLE: {
+      char buff[32];
+      std::snprintf(buff, sizeof(buff), "%.17g", *(double*) bind.buffer);
+      return oatpp::String(buff);
+    }
+
+    case MYSQL_TYPE_STRING: {
+      std::string result;
+      result.resize(bind.buffer_length * 2 + 3);
+      result[0] = '\'';
+#if defined(MARIADB_BASE_VERSION) || defined(MARIADB_PACKAGE_VERSION_ID)
+      // MariaDB Connector/C has no mysql_real_escape_string_quote - its mysql_real_escape_string doubles the quotes
+      // itself when the server runs with NO_BACKSLASH_ESCAPES
+      auto size = mysql_real_escape_string(m_handle, &result[1], (const char*) bind.buffer, bind.buffer_length);
+#else
+      auto size = mysql_real_escape_string_quote(m_handle, &result[1], (const char*) bind.buffer, bind.buffer_length, '\'');
+#endif
+      result[size + 1] = '\'';
+      result.resize(size + 2);
+      return oatpp::String(std::move(result));
+    }
+
+    case MYSQL_TYPE_BLOB: {
+      // binary values as the hex literal - X'0a1b...'
+      static const char* HEX = "0123456789abcdef";
+      auto bytes = (const v_uint8*) bind.buffer;
+      std::string result;
+      result.reserve(bind.buffer_length * 2 + 3);
+      result.append("X'");
+      for(unsigned long i = 0; i < bind.buffer_length; i ++) {
+        result.push_back(HEX[bytes[i] >> 4]);
+        result.push_back(HEX[bytes[i] & 0x0F]);
+      }
+      result.push_back('\'');
+      return oatpp::String(std::move(result));
+    }
+
+    case MYSQL_TYPE_NEWDECIMAL:
+      // formatted by the serializer - digits, sign and point only
+      return oatpp::String((const char*) bind.buffer, bind.buffer_length);
+
+    case MYSQL_TYPE_DATE:
+    case MYSQL_TYPE_DATETIME:
+    case MYSQL_TYPE_TIMESTAMP:
+    case MYSQL_TYPE_TIME: {
+      char buff[mapping::TimeCodec::MAX_TEXT_SIZE + 2];
+      buff[0] = '\'';
+      auto size = mapping::TimeCodec::format(*(const MYSQL_TIME*) bind.buffer, buff + 1);
+      buff[size + 1] = '\'';
+      return oatpp::String(buff, size + 2);
+    }
+
+    default:
+      break;
+
+  }
+
+  throw std::runtime_error("[oatpp::mysql::ql_template::LiteralValueProvider::getLiteral()]: Error. "
+                           "Unsupported parameter type for the text protocol. Parameter name: " + variable.name);
+
+}
+
+}}}
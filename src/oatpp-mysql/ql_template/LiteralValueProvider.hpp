@@ -0,0 +1,77 @@
+/***************************************************************************
+ *
+ * Project         _____    __   ____   _      _
+ *                (  _  )  /__\ (_  _)_| |_  _| |_
+ *                 )(_)(  /(__)\  )( (_   _)(_   _)
+ *                (_____)(__)(__)(__)  |_|    |_|
+ *
+ *
+ * Copyright 2018-present, Leonid Stryzhevskyi <lganzzzo@gmail.com>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ ***************************************************************************/
+
+#ifndef oatpp_mysql_ql_template_LiteralValueProvider_hpp
+#define oatpp_mysql_ql_template_LiteralValueProvider_hpp
+
+#include "oatpp/data/share/StringTemplate.hpp"
+
+#ifdef _WIN32
+    #include "mysql.h"
+#else
+    #include "mysql/mysql.h"
+#endif // _WIN32
+
+#include <vector>
+
+namespace oatpp { namespace mysql { namespace ql_template {
+
+/**
+ * &id:oatpp::data::share::StringTemplate::ValueProvider; substituting template parameters with escaped SQL literals. <br>
+ * Used for the client-side prepared queries of the text protocol (&id:oatpp::mysql::NonBlockingEngine;).
+ * Values are taken from the param binds produced by &id:oatpp::mysql::mapping::Serializer;.
+ */
+class LiteralValueProvider : public data::share::StringTemplate::ValueProvider {
+private:
+  oatpp::String getLiteral(const MYSQL_BIND& bind, const data::share::StringTemplate::Variable& variable);
+private:
+  MYSQL* m_handle;
+  const std::vector<MYSQL_BIND>& m_binds;
+  std::vector<v_uint32> m_offsets;
+  std::vector<v_uint32> m_counts;
+public:
+
+  /**
+   * Constructor.
+   * @param handle - connection handle. Used to escape strings according to the connection charset.
+   * @param binds - param binds. Bind index corresponds to the template variable index.
+   */
+  LiteralValueProvider(MYSQL* handle, const std::vector<MYSQL_BIND>& binds);
+
+  /**
+   * Constructor for the templates with list parameters.
+   * @param handle - connection handle. Used to escape strings according to the connection charset.
+   * @param binds - param binds in the variable order.
+   * @param counts - number of binds of each template variable. List variables are substituted
+   * with the comma-separated literals, empty lists with &id:oatpp::mysql::ql_template::ListExpander::EMPTY_LIST;.
+   */
+  LiteralValueProvider(MYSQL* handle, const std::vector<MYSQL_BIND>& binds, const std::vector<v_uint32>& counts);
+
+  oatpp::String getValue(const data::share::StringTemplate::Variable& variable, v_uint32 index) override;
+
+};
+
+}}}
+
+#endif // oatpp_mysql_ql_template_LiteralValueProvider_hpp
@@ -27,8 +27,23 @@
 #include "oatpp/data/stream/BufferStream.hpp"
 #include "oatpp/utils/parser/ParsingError.hpp"
 
+#include <cctype>
+#include <unordered_set>
+
 namespace oatpp { namespace mysql { namespace ql_template {
 
+bool Parser::TemplateExtra::hasHint(const oatpp::String& name) const {
+  return hints.find(name) != hints.end();
+}
+
+oatpp::String Parser::TemplateExtra::getHint(const oatpp::String& name) const {
+  auto it = hints.find(name);
+  if(it != hints.end()) {
+    return it->second;
+  }
+  return nullptr;
+}
+
 // create a variable which starts with ':' and ends with a non-alphanumeric character except '_' or '.'
 // e.g. :my_var.val
 data::share::StringTemplate::Variable Parser::parseIdentifier(utils::parser::Caret& caret) {
@@ -103,11 +118,168 @@ void Parser::skipStringInDollars(utils::parser::Caret& caret) {
 
 }
 
+// skip a comment enclosed in "/*" and "*/". Comments starting with "oatpp:" hold query hints
+// e.g. "/*oatpp: compress, shard_key=user.id*/"
+void Parser::skipComment(utils::parser::Caret& caret, TemplateExtra& extra) {
+
+  caret.inc(2);
+  auto label = caret.putLabel();
+
+  if(!caret.findText("*/", 2)) {
+    caret.setError("Invalid comment");
+    return;
+  }
+
+  parseHints(label.std_str(), extra);
+  caret.inc(2);
+
+}
+
+// skip a comment till the end of the line, e.g. "-- comment" or "# comment"
+void Parser::skipLineComment(utils::parser::Caret& caret) {
+  while(caret.canContinue()) {
+    v_char8 c = *caret.getCurrData();
+    caret.inc();
+    if(c == '\n') {
+      return;
+    }
+  }
+}
+
+void Parser::parseHints(const std::string& comment, TemplateExtra& extra) {
+
+  static const std::string prefix = "oatpp:";
+
+  size_t pos = comment.find_first_not_of(" \t\r\n");
+  if(pos == std::string::npos || comment.compare(pos, prefix.size(), prefix) != 0) {
+    return;
+  }
+  pos += prefix.size();
+
+  // hints are separated by commas or whitespaces. e.g. "compress, shard_key=user.id"
+  static const char* separators = " \t\r\n,";
+  while(pos < comment.size()) {
+
+    pos = comment.find_first_not_of(separators, pos);
+    if(pos == std::string::npos) {
+      break;
+    }
+
+    size_t end = comment.find_first_of(separators, pos);
+    if(end == std::string::npos) {
+      end = comment.size();
+    }
+
+    std::string hint = comment.substr(pos, end - pos);
+    size_t eq = hint.find('=');
+    if(eq == std::string::npos) {
+      extra.hints[hint] = "";
+    } else {
+      extra.hints[hint.substr(0, eq)] = hint.substr(eq + 1);
+    }
+
+    pos = end;
+
+  }
+
+}
+
+// classify statement by its words outside of comments and strings.
+// e.g. "SELECT * FROM t" -> true, "SELECT * FROM t FOR UPDATE" -> false, "INSERT INTO t ..." -> false,
+// "SELECT LAST_INSERT_ID()" -> false - session state lives on the primary connection
+bool Parser::isReadOnlyStatement(const std::string& text) {
+
+  std::vector<std::string> words;
+  bool hasVariables = false;
+
+  size_t i = 0;
+  while(i < text.size()) {
+
+    char c = text[i];
+
+    if(c == '/' && i + 1 < text.size() && text[i + 1] == '*') {
+      size_t end = text.find("*/", i + 2);
+      i = (end == std::string::npos) ? text.size() : end + 2;
+    } else if(c == '#' || (c == '-' && i + 2 < text.size() && text[i + 1] == '-' && std::isspace((unsigned char) text[i + 2]))) {
+      size_t end = text.find('\n', i);
+      i = (end == std::string::npos) ? text.size() : end + 1;
+    } else if(c == '\'' || c == '"' || c == '`') {
+      size_t end = i + 1;
+      while(end < text.size() && text[end] != c) {
+        if(text[end] == '\\') {
+          end ++;
+        }
+        end ++;
+      }
+      i = end + 1;
+    } else if(c == '@') {
+      // user and system variables are session-scoped
+      hasVariables = true;
+      i ++;
+    } else if(std::isalpha((unsigned char) c) || c == '_') {
+      size_t start = i;
+      while(i < text.size() && (std::isalnum((unsigned char) text[i]) || text[i] == '_')) {
+        i ++;
+      }
+      std::string word = text.substr(start, i - start);
+      for(auto& ch : word) {
+        ch = (char) std::toupper((unsigned char) ch);
+      }
+      words.push_back(std::move(word));
+    } else {
+      i ++;
+    }
+
+  }
+
+  if(words.empty() || hasVariables) {
+    return false;
+  }
+
+  static const std::unordered_set<std::string> readKeywords = {
+    "SELECT", "SHOW", "DESCRIBE", "DESC", "EXPLAIN", "WITH", "TABLE", "VALUES"
+  };
+
+  // results depend on the session - a replica connection would answer for another session
+  static const std::unordered_set<std::string> sessionFunctions = {
+    "LAST_INSERT_ID", "FOUND_ROWS", "ROW_COUNT", "CONNECTION_ID",
+    "GET_LOCK", "RELEASE_LOCK", "RELEASE_ALL_LOCKS", "IS_FREE_LOCK", "IS_USED_LOCK",
+    "WARNINGS", "ERRORS"
+  };
+
+  if(readKeywords.find(words[0]) == readKeywords.end()) {
+    return false;
+  }
+
+  for(auto& word : words) {
+    if(sessionFunctions.find(word) != sessionFunctions.end()) {
+      return false;
+    }
+  }
+
+  for(size_t w = 0; w + 1 < words.size(); w ++) {
+    // locking reads and data-modifying CTEs must go to the primary
+    if(words[w] == "FOR" && (words[w + 1] == "UPDATE" || words[w + 1] == "SHARE")) {
+      return false;
+    }
+    if(words[w] == "LOCK" && words[w + 1] == "IN") {
+      return false;
+    }
+    if(words[0] == "WITH" && (words[w + 1] == "UPDATE" || words[w + 1] == "DELETE" || words[w + 1] == "INSERT")) {
+      return false;
+    }
+  }
+
+  return true;
+
+}
+
 // find all variables in the given text and return a StringTemplate object
 // e.g. "SELECT * FROM table WHERE id = :id AND name = 'John'" -> ':id' is a variable
 data::share::StringTemplate Parser::parseTemplate(const oatpp::String& text) {
 	utils::parser::Caret caret(text);
 
+  auto extra = std::make_shared<TemplateExtra>();
   std::vector<data::share::StringTemplate::Variable> variables;
 
   while(caret.canContinue()) {
@@ -126,6 +298,29 @@ data::share::StringTemplate Parser::parseTemplate(const oatpp::String& text) {
       case '\'': skipStringInQuotes(caret); break;
       case '$': skipStringInDollars(caret); break;
 
+      case '/': {
+        if(caret.isAtText("/*", 2)) {
+          skipComment(caret, *extra);
+        } else {
+          caret.inc();
+        }
+      }
+        break;
+
+      case '-': {
+        // "-- " comment requires a whitespace after the dashes
+        if(caret.isAtText("--", 2) && (caret.getPosition() + 2 >= caret.getDataSize() ||
+                                       caret.getCurrData()[2] == ' ' || caret.getCurrData()[2] == '\t' ||
+                                       caret.getCurrData()[2] == '\n' || caret.getCurrData()[2] == '\r')) {
+          skipLineComment(caret);
+        } else {
+          caret.inc();
+        }
+      }
+        break;
+
+      case '#': skipLineComment(caret); break;
+
       default:
         caret.inc();
 
@@ -137,7 +332,17 @@ data::share::StringTemplate Parser::parseTemplate(const oatpp::String& text) {
     throw oatpp::utils::parser::ParsingError(caret.getErrorMessage(), caret.getErrorCode(), caret.getPosition());
   }
 
-  return data::share::StringTemplate(text, std::move(variables));
+  if(extra->hasHint("read")) {
+    extra->readOnly = true;
+  } else if(extra->hasHint("write")) {
+    extra->readOnly = false;
+  } else {
+    extra->readOnly = isReadOnlyStatement(*text);
+  }
+
+  data::share::StringTemplate t(text, std::move(variables));
+  t.setExtraData(extra);
+  return t;
 
 }
 
@@ -28,6 +28,8 @@
 #include "oatpp/data/share/StringTemplate.hpp"
 #include "oatpp/utils/parser/Caret.hpp"
 
+#include <unordered_map>
+
 namespace oatpp { namespace mysql { namespace ql_template {
 
 /**
@@ -54,17 +56,52 @@ public:
     /**
      * Use prepared statement for this query.
      */
-    bool prepare;
+    bool prepare = false;
+
+    /**
+     * Query doesn't modify data and may be routed to a replica. <br>
+     * Detected from the statement keyword - `SELECT`, `SHOW`, `EXPLAIN`, etc. Locking reads (`FOR UPDATE`, `FOR SHARE`)
+     * are not read-only, neither are reads of the session state - `LAST_INSERT_ID()`, `FOUND_ROWS()`, `GET_LOCK()`,
+     * `SHOW WARNINGS`, user and system variables (`@var`). Can be overridden with the `read` or `write` hint.
+     */
+    bool readOnly = false;
+
+    /**
+     * Query hints. Hints are given in the query comment starting with `oatpp:`. <br>
+     * Ex.: `SELECT * FROM users /&#42;oatpp: compress, shard_key=user.id&#42;/`. <br>
+     * Flag hints are stored with empty value.
+     */
+    std::unordered_map<oatpp::String, oatpp::String> hints;
+
+    /**
+     * Check if query has hint.
+     * @param name - hint name.
+     * @return
+     */
+    bool hasHint(const oatpp::String& name) const;
+
+    /**
+     * Get hint value.
+     * @param name - hint name.
+     * @return - hint value. `nullptr` if there is no such hint.
+     */
+    oatpp::String getHint(const oatpp::String& name) const;
+
   };
 
 private:
   static data::share::StringTemplate::Variable parseIdentifier(utils::parser::Caret& caret);
   static void skipStringInQuotes(utils::parser::Caret& caret);
   static void skipStringInDollars(utils::parser::Caret& caret);
+  static void skipComment(utils::parser::Caret& caret, TemplateExtra& extra);
+  static void skipLineComment(utils::parser::Caret& caret);
+  static void parseHints(const std::string& comment, TemplateExtra& extra);
+  static bool isReadOnlyStatement(const std::string& text);
 public:
 
   /**
-   * Parse query template.
+   * Parse query template. <br>
+   * Template extra data is set to &l:Parser::TemplateExtra; with query hints parsed.
    * @param text
    * @return - &id:oatpp::data::share::StringTemplate;.
    */
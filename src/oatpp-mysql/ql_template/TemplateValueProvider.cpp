@@ -26,9 +26,16 @@
 
 namespace oatpp { namespace mysql { namespace ql_template {
 
+TemplateValueProvider::TemplateValueProvider(const std::vector<oatpp::String>* placeholders)
+  : m_placeholders(placeholders)
+{}
+
 // e.g. select * from t_user where id = :user.id and name = :user.name
 //   -> select * from t_user where id = ? and name = ?
 oatpp::String TemplateValueProvider::getValue(const data::share::StringTemplate::Variable& variable, v_uint32 index) {
+  if(m_placeholders && index < m_placeholders->size() && (*m_placeholders)[index]) {
+    return (*m_placeholders)[index];
+  }
   m_buffStream.setCurrentPosition(0);
   m_buffStream << "?";
   return m_buffStream.toString();
@@ -28,6 +28,8 @@
 #include "oatpp/orm/Executor.hpp"
 #include "oatpp/data/stream/BufferStream.hpp"
 
+#include <vector>
+
 namespace oatpp { namespace mysql { namespace ql_template {
 
 /**
@@ -36,7 +38,16 @@ namespace oatpp { namespace mysql { namespace ql_template {
 class TemplateValueProvider : public data::share::StringTemplate::ValueProvider {
 private:
   data::stream::BufferOutputStream m_buffStream;
+  const std::vector<oatpp::String>* m_placeholders;
 public:
+
+  /**
+   * Constructor.
+   * @param placeholders - placeholder text of each template variable. Ex.: `?,?,?,?` of the expanded list. <br>
+   * `nullptr` or `nullptr` entry - single `?`.
+   */
+  TemplateValueProvider(const std::vector<oatpp::String>* placeholders = nullptr);
+
   oatpp::String getValue(const data::share::StringTemplate::Variable& variable, v_uint32 index) override;
 };
 
@@ -0,0 +1,102 @@
+#include "CsvRowSink.hpp"
+
+#include <cmath>
+
+namespace oatpp { namespace mysql { namespace stream {
+
+CsvRowSink::CsvRowSink()
+  : m_config(Config())
+{}
+
+CsvRowSink::CsvRowSink(const Config& config)
+  : m_config(config)
+{}
+
+void CsvRowSink::writeField(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size) {
+
+  bool quote = false;
+  for(v_buff_size i = 0; i < size; i ++) {
+    char c = data[i];
+    if(c == m_config.delimiter || c == '"' || c == '\r' || c == '\n') {
+      quote = true;
+      break;
+    }
+  }
+
+  if(!quote) {
+    stream->writeSimple(data, size);
+    return;
+  }
+
+  stream->writeSimple("\"", 1);
+
+  v_buff_size runStart = 0;
+  for(v_buff_size i = 0; i < size; i ++) {
+    if(data[i] == '"') {
+      // write the run including the quote, the quote is repeated by the next run
+      stream->writeSimple(data + runStart, i + 1 - runStart);
+      runStart = i;
+    }
+  }
+  stream->writeSimple(data + runStart, size - runStart);
+
+  stream->writeSimple("\"", 1);
+
+}
+
+void CsvRowSink::writeBegin(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) {
+
+  if(!m_config.header) {
+    return;
+  }
+
+  for(v_int32 i = 0; i < dbData->colCount; i ++) {
+    if(i > 0) {
+      stream->writeSimple(&m_config.delimiter, 1);
+    }
+    writeField(stream, dbData->colNames[i]->data(), dbData->colNames[i]->size());
+  }
+  stream->writeSimple("\r\n", 2);
+
+}
+
+void CsvRowSink::writeRow(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) {
+
+  for(v_int32 i = 0; i < dbData->colCount; i ++) {
+
+    if(i > 0) {
+      stream->writeSimple(&m_config.delimiter, 1);
+    }
+
+    const MYSQL_BIND& bind = dbData->bindResults[i];
+    if(isNull(bind)) {
+      continue;
+    }
+
+    if(isNumber(bind)) {
+      // NaN and infinity - empty field
+      if(bind.buffer_type == MYSQL_TYPE_FLOAT && !std::isfinite(*static_cast<v_float32*>(bind.buffer))) {
+        continue;
+      }
+      if(bind.buffer_type == MYSQL_TYPE_DOUBLE && !std::isfinite(*static_cast<v_float64*>(bind.buffer))) {
+        continue;
+      }
+      writeNumber(stream, bind);
+    } else {
+      char buffer[mapping::TimeCodec::MAX_TEXT_SIZE];
+      v_buff_size size;
+      auto text = getText(bind, buffer, size);
+      writeField(stream, text, size);
+    }
+
+  }
+
+  stream->writeSimple("\r\n", 2);
+
+}
+
+void CsvRowSink::writeEnd(data::stream::ConsistentOutputStream* stream) {
+  (void) stream;
+}
+
+}}}
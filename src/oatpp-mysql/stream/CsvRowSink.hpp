@@ -0,0 +1,66 @@
+#ifndef oatpp_mysql_stream_CsvRowSink_hpp
+#define oatpp_mysql_stream_CsvRowSink_hpp
+
+#include "RowSink.hpp"
+
+namespace oatpp { namespace mysql { namespace stream {
+
+/**
+ * Write rows as RFC-4180 CSV. <br>
+ * Records end with CRLF. Values containing the delimiter, double quote, CR or LF are enclosed in double quotes,
+ * double quotes inside are doubled. Null is written as an empty field.
+ */
+class CsvRowSink : public RowSink {
+public:
+
+  /**
+   * CSV config.
+   */
+  struct Config {
+
+    /**
+     * Field delimiter.
+     */
+    char delimiter = ',';
+
+    /**
+     * Write header record with column names.
+     */
+    bool header = true;
+
+  };
+
+private:
+  Config m_config;
+public:
+
+  /**
+   * Constructor with default config.
+   */
+  CsvRowSink();
+
+  /**
+   * Constructor.
+   * @param config - &l:CsvRowSink::Config;.
+   */
+  CsvRowSink(const Config& config);
+
+  /**
+   * Write field value, quoted if it contains the delimiter, double quote, CR or LF.
+   * @param stream
+   * @param data
+   * @param size
+   */
+  void writeField(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size);
+
+  void writeBegin(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) override;
+
+  void writeRow(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) override;
+
+  void writeEnd(data::stream::ConsistentOutputStream* stream) override;
+
+};
+
+}}}
+
+#endif // oatpp_mysql_stream_CsvRowSink_hpp
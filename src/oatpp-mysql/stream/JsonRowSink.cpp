@@ -0,0 +1,392 @@
+#include "JsonRowSink.hpp"
+
+#include "oatpp-mysql/Types.hpp"
+#include "oatpp-mysql/mapping/UuidCodec.hpp"
+#include "oatpp/data/stream/BufferStream.hpp"
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+namespace oatpp { namespace mysql { namespace stream {
+
+JsonRowSink::JsonRowSink(const oatpp::Type* dtoType)
+  : m_dtoType(dtoType)
+  , m_firstRow(true)
+{
+  if(m_dtoType && m_dtoType->classId.id != data::type::__class::AbstractObject::CLASS_ID.id) {
+    throw std::runtime_error("[oatpp::mysql::stream::JsonRowSink::JsonRowSink()]: Error. "
+                             "Type '" + std::string(m_dtoType->classId.name) + "' is not an oatpp::Object.");
+  }
+}
+
+JsonRowSink::ValueKind JsonRowSink::getValueKind(const oatpp::Type* type) {
+
+  auto id = type->classId.id;
+
+  if(id == data::type::__class::String::CLASS_ID.id) {
+    return ValueKind::STRING;
+  }
+
+  if(id == data::type::__class::Boolean::CLASS_ID.id) {
+    return ValueKind::BOOLEAN;
+  }
+
+  if(id == data::type::__class::Int8::CLASS_ID.id || id == data::type::__class::UInt8::CLASS_ID.id ||
+     id == data::type::__class::Int16::CLASS_ID.id || id == data::type::__class::UInt16::CLASS_ID.id ||
+     id == data::type::__class::Int32::CLASS_ID.id || id == data::type::__class::UInt32::CLASS_ID.id ||
+     id == data::type::__class::Int64::CLASS_ID.id || id == data::type::__class::UInt64::CLASS_ID.id ||
+     id == data::type::__class::Float32::CLASS_ID.id || id == data::type::__class::Float64::CLASS_ID.id ||
+     id == mysql::__class::Timestamp::CLASS_ID.id || id == mysql::__class::Decimal::CLASS_ID.id)
+  {
+    return ValueKind::NUMBER;
+  }
+
+  if(id == mysql::__class::Uuid::CLASS_ID.id) {
+    return ValueKind::UUID;
+  }
+
+  return ValueKind::AUTO;
+
+}
+
+// JSON number grammar - strtod() would also take hex, inf and nan
+bool JsonRowSink::isNumberText(const char* data, v_buff_size size) {
+
+  v_buff_size i = 0;
+
+  auto digits = [data, size, &i]() {
+    v_buff_size start = i;
+    while(i < size && std::isdigit((unsigned char) data[i])) {
+      i ++;
+    }
+    return i - start;
+  };
+
+  if(i < size && data[i] == '-') {
+    i ++;
+  }
+
+  // JSON doesn't allow leading zeros
+  if(i < size && data[i] == '0') {
+    i ++;
+  } else if(digits() == 0) {
+    return false;
+  }
+
+  if(i < size && data[i] == '.') {
+    i ++;
+    if(digits() == 0) {
+      return false;
+    }
+  }
+
+  if(i < size && (data[i] == 'e' || data[i] == 'E')) {
+    i ++;
+    if(i < size && (data[i] == '+' || data[i] == '-')) {
+      i ++;
+    }
+    if(digits() == 0) {
+      return false;
+    }
+  }
+
+  return i == size;
+
+}
+
+bool JsonRowSink::isBinaryColumn(const ResultData* dbData, v_int32 index) {
+
+  MYSQL_RES* meta = dbData->metaResults ? dbData->metaResults : dbData->textResults;
+  if(meta == nullptr) {
+    return false;
+  }
+
+  MYSQL_FIELD* field = mysql_fetch_field_direct(meta, (unsigned int) index);
+  switch(field->type) {
+    case MYSQL_TYPE_STRING:
+    case MYSQL_TYPE_VAR_STRING:
+    case MYSQL_TYPE_VARCHAR:
+    case MYSQL_TYPE_TINY_BLOB:
+    case MYSQL_TYPE_BLOB:
+    case MYSQL_TYPE_MEDIUM_BLOB:
+    case MYSQL_TYPE_LONG_BLOB:
+    case MYSQL_TYPE_BIT:
+      // 63 - the binary character set
+      return field->charsetnr == 63;
+    default:
+      return false;
+  }
+
+}
+
+void JsonRowSink::writeString(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size) {
+
+  static const char* HEX = "0123456789abcdef";
+
+  stream->writeSimple("\"", 1);
+
+  v_buff_size runStart = 0;
+
+  for(v_buff_size i = 0; i < size; i ++) {
+
+    auto c = static_cast<v_uint8>(data[i]);
+    if(c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+
+    if(i > runStart) {
+      stream->writeSimple(data + runStart, i - runStart);
+    }
+    runStart = i + 1;
+
+    switch(c) {
+      case '"': stream->writeSimple("\\\"", 2); break;
+      case '\\': stream->writeSimple("\\\\", 2); break;
+      case '\n': stream->writeSimple("\\n", 2); break;
+      case '\r': stream->writeSimple("\\r", 2); break;
+      case '\t': stream->writeSimple("\\t", 2); break;
+      case '\b': stream->writeSimple("\\b", 2); break;
+      case '\f': stream->writeSimple("\\f", 2); break;
+      default: {
+        char escaped[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0x0F]};
+        stream->writeSimple(escaped, 6);
+      }
+    }
+
+  }
+
+  if(size > runStart) {
+    stream->writeSimple(data + runStart, size - runStart);
+  }
+
+  stream->writeSimple("\"", 1);
+
+}
+
+void JsonRowSink::writeBase64(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size) {
+
+  static const char* ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  stream->writeSimple("\"", 1);
+
+  // 3 bytes -> 4 chars, encoded in chunks on the stack
+  char buffer[256];
+  v_buff_size position = 0;
+  const v_uint8* bytes = reinterpret_cast<const v_uint8*>(data);
+
+  for(v_buff_size i = 0; i < size; i += 3) {
+
+    v_uint32 group = (v_uint32) bytes[i] << 16;
+    if(i + 1 < size) group |= (v_uint32) bytes[i + 1] << 8;
+    if(i + 2 < size) group |= (v_uint32) bytes[i + 2];
+
+    buffer[position ++] = ALPHABET[(group >> 18) & 0x3F];
+    buffer[position ++] = ALPHABET[(group >> 12) & 0x3F];
+    buffer[position ++] = i + 1 < size ? ALPHABET[(group >> 6) & 0x3F] : '=';
+    buffer[position ++] = i + 2 < size ? ALPHABET[group & 0x3F] : '=';
+
+    if(position == sizeof(buffer)) {
+      stream->writeSimple(buffer, position);
+      position = 0;
+    }
+
+  }
+
+  if(position > 0) {
+    stream->writeSimple(buffer, position);
+  }
+
+  stream->writeSimple("\"", 1);
+
+}
+
+void JsonRowSink::writeValue(data::stream::ConsistentOutputStream* stream, const MYSQL_BIND& bind, ValueKind kind, bool binary) {
+
+  if(isNull(bind)) {
+    stream->writeSimple("null", 4);
+    return;
+  }
+
+  bool number = isNumber(bind);
+
+  // raw bytes are not JSON text. UUID kind formats 16-byte values itself
+  if(binary && !number && kind != ValueKind::BOOLEAN && kind != ValueKind::UUID) {
+    v_buff_size size;
+    auto text = getText(bind, nullptr, size);
+    writeBase64(stream, text, size);
+    return;
+  }
+
+  switch(kind) {
+
+    case ValueKind::BOOLEAN: {
+      bool value;
+      if(isInteger(bind)) {
+        value = readInteger(bind) != 0;
+      } else if(number) {
+        value = (bind.buffer_type == MYSQL_TYPE_FLOAT ? *static_cast<v_float32*>(bind.buffer) : *static_cast<v_float64*>(bind.buffer)) != 0;
+      } else {
+        char buffer[mapping::TimeCodec::MAX_TEXT_SIZE];
+        v_buff_size size;
+        auto text = getText(bind, buffer, size);
+        value = size > 0 && !(size == 1 && text[0] == '0');
+      }
+      if(value) {
+        stream->writeSimple("true", 4);
+      } else {
+        stream->writeSimple("false", 5);
+      }
+      return;
+    }
+
+    case ValueKind::STRING: {
+      if(number) {
+        stream->writeSimple("\"", 1);
+        writeNumber(stream, bind);
+        stream->writeSimple("\"", 1);
+      } else {
+        char buffer[mapping::TimeCodec::MAX_TEXT_SIZE];
+        v_buff_size size;
+        auto text = getText(bind, buffer, size);
+        writeString(stream, text, size);
+      }
+      return;
+    }
+
+    case ValueKind::NUMBER: {
+      if(number) {
+        writeNumber(stream, bind);
+      } else if(isTemporal(bind)) {
+        // same as mysql::Timestamp - microseconds since the Unix epoch
+        char buffer[32];
+        auto size = std::snprintf(buffer, sizeof(buffer), "%lld",
+                                  (long long) mapping::TimeCodec::toEpochMicros(*static_cast<const MYSQL_TIME*>(bind.buffer)));
+        stream->writeSimple(buffer, size);
+      } else {
+        char buffer[mapping::TimeCodec::MAX_TEXT_SIZE];
+        v_buff_size size;
+        auto text = getText(bind, buffer, size);
+        if(isNumberText(text, size)) {
+          stream->writeSimple(text, size);
+        } else {
+          writeString(stream, text, size);
+        }
+      }
+      return;
+    }
+
+    case ValueKind::UUID: {
+      if(number) {
+        writeNumber(stream, bind);
+        return;
+      }
+      char buffer[mapping::TimeCodec::MAX_TEXT_SIZE];
+      v_buff_size size;
+      auto text = getText(bind, buffer, size);
+      if(size == mapping::UuidCodec::SIZE) {
+        char uuid[mapping::UuidCodec::TEXT_SIZE];
+        mapping::UuidCodec::format((const v_uint8*) text, uuid);
+        writeString(stream, uuid, mapping::UuidCodec::TEXT_SIZE);
+      } else if(binary) {
+        writeBase64(stream, text, size);
+      } else {
+        writeString(stream, text, size);
+      }
+      return;
+    }
+
+    default: {
+      if(number) {
+        writeNumber(stream, bind);
+      } else if(bind.buffer_type == MYSQL_TYPE_NEWDECIMAL) {
+        // decimal text is a valid JSON number - written as is, without losing digits
+        v_buff_size size;
+        auto text = getText(bind, nullptr, size);
+        stream->writeSimple(text, size);
+      } else {
+        char buffer[mapping::TimeCodec::MAX_TEXT_SIZE];
+        v_buff_size size;
+        auto text = getText(bind, buffer, size);
+        writeString(stream, text, size);
+      }
+    }
+
+  }
+
+}
+
+void JsonRowSink::initColumns(const ResultData* dbData) {
+
+  m_columns.clear();
+
+  const oatpp::BaseObject::Properties* properties = nullptr;
+  if(m_dtoType) {
+    auto dispatcher = static_cast<const data::type::__class::AbstractObject::PolymorphicDispatcher*>(m_dtoType->polymorphicDispatcher);
+    properties = dispatcher->getProperties();
+  }
+
+  for(v_int32 i = 0; i < dbData->colCount; i ++) {
+
+    Column column;
+    column.index = i;
+    column.kind = ValueKind::AUTO;
+    column.binary = isBinaryColumn(dbData, i);
+
+    data::stream::BufferOutputStream key;
+    if(properties) {
+      auto it = properties->getMap().find(*dbData->colNames[i]);
+      if(it == properties->getMap().end()) {
+        continue;
+      }
+      column.kind = getValueKind(it->second->type);
+      writeString(&key, it->second->name, std::strlen(it->second->name));
+    } else {
+      writeString(&key, dbData->colNames[i]->data(), dbData->colNames[i]->size());
+    }
+    key.writeSimple(":", 1);
+    column.key = *key.toString();
+
+    m_columns.push_back(column);
+
+  }
+
+}
+
+void JsonRowSink::writeObject(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) {
+
+  stream->writeSimple("{", 1);
+
+  for(size_t i = 0; i < m_columns.size(); i ++) {
+    auto& column = m_columns[i];
+    if(i > 0) {
+      stream->writeSimple(",", 1);
+    }
+    stream->writeSimple(column.key.data(), column.key.size());
+    writeValue(stream, dbData->bindResults[column.index], column.kind, column.binary);
+  }
+
+  stream->writeSimple("}", 1);
+
+}
+
+void JsonRowSink::writeBegin(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) {
+  initColumns(dbData);
+  m_firstRow = true;
+  stream->writeSimple("[", 1);
+}
+
+void JsonRowSink::writeRow(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) {
+  if(m_firstRow) {
+    m_firstRow = false;
+  } else {
+    stream->writeSimple(",", 1);
+  }
+  writeObject(stream, dbData);
+}
+
+void JsonRowSink::writeEnd(data::stream::ConsistentOutputStream* stream) {
+  stream->writeSimple("]", 1);
+}
+
+}}}
@@ -0,0 +1,128 @@
+#ifndef oatpp_mysql_stream_JsonRowSink_hpp
+#define oatpp_mysql_stream_JsonRowSink_hpp
+
+#include "RowSink.hpp"
+
+#include <string>
+#include <vector>
+
+namespace oatpp { namespace mysql { namespace stream {
+
+/**
+ * Write rows as JSON array of objects - `[{"col":value,...},...]`. <br>
+ * Keys and value kinds are taken from the column metadata. If DTO type is given, keys and value kinds
+ * are taken from the DTO fields matching the columns, and columns without a field are skipped. <br>
+ * Values of the binary columns (`BINARY`, `VARBINARY`, `BLOB`, `BIT` - the `binary` character set) are not text,
+ * they are written as base64 strings.
+ */
+class JsonRowSink : public RowSink {
+public:
+
+  /**
+   * How the column value is written.
+   */
+  enum class ValueKind : v_int32 {
+
+    /**
+     * Numbers and decimals as JSON numbers, everything else as strings.
+     */
+    AUTO,
+
+    /**
+     * Always as JSON string.
+     */
+    STRING,
+
+    /**
+     * As `true`/`false`.
+     */
+    BOOLEAN,
+
+    /**
+     * As JSON number. Text values which are not numbers are written as strings.
+     */
+    NUMBER,
+
+    /**
+     * As UUID text. 16-byte values are formatted as `xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx`, others are written as strings.
+     */
+    UUID
+
+  };
+
+private:
+
+  struct Column {
+    v_int32 index;
+    std::string key; // quoted key with colon - "name":
+    ValueKind kind;
+    bool binary;
+  };
+
+private:
+  static ValueKind getValueKind(const oatpp::Type* type);
+  static bool isBinaryColumn(const ResultData* dbData, v_int32 index);
+private:
+  const oatpp::Type* m_dtoType;
+  std::vector<Column> m_columns;
+  bool m_firstRow;
+private:
+  void writeValue(data::stream::ConsistentOutputStream* stream, const MYSQL_BIND& bind, ValueKind kind, bool binary);
+protected:
+
+  /**
+   * Resolve keys and value kinds of the result columns.
+   * @param dbData
+   */
+  void initColumns(const ResultData* dbData);
+
+  /**
+   * Write the current row as JSON object.
+   * @param stream
+   * @param dbData
+   */
+  void writeObject(data::stream::ConsistentOutputStream* stream, const ResultData* dbData);
+
+public:
+
+  /**
+   * Constructor.
+   * @param dtoType - DTO type for naming and typing. `nullptr` - use column metadata.
+   */
+  JsonRowSink(const oatpp::Type* dtoType = nullptr);
+
+  /**
+   * Write JSON string with escaping.
+   * @param stream
+   * @param data
+   * @param size
+   */
+  static void writeString(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size);
+
+  /**
+   * Write bytes as JSON string in base64.
+   * @param stream
+   * @param data
+   * @param size
+   */
+  static void writeBase64(data::stream::ConsistentOutputStream* stream, const char* data, v_buff_size size);
+
+  /**
+   * Check if text is a JSON number - `-?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?`.
+   * @param data
+   * @param size
+   * @return
+   */
+  static bool isNumberText(const char* data, v_buff_size size);
+
+  void writeBegin(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) override;
+
+  void writeRow(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) override;
+
+  void writeEnd(data::stream::ConsistentOutputStream* stream) override;
+
+};
+
+}}}
+
+#endif // oatpp_mysql_stream_JsonRowSink_hpp
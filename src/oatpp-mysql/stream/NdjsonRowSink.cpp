@@ -0,0 +1,23 @@
+#include "NdjsonRowSink.hpp"
+
+namespace oatpp { namespace mysql { namespace stream {
+
+NdjsonRowSink::NdjsonRowSink(const oatpp::Type* dtoType)
+  : JsonRowSink(dtoType)
+{}
+
+void NdjsonRowSink::writeBegin(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) {
+  (void) stream;
+  initColumns(dbData);
+}
+
+void NdjsonRowSink::writeRow(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) {
+  writeObject(stream, dbData);
+  stream->writeSimple("\n", 1);
+}
+
+void NdjsonRowSink::writeEnd(data::stream::ConsistentOutputStream* stream) {
+  (void) stream;
+}
+
+}}}
@@ -0,0 +1,31 @@
+#ifndef oatpp_mysql_stream_NdjsonRowSink_hpp
+#define oatpp_mysql_stream_NdjsonRowSink_hpp
+
+#include "JsonRowSink.hpp"
+
+namespace oatpp { namespace mysql { namespace stream {
+
+/**
+ * Write rows as newline-delimited JSON - one JSON object per line. <br>
+ * Keys and value kinds are resolved the same way as in &l:JsonRowSink;.
+ */
+class NdjsonRowSink : public JsonRowSink {
+public:
+
+  /**
+   * Constructor.
+   * @param dtoType - DTO type for naming and typing. `nullptr` - use column metadata.
+   */
+  NdjsonRowSink(const oatpp::Type* dtoType = nullptr);
+
+  void writeBegin(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) override;
+
+  void writeRow(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) override;
+
+  void writeEnd(data::stream::ConsistentOutputStream* stream) override;
+
+};
+
+}}}
+
+#endif // oatpp_mysql_stream_NdjsonRowSink_hpp
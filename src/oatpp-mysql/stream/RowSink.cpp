@@ -0,0 +1,88 @@
+#include "RowSink.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace oatpp { namespace mysql { namespace stream {
+
+bool RowSink::isNull(const MYSQL_BIND& bind) {
+  return *bind.is_null == 1;
+}
+
+bool RowSink::isNumber(const MYSQL_BIND& bind) {
+  return isInteger(bind) || bind.buffer_type == MYSQL_TYPE_FLOAT || bind.buffer_type == MYSQL_TYPE_DOUBLE;
+}
+
+bool RowSink::isInteger(const MYSQL_BIND& bind) {
+  switch(bind.buffer_type) {
+    case MYSQL_TYPE_TINY:
+    case MYSQL_TYPE_SHORT:
+    case MYSQL_TYPE_LONG:
+    case MYSQL_TYPE_LONGLONG:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool RowSink::isTemporal(const MYSQL_BIND& bind) {
+  return mapping::TimeCodec::isTemporal(bind.buffer_type);
+}
+
+v_int64 RowSink::readInteger(const MYSQL_BIND& bind) {
+  switch(bind.buffer_type) {
+    case MYSQL_TYPE_TINY:
+      return bind.is_unsigned ? (v_int64) *static_cast<v_uint8*>(bind.buffer) : *static_cast<v_int8*>(bind.buffer);
+    case MYSQL_TYPE_SHORT:
+      return bind.is_unsigned ? (v_int64) *static_cast<v_uint16*>(bind.buffer) : *static_cast<v_int16*>(bind.buffer);
+    case MYSQL_TYPE_LONG:
+      return bind.is_unsigned ? (v_int64) *static_cast<v_uint32*>(bind.buffer) : *static_cast<v_int32*>(bind.buffer);
+    default:
+      return *static_cast<v_int64*>(bind.buffer);
+  }
+}
+
+void RowSink::writeNumber(data::stream::ConsistentOutputStream* stream, const MYSQL_BIND& bind) {
+
+  char buffer[32];
+  int size;
+
+  if(isInteger(bind)) {
+    auto value = readInteger(bind);
+    if(bind.buffer_type == MYSQL_TYPE_LONGLONG && bind.is_unsigned) {
+      size = std::snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long) (v_uint64) value);
+    } else {
+      size = std::snprintf(buffer, sizeof(buffer), "%lld", (long long) value);
+    }
+  } else {
+    v_float64 value;
+    int precision;
+    if(bind.buffer_type == MYSQL_TYPE_FLOAT) {
+      value = *static_cast<v_float32*>(bind.buffer);
+      precision = 9;
+    } else {
+      value = *static_cast<v_float64*>(bind.buffer);
+      precision = 17;
+    }
+    if(!std::isfinite(value)) {
+      stream->writeSimple("null", 4);
+      return;
+    }
+    size = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+  }
+
+  stream->writeSimple(buffer, size);
+
+}
+
+const char* RowSink::getText(const MYSQL_BIND& bind, char* buffer, v_buff_size& size) {
+  if(isTemporal(bind)) {
+    size = mapping::TimeCodec::format(*static_cast<const MYSQL_TIME*>(bind.buffer), buffer);
+    return buffer;
+  }
+  size = (v_buff_size) std::min(*bind.length, bind.buffer_length - 1);
+  return static_cast<const char*>(bind.buffer);
+}
+
+}}}
@@ -0,0 +1,102 @@
+#ifndef oatpp_mysql_stream_RowSink_hpp
+#define oatpp_mysql_stream_RowSink_hpp
+
+#include "oatpp-mysql/mapping/ResultMapper.hpp"
+#include "oatpp-mysql/mapping/TimeCodec.hpp"
+
+#include "oatpp/data/stream/Stream.hpp"
+
+namespace oatpp { namespace mysql { namespace stream {
+
+/**
+ * Sink formatting result rows straight from the bind buffers into the output stream. <br>
+ * No oatpp objects are created for rows or values.
+ */
+class RowSink {
+public:
+  typedef mapping::ResultMapper::ResultData ResultData;
+protected:
+
+  /**
+   * Check if value of the bind is null.
+   * @param bind
+   * @return
+   */
+  static bool isNull(const MYSQL_BIND& bind);
+
+  /**
+   * Check if bind holds a binary number (integer or floating point).
+   * @param bind
+   * @return
+   */
+  static bool isNumber(const MYSQL_BIND& bind);
+
+  /**
+   * Check if bind holds an integer.
+   * @param bind
+   * @return
+   */
+  static bool isInteger(const MYSQL_BIND& bind);
+
+  /**
+   * Check if bind holds `MYSQL_TIME` - `DATE`, `DATETIME`, `TIMESTAMP` or `TIME` value.
+   * @param bind
+   * @return
+   */
+  static bool isTemporal(const MYSQL_BIND& bind);
+
+  /**
+   * Read integer value of the bind. Unsigned `BIGINT` values above `INT64_MAX` wrap.
+   * @param bind
+   * @return
+   */
+  static v_int64 readInteger(const MYSQL_BIND& bind);
+
+  /**
+   * Write text of the binary number. NaN and infinity are written as `null`.
+   * @param stream
+   * @param bind
+   */
+  static void writeNumber(data::stream::ConsistentOutputStream* stream, const MYSQL_BIND& bind);
+
+  /**
+   * Get text value of the non-number bind.
+   * @param bind
+   * @param buffer - buffer of &id:oatpp::mysql::mapping::TimeCodec::MAX_TEXT_SIZE; bytes to format date and time values.
+   * @param size - out. Size of the value.
+   * @return - pointer to the value in the bind buffer or in the `buffer`.
+   */
+  static const char* getText(const MYSQL_BIND& bind, char* buffer, v_buff_size& size);
+
+public:
+
+  /**
+   * Virtual destructor.
+   */
+  virtual ~RowSink() = default;
+
+  /**
+   * Write beginning of the output. Called once, before the first row.
+   * @param stream - stream to write to.
+   * @param dbData - result. Column metadata is available.
+   */
+  virtual void writeBegin(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) = 0;
+
+  /**
+   * Write the current row of the result.
+   * @param stream - stream to write to.
+   * @param dbData - result positioned at the row.
+   */
+  virtual void writeRow(data::stream::ConsistentOutputStream* stream, const ResultData* dbData) = 0;
+
+  /**
+   * Write end of the output. Called once, after the last row.
+   * @param stream - stream to write to.
+   */
+  virtual void writeEnd(data::stream::ConsistentOutputStream* stream) = 0;
+
+};
+
+}}}
+
+#endif // oatpp_mysql_stream_RowSink_hpp
@@ -0,0 +1,122 @@
+#include "RowStreamer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace oatpp { namespace mysql { namespace stream {
+
+constexpr v_buff_size RowStreamer::DEFAULT_FLUSH_SIZE;
+
+v_int64 RowStreamer::writeRows(ResultData* dbData, RowSink* sink, data::stream::ConsistentOutputStream* stream, v_int64 count) {
+  v_int64 counter = 0;
+  while(dbData->hasMore && (count < 0 || counter < count)) {
+    sink->writeRow(stream, dbData);
+    ++ dbData->rowIndex;
+    ++ counter;
+    dbData->next();
+  }
+  return counter;
+}
+
+v_int64 RowStreamer::stream(ResultData* dbData,
+                            RowSink* sink,
+                            data::stream::OutputStream* stream,
+                            v_buff_size flushSize)
+{
+
+  data::stream::BufferOutputStream buffer(flushSize + 1024);
+
+  auto flush = [&]() {
+    if(buffer.getCurrentPosition() > 0) {
+      auto res = stream->writeExactSizeDataSimple(buffer.getData(), buffer.getCurrentPosition());
+      if(res != buffer.getCurrentPosition()) {
+        throw std::runtime_error("[oatpp::mysql::stream::RowStreamer::stream()]: Error. Failed to write to the output stream.");
+      }
+      buffer.setCurrentPosition(0);
+    }
+  };
+
+  v_int64 counter = 0;
+
+  sink->writeBegin(&buffer, dbData);
+
+  while(dbData->hasMore) {
+    counter += writeRows(dbData, sink, &buffer, 1);
+    if(buffer.getCurrentPosition() >= flushSize) {
+      flush();
+    }
+  }
+
+  sink->writeEnd(&buffer);
+  flush();
+
+  return counter;
+
+}
+
+RowReadCallback::RowReadCallback(const std::shared_ptr<QueryResult>& result,
+                                 const std::shared_ptr<RowSink>& sink,
+                                 v_int64 rowsPerRead)
+  : m_result(result)
+  , m_sink(sink)
+  , m_rowsPerRead(rowsPerRead > 0 ? rowsPerRead : 1)
+  , m_readPosition(0)
+  , m_stage(Stage::BEGIN)
+{}
+
+void RowReadCallback::produce() {
+
+  auto dbData = m_result->getResultData();
+
+  switch(m_stage) {
+
+    case Stage::BEGIN:
+      if(!m_result->isSuccess()) {
+        throw std::runtime_error("[oatpp::mysql::stream::RowReadCallback::produce()]: Error. " + *m_result->getErrorMessage());
+      }
+      m_sink->writeBegin(&m_buffer, dbData);
+      m_stage = Stage::ROWS;
+      break;
+
+    case Stage::ROWS:
+      RowStreamer::writeRows(dbData, m_sink.get(), &m_buffer, m_rowsPerRead);
+      if(!dbData->hasMore) {
+        m_stage = Stage::END;
+      }
+      break;
+
+    case Stage::END:
+      m_sink->writeEnd(&m_buffer);
+      m_stage = Stage::DONE;
+      break;
+
+    default:
+      break;
+
+  }
+
+}
+
+v_io_size RowReadCallback::read(void* buffer, v_buff_size count, async::Action& action) {
+
+  (void) action;
+
+  while(m_buffer.getCurrentPosition() - m_readPosition < count && m_stage != Stage::DONE) {
+    produce();
+  }
+
+  v_buff_size size = std::min(m_buffer.getCurrentPosition() - m_readPosition, count);
+  std::memcpy(buffer, m_buffer.getData() + m_readPosition, size);
+  m_readPosition += size;
+
+  // everything formatted so far is sent - reuse the buffer from the start
+  if(m_readPosition == m_buffer.getCurrentPosition()) {
+    m_buffer.setCurrentPosition(0);
+    m_readPosition = 0;
+  }
+
+  return size;
+
+}
+
+}}}
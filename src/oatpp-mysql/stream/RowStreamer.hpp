@@ -0,0 +1,104 @@
+#ifndef oatpp_mysql_stream_RowStreamer_hpp
+#define oatpp_mysql_stream_RowStreamer_hpp
+
+#include "RowSink.hpp"
+
+#include "oatpp-mysql/QueryResult.hpp"
+
+#include "oatpp/data/stream/BufferStream.hpp"
+
+namespace oatpp { namespace mysql { namespace stream {
+
+/**
+ * Drive &l:RowSink; over the rows of the result. <br>
+ * Rows are formatted one at a time into a small buffer which is flushed to the output as it fills up,
+ * so memory used doesn't depend on the number of rows.
+ */
+class RowStreamer {
+public:
+  typedef mapping::ResultMapper::ResultData ResultData;
+public:
+
+  /**
+   * Default size of the buffer flushed to the output stream.
+   */
+  static constexpr v_buff_size DEFAULT_FLUSH_SIZE = 64 * 1024;
+
+public:
+
+  /**
+   * Write up to `count` rows of the result with the sink. Doesn't call &l:RowSink::writeBegin (); and &l:RowSink::writeEnd ();.
+   * @param dbData - result positioned at the first row to write.
+   * @param sink - &l:RowSink;.
+   * @param stream - stream to write to.
+   * @param count - max number of rows to write. `-1` - write all remaining rows.
+   * @return - number of rows written.
+   */
+  static v_int64 writeRows(ResultData* dbData, RowSink* sink, data::stream::ConsistentOutputStream* stream, v_int64 count);
+
+  /**
+   * Write all remaining rows of the result including beginning and end of the output.
+   * @param dbData - result positioned at the first row to write.
+   * @param sink - &l:RowSink;.
+   * @param stream - output stream.
+   * @param flushSize - buffered data is written to the `stream` when its size reaches `flushSize`.
+   * @return - number of rows written.
+   */
+  static v_int64 stream(ResultData* dbData,
+                        RowSink* sink,
+                        data::stream::OutputStream* stream,
+                        v_buff_size flushSize = DEFAULT_FLUSH_SIZE);
+
+};
+
+/**
+ * &id:oatpp::data::stream::ReadCallback; producing the formatted result on demand. <br>
+ * Use it as a chunked HTTP body - the first bytes go to the client while the rest of the rows are still being read.
+ * Rows are read from the result in the `read` call - the result must have the rows on the client (stored result or
+ * the connection dedicated to this result) and the call blocks while the client library reads from the network.
+ * ```cpp
+ * auto result = db->getAllUsers();
+ * auto callback = std::make_shared<RowReadCallback>(std::static_pointer_cast<oatpp::mysql::QueryResult>(result.getPtr()),
+ *                                                   std::make_shared<JsonRowSink>(UserDto::Class::getType()));
+ * auto body = std::make_shared<oatpp::web::protocol::http::outgoing::StreamingBody>(callback);
+ * return OutgoingResponse::createShared(Status::CODE_200, body);
+ * ```
+ */
+class RowReadCallback : public data::stream::ReadCallback {
+private:
+
+  enum class Stage : v_int32 {
+    BEGIN,
+    ROWS,
+    END,
+    DONE
+  };
+
+private:
+  std::shared_ptr<QueryResult> m_result;
+  std::shared_ptr<RowSink> m_sink;
+  v_int64 m_rowsPerRead;
+  data::stream::BufferOutputStream m_buffer;
+  v_buff_size m_readPosition;
+  Stage m_stage;
+private:
+  void produce();
+public:
+
+  /**
+   * Constructor.
+   * @param result - &id:oatpp::mysql::QueryResult;.
+   * @param sink - &l:RowSink;.
+   * @param rowsPerRead - max number of rows formatted per buffer refill.
+   */
+  RowReadCallback(const std::shared_ptr<QueryResult>& result,
+                  const std::shared_ptr<RowSink>& sink,
+                  v_int64 rowsPerRead = 256);
+
+  v_io_size read(void* buffer, v_buff_size count, async::Action& action) override;
+
+};
+
+}}}
+
+#endif // oatpp_mysql_stream_RowStreamer_hpp
@@ -0,0 +1,178 @@
+#include "CompressionBenchmark.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+#include <chrono>
+#include <ctime>
+
+namespace oatpp { namespace test { namespace mysql { namespace benchmark {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class WideRow : public oatpp::DTO {
+
+  DTO_INIT(WideRow, DTO);
+
+  DTO_FIELD(Int64, id);
+  DTO_FIELD(String, f_text0);
+  DTO_FIELD(String, f_text1);
+  DTO_FIELD(String, f_text2);
+  DTO_FIELD(String, f_text3);
+  DTO_FIELD(String, f_text4);
+  DTO_FIELD(String, f_text5);
+  DTO_FIELD(String, f_text6);
+  DTO_FIELD(String, f_text7);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+#include OATPP_CODEGEN_BEGIN(DbClient)
+
+class BenchmarkClient : public oatpp::orm::DbClient {
+public:
+
+  BenchmarkClient(const std::shared_ptr<oatpp::orm::Executor>& executor)
+    : oatpp::orm::DbClient(executor)
+  {}
+
+  QUERY(createTable,
+        "CREATE TABLE IF NOT EXISTS bench_wide ("
+        "id BIGINT PRIMARY KEY, "
+        "f_text0 VARCHAR(255), f_text1 VARCHAR(255), f_text2 VARCHAR(255), f_text3 VARCHAR(255), "
+        "f_text4 VARCHAR(255), f_text5 VARCHAR(255), f_text6 VARCHAR(255), f_text7 VARCHAR(255));")
+
+  QUERY(deleteAll,
+        "DELETE FROM bench_wide;")
+
+  QUERY(insertRow,
+        "INSERT INTO bench_wide "
+        "(id, f_text0, f_text1, f_text2, f_text3, f_text4, f_text5, f_text6, f_text7) "
+        "VALUES "
+        "(:row.id, :row.f_text0, :row.f_text1, :row.f_text2, :row.f_text3, "
+        ":row.f_text4, :row.f_text5, :row.f_text6, :row.f_text7);",
+        PARAM(oatpp::Object<WideRow>, row))
+
+  QUERY(selectAll,
+        "SELECT * FROM bench_wide;")
+
+  QUERY(selectAllCompressed,
+        "/*oatpp: compress*/ SELECT * FROM bench_wide;")
+
+};
+
+#include OATPP_CODEGEN_END(DbClient)
+
+constexpr v_int32 ROWS_COUNT = 10000;
+constexpr v_int32 ITERATIONS = 10;
+
+oatpp::mysql::ConnectionOptions getOptions() {
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+  return options;
+}
+
+oatpp::String generateText(v_int32 seed) {
+  // repetitive text - typical for the real-world varchar columns and friendly to compression
+  std::string text;
+  while(text.size() < 200) {
+    text += "user-" + std::to_string(seed % 97) + "@example.com;status=active;";
+  }
+  return text;
+}
+
+}
+
+void CompressionBenchmark::onRun() {
+
+  auto plainProvider = std::make_shared<oatpp::mysql::ConnectionProvider>(getOptions());
+
+  {
+    auto executor = std::make_shared<oatpp::mysql::Executor>(plainProvider);
+    BenchmarkClient client(executor);
+
+    OATPP_ASSERT(client.createTable()->isSuccess());
+    OATPP_ASSERT(client.deleteAll()->isSuccess());
+
+    auto connection = client.getConnection();
+    for(v_int32 i = 0; i < ROWS_COUNT; i ++) {
+      auto row = WideRow::createShared();
+      row->id = i;
+      row->f_text0 = generateText(i);
+      row->f_text1 = generateText(i + 1);
+      row->f_text2 = generateText(i + 2);
+      row->f_text3 = generateText(i + 3);
+      row->f_text4 = generateText(i + 4);
+      row->f_text5 = generateText(i + 5);
+      row->f_text6 = generateText(i + 6);
+      row->f_text7 = generateText(i + 7);
+      client.insertRow(row, connection);
+    }
+
+    OATPP_LOGd(TAG, "Inserted {} rows", ROWS_COUNT);
+  }
+
+  struct Config {
+    const char* name;
+    oatpp::mysql::Compression compression;
+    v_uint32 level;
+  };
+
+  Config configs[] = {
+    {"none", oatpp::mysql::Compression::NONE, 0},
+    {"zlib", oatpp::mysql::Compression::ZLIB, 0},
+    {"zstd-1", oatpp::mysql::Compression::ZSTD, 1},
+    {"zstd-3", oatpp::mysql::Compression::ZSTD, 3},
+    {"zstd-9", oatpp::mysql::Compression::ZSTD, 9}
+  };
+
+  for(auto& config : configs) {
+
+    auto options = getOptions();
+    options.compression = config.compression;
+    options.compressionLevel = config.level;
+
+    // uncompressed queries keep using the plain provider, only hinted queries go to the compressed one
+    auto executor = std::make_shared<oatpp::mysql::Executor>(plainProvider);
+    executor->setCompressedConnectionProvider(std::make_shared<oatpp::mysql::ConnectionProvider>(options));
+    BenchmarkClient client(executor);
+
+    v_int64 rowsFetched = 0;
+
+    auto wallStart = std::chrono::steady_clock::now();
+    std::clock_t cpuStart = std::clock();
+
+    for(v_int32 i = 0; i < ITERATIONS; i ++) {
+      auto res = client.selectAllCompressed();
+      OATPP_ASSERT(res->isSuccess());
+      auto rows = res->fetch<oatpp::Vector<oatpp::Object<WideRow>>>();
+      rowsFetched += rows->size();
+    }
+
+    std::clock_t cpuEnd = std::clock();
+    auto wallEnd = std::chrono::steady_clock::now();
+
+    v_int64 wallMs = std::chrono::duration_cast<std::chrono::milliseconds>(wallEnd - wallStart).count();
+    v_int64 cpuMs = (v_int64) ((cpuEnd - cpuStart) * 1000 / CLOCKS_PER_SEC);
+
+    OATPP_LOGd(TAG, "{}: rows={}, wall={}ms, cpu={}ms, rows/sec={}",
+               config.name, rowsFetched, wallMs, cpuMs,
+               wallMs > 0 ? rowsFetched * 1000 / wallMs : rowsFetched);
+
+  }
+
+  {
+    auto executor = std::make_shared<oatpp::mysql::Executor>(plainProvider);
+    BenchmarkClient client(executor);
+    OATPP_ASSERT(client.deleteAll()->isSuccess());
+  }
+
+}
+
+}}}}
@@ -0,0 +1,19 @@
+#ifndef oatpp_test_mysql_benchmark_CompressionBenchmark_hpp
+#define oatpp_test_mysql_benchmark_CompressionBenchmark_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace benchmark {
+
+/**
+ * Fetch throughput and client CPU cost of the wide result set with no compression, zlib and zstd.
+ */
+class CompressionBenchmark : public UnitTest {
+public:
+  CompressionBenchmark() : UnitTest("BENCHMARK[mysql::benchmark::CompressionBenchmark]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_benchmark_CompressionBenchmark_hpp
@@ -0,0 +1,184 @@
+#include "ExportBenchmark.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+#include "oatpp/json/ObjectMapper.hpp"
+
+#include <chrono>
+
+namespace oatpp { namespace test { namespace mysql { namespace benchmark {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class ExportRow : public oatpp::DTO {
+
+  DTO_INIT(ExportRow, DTO);
+
+  DTO_FIELD(Int64, id);
+  DTO_FIELD(Int32, qty);
+  DTO_FIELD(Float64, price);
+  DTO_FIELD(String, name);
+  DTO_FIELD(String, note);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+#include OATPP_CODEGEN_BEGIN(DbClient)
+
+class BenchmarkClient : public oatpp::orm::DbClient {
+public:
+
+  BenchmarkClient(const std::shared_ptr<oatpp::orm::Executor>& executor)
+    : oatpp::orm::DbClient(executor)
+  {}
+
+  QUERY(createTable,
+        "CREATE TABLE IF NOT EXISTS bench_export ("
+        "id BIGINT PRIMARY KEY, qty INT, price DOUBLE, name VARCHAR(64), note VARCHAR(255));")
+
+  QUERY(deleteAll,
+        "DELETE FROM bench_export;")
+
+  QUERY(insertRow,
+        "INSERT INTO bench_export (id, qty, price, name, note) "
+        "VALUES (:row.id, :row.qty, :row.price, :row.name, :row.note);",
+        PARAM(oatpp::Object<ExportRow>, row))
+
+  QUERY(selectAll,
+        "SELECT id, qty, price, name, note FROM bench_export;")
+
+};
+
+#include OATPP_CODEGEN_END(DbClient)
+
+constexpr v_int32 ROWS_COUNT = 20000;
+constexpr v_int32 ITERATIONS = 10;
+
+oatpp::mysql::ConnectionOptions getOptions() {
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+  return options;
+}
+
+/*
+ * Output stream counting bytes - keeps the benchmark about formatting, not about the sink.
+ */
+class CountingOutputStream : public oatpp::data::stream::OutputStream {
+private:
+  v_int64 m_size;
+public:
+
+  CountingOutputStream()
+    : m_size(0)
+  {}
+
+  v_io_size write(const void* data, v_buff_size count, oatpp::async::Action& action) override {
+    (void) data;
+    (void) action;
+    m_size += count;
+    return count;
+  }
+
+  void setOutputStreamIOMode(oatpp::data::stream::IOMode ioMode) override {
+    (void) ioMode;
+  }
+
+  oatpp::data::stream::IOMode getOutputStreamIOMode() override {
+    return oatpp::data::stream::IOMode::BLOCKING;
+  }
+
+  oatpp::data::stream::Context& getOutputStreamContext() override {
+    static oatpp::data::stream::DefaultInitializedContext context(oatpp::data::stream::StreamType::STREAM_INFINITE);
+    return context;
+  }
+
+  v_int64 getSize() const {
+    return m_size;
+  }
+
+};
+
+}
+
+void ExportBenchmark::onRun() {
+
+  auto executor = std::make_shared<oatpp::mysql::Executor>(std::make_shared<oatpp::mysql::ConnectionProvider>(getOptions()));
+  BenchmarkClient client(executor);
+
+  OATPP_ASSERT(client.createTable()->isSuccess());
+  OATPP_ASSERT(client.deleteAll()->isSuccess());
+
+  {
+    auto connection = client.getConnection();
+    for(v_int32 i = 0; i < ROWS_COUNT; i ++) {
+      auto row = ExportRow::createShared();
+      row->id = i;
+      row->qty = i % 1000;
+      row->price = i * 0.25;
+      row->name = "item-" + std::to_string(i);
+      row->note = (i % 10 == 0) ? oatpp::String("multi-line \"quoted\",\nnote") : oatpp::String("plain note " + std::to_string(i));
+      client.insertRow(row, connection);
+    }
+    OATPP_LOGd(TAG, "Inserted {} rows", ROWS_COUNT);
+  }
+
+  struct Run {
+    const char* name;
+    std::shared_ptr<oatpp::mysql::stream::RowSink> sink;
+  };
+
+  Run runs[] = {
+    {"dto+json", nullptr},
+    {"json", std::make_shared<oatpp::mysql::stream::JsonRowSink>(ExportRow::Class::getType())},
+    {"ndjson", std::make_shared<oatpp::mysql::stream::NdjsonRowSink>()},
+    {"csv", std::make_shared<oatpp::mysql::stream::CsvRowSink>()}
+  };
+
+  oatpp::json::ObjectMapper objectMapper;
+
+  for(auto& run : runs) {
+
+    v_int64 rowsExported = 0;
+    v_int64 bytesExported = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for(v_int32 i = 0; i < ITERATIONS; i ++) {
+
+      auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectAll());
+      OATPP_ASSERT(res->isSuccess());
+
+      if(run.sink) {
+        CountingOutputStream stream;
+        rowsExported += oatpp::mysql::stream::RowStreamer::stream(res->getResultData(), run.sink.get(), &stream);
+        bytesExported += stream.getSize();
+      } else {
+        auto rows = res->fetch<oatpp::Vector<oatpp::Object<ExportRow>>>();
+        auto json = objectMapper.writeToString(rows);
+        rowsExported += rows->size();
+        bytesExported += json->size();
+      }
+
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    v_int64 micros = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    OATPP_LOGd(TAG, "{}: rows={}, bytes={}, time={}ms, rows/sec={}",
+               run.name, rowsExported, bytesExported, micros / 1000,
+               micros > 0 ? rowsExported * 1000000 / micros : rowsExported);
+
+  }
+
+  OATPP_ASSERT(client.deleteAll()->isSuccess());
+
+}
+
+}}}}
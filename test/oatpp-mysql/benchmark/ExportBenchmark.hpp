@@ -0,0 +1,19 @@
+#ifndef oatpp_test_mysql_benchmark_ExportBenchmark_hpp
+#define oatpp_test_mysql_benchmark_ExportBenchmark_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace benchmark {
+
+/**
+ * Export throughput in rows per second - JSON, NDJSON and CSV row sinks vs fetching DTOs and serializing them to JSON.
+ */
+class ExportBenchmark : public UnitTest {
+public:
+  ExportBenchmark() : UnitTest("BENCHMARK[mysql::benchmark::ExportBenchmark]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_benchmark_ExportBenchmark_hpp
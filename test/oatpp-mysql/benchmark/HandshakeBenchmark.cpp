@@ -0,0 +1,54 @@
+#include "HandshakeBenchmark.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace benchmark {
+
+namespace {
+
+constexpr v_int32 CONNECTS_COUNT = 200;
+
+oatpp::mysql::ConnectionOptions getOptions() {
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+  options.sslMode = oatpp::mysql::SslMode::REQUIRED;
+  return options;
+}
+
+}
+
+void HandshakeBenchmark::onRun() {
+
+  for(v_int32 reuse = 0; reuse <= 1; reuse ++) {
+
+    auto options = getOptions();
+    options.sslSessionReuse = (reuse == 1);
+
+    oatpp::mysql::ConnectionProvider provider(options);
+
+    for(v_int32 i = 0; i < CONNECTS_COUNT; i ++) {
+      // connection is closed right away - every iteration is a new handshake
+      provider.get();
+    }
+
+    auto stats = provider.getHandshakeStats();
+    OATPP_ASSERT(stats.connectsCount == CONNECTS_COUNT);
+
+    v_int64 fullCount = stats.connectsCount - stats.reusedCount;
+    v_int64 fullMicros = stats.connectsMicros - stats.reusedMicros;
+
+    OATPP_LOGd(TAG, "sslSessionReuse={}: connects={}, avg={}us, full handshakes={} (avg={}us), resumed={} (avg={}us)",
+               options.sslSessionReuse, stats.connectsCount,
+               stats.connectsMicros / stats.connectsCount,
+               fullCount, fullCount > 0 ? fullMicros / fullCount : 0,
+               stats.reusedCount, stats.reusedCount > 0 ? stats.reusedMicros / stats.reusedCount : 0);
+
+  }
+
+}
+
+}}}}
@@ -0,0 +1,19 @@
+#ifndef oatpp_test_mysql_benchmark_HandshakeBenchmark_hpp
+#define oatpp_test_mysql_benchmark_HandshakeBenchmark_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace benchmark {
+
+/**
+ * Connect latency over TLS with and without TLS session reuse.
+ */
+class HandshakeBenchmark : public UnitTest {
+public:
+  HandshakeBenchmark() : UnitTest("BENCHMARK[mysql::benchmark::HandshakeBenchmark]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_benchmark_HandshakeBenchmark_hpp
@@ -0,0 +1,32 @@
+#include "benchmark/CompressionBenchmark.hpp"
+#include "benchmark/ExportBenchmark.hpp"
+#include "benchmark/HandshakeBenchmark.hpp"
+
+#include "oatpp/Environment.hpp"
+
+#include <iostream>
+
+namespace {
+
+void runBenchmarks() {
+  OATPP_RUN_TEST(oatpp::test::mysql::benchmark::CompressionBenchmark);
+  OATPP_RUN_TEST(oatpp::test::mysql::benchmark::ExportBenchmark);
+  OATPP_RUN_TEST(oatpp::test::mysql::benchmark::HandshakeBenchmark);
+}
+
+}
+
+int main() {
+
+  oatpp::Environment::init();
+
+  runBenchmarks();
+
+  std::cout << "\nEnvironment:\n";
+  std::cout << "objectsCount = " << oatpp::Environment::getObjectsCount() << "\n";
+  std::cout << "objectsCreated = " << oatpp::Environment::getObjectsCreated() << "\n\n";
+
+  oatpp::Environment::destroy();
+
+  return 0;
+}
@@ -0,0 +1,188 @@
+#include "ConnectionProviderTest.hpp"
+
+#include "oatpp-mysql/ConnectionProvider.hpp"
+#include "oatpp-mysql/NonBlockingEngine.hpp"
+#include "oatpp-mysql/Utils.hpp"
+
+#include "oatpp/Environment.hpp"
+
+#ifndef _WIN32
+  #include <netinet/in.h>
+  #include <netinet/tcp.h>
+  #include <sys/socket.h>
+#endif
+
+namespace oatpp { namespace test { namespace mysql { namespace connection {
+
+namespace {
+
+oatpp::mysql::ConnectionOptions createOptions() {
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+  return options;
+}
+
+// first column of the first row
+oatpp::String selectValue(MYSQL* handle, const std::string& query) {
+
+  OATPP_ASSERT(mysql_real_query(handle, query.data(), (unsigned long) query.size()) == 0);
+
+  MYSQL_RES* result = mysql_store_result(handle);
+  OATPP_ASSERT(result != nullptr);
+
+  oatpp::String value;
+  MYSQL_ROW row = mysql_fetch_row(result);
+  if(row != nullptr && row[0] != nullptr) {
+    value = oatpp::String(row[0], (v_buff_size) mysql_fetch_lengths(result)[0]);
+  }
+
+  mysql_free_result(result);
+  return value;
+
+}
+
+#ifndef _WIN32
+int getSocketOption(MYSQL* handle, int level, int name) {
+  int value = 0;
+  socklen_t size = sizeof(value);
+  OATPP_ASSERT(getsockopt(oatpp::mysql::Utils::getSocket(handle), level, name, &value, &size) == 0);
+  return value;
+}
+#endif
+
+}
+
+void ConnectionProviderTest::onRun() {
+
+  {
+    auto options = createOptions();
+    options.charset = "latin1";
+    options.connectTimeout = 5;
+    options.readTimeout = 30;
+    options.writeTimeout = 30;
+    options.tcpNoDelay = false;
+    options.tcpKeepAlive = true;
+    options.tcpKeepAliveIdle = 60;
+    options.trackGtids = true;
+
+    oatpp::mysql::ConnectionProvider provider(options);
+    auto connection = provider.get();
+    MYSQL* handle = connection.object->getHandle();
+
+    OATPP_ASSERT(!connection.object->isNonBlocking());
+
+    // negotiated during the handshake
+    OATPP_ASSERT(selectValue(handle, "SELECT @@character_set_client") == "latin1");
+    // applied with the init command
+    OATPP_ASSERT(selectValue(handle, "SELECT @@session.session_track_gtids") == "OWN_GTID");
+
+#ifndef _WIN32
+    OATPP_ASSERT(getSocketOption(handle, IPPROTO_TCP, TCP_NODELAY) == 0);
+    OATPP_ASSERT(getSocketOption(handle, SOL_SOCKET, SO_KEEPALIVE) != 0);
+#if defined(TCP_KEEPIDLE)
+    OATPP_ASSERT(getSocketOption(handle, IPPROTO_TCP, TCP_KEEPIDLE) == 60);
+#endif
+#endif
+
+  }
+
+  {
+    auto options = createOptions();
+    oatpp::mysql::ConnectionProvider provider(options);
+    auto connection = provider.get();
+    MYSQL* handle = connection.object->getHandle();
+
+    OATPP_ASSERT(selectValue(handle, "SELECT @@character_set_client") == "utf8mb4");
+
+#ifndef _WIN32
+    OATPP_ASSERT(getSocketOption(handle, IPPROTO_TCP, TCP_NODELAY) != 0);
+#endif
+
+  }
+
+  {
+    auto options = createOptions();
+    options.sslMode = oatpp::mysql::SslMode::DISABLED;
+    oatpp::mysql::ConnectionProvider provider(options);
+
+    provider.get();
+    provider.get();
+
+    auto stats = provider.getHandshakeStats();
+    OATPP_ASSERT(stats.connectsCount == 2);
+    OATPP_ASSERT(stats.connectsMicros > 0);
+    // nothing to resume without TLS
+    OATPP_ASSERT(stats.reusedCount == 0);
+    OATPP_ASSERT(stats.reusedMicros == 0);
+  }
+
+  {
+    auto options = createOptions();
+    options.sslMode = oatpp::mysql::SslMode::REQUIRED;
+    options.sslSessionReuse = true;
+    oatpp::mysql::ConnectionProvider provider(options);
+
+    {
+      auto connection = provider.get();
+      OATPP_ASSERT(mysql_get_ssl_cipher(connection.object->getHandle()) != nullptr);
+    }
+
+    provider.get();
+
+    auto stats = provider.getHandshakeStats();
+    OATPP_LOGd(TAG, "connects={}, micros={}, reused={}, reusedMicros={}",
+               stats.connectsCount, stats.connectsMicros, stats.reusedCount, stats.reusedMicros);
+    OATPP_ASSERT(stats.connectsCount == 2);
+    OATPP_ASSERT(stats.reusedMicros <= stats.connectsMicros);
+
+#if !defined(MARIADB_BASE_VERSION) && !defined(MARIADB_PACKAGE_VERSION_ID) && MYSQL_VERSION_ID >= 80029
+    // the second connect resumes the session of the first one
+    OATPP_ASSERT(stats.reusedCount == 1);
+#else
+    OATPP_ASSERT(stats.reusedCount == 0);
+#endif
+  }
+
+  {
+    // non-routable address - connect fails within the connect timeout
+    auto options = createOptions();
+    options.host = "10.255.255.1";
+    options.connectTimeout = 1;
+
+    oatpp::mysql::ConnectionProvider provider(options);
+
+    v_int64 startTime = oatpp::Environment::getMicroTickCount();
+    bool thrown = false;
+    try {
+      provider.get();
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    v_int64 elapsed = oatpp::Environment::getMicroTickCount() - startTime;
+
+    OATPP_LOGd(TAG, "failed connect took {}us", elapsed);
+    OATPP_ASSERT(thrown);
+    OATPP_ASSERT(elapsed < 10 * 1000 * 1000);
+  }
+
+  {
+    auto options = createOptions();
+    options.useNonBlockingEngine = true;
+    oatpp::mysql::ConnectionProvider provider(options);
+
+    bool thrown = false;
+    try {
+      provider.get();
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown == oatpp::mysql::NonBlockingEngine::isSupported());
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_connection_ConnectionProviderTest_hpp
+#define oatpp_test_mysql_connection_ConnectionProviderTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace connection {
+
+class ConnectionProviderTest : public UnitTest {
+public:
+  ConnectionProviderTest() : UnitTest("TEST[mysql::connection::ConnectionProviderTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_connection_ConnectionProviderTest_hpp
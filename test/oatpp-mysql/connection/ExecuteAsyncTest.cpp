@@ -0,0 +1,129 @@
+#include "ExecuteAsyncTest.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+#include "oatpp/async/Executor.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace connection {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class ValueRow : public oatpp::DTO {
+
+  DTO_INIT(ValueRow, DTO);
+
+  DTO_FIELD(Int64, value);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+typedef oatpp::Vector<oatpp::Object<ValueRow>> Rows;
+
+struct Outcome {
+  std::atomic<bool> done;
+  bool success;
+  Rows rows;
+};
+
+class QueryCoroutine : public oatpp::async::Coroutine<QueryCoroutine> {
+private:
+  std::shared_ptr<oatpp::mysql::Executor> m_executor;
+  oatpp::data::share::StringTemplate m_queryTemplate;
+  v_int64 m_value;
+  Outcome* m_outcome;
+  std::shared_ptr<oatpp::mysql::QueryResult> m_result;
+public:
+
+  QueryCoroutine(const std::shared_ptr<oatpp::mysql::Executor>& executor,
+                 const oatpp::data::share::StringTemplate& queryTemplate,
+                 v_int64 value,
+                 Outcome* outcome)
+    : m_executor(executor)
+    , m_queryTemplate(queryTemplate)
+    , m_value(value)
+    , m_outcome(outcome)
+  {}
+
+  Action act() override {
+    auto starter = m_executor->executeAsync(m_queryTemplate, {{"value", oatpp::Int64(m_value)}});
+    // the query must not depend on the executor once started
+    m_executor.reset();
+    return starter.callbackTo(&QueryCoroutine::onResult);
+  }
+
+  Action onResult(const std::shared_ptr<oatpp::orm::QueryResult>& result) {
+    m_outcome->success = result->isSuccess();
+    m_result = std::static_pointer_cast<oatpp::mysql::QueryResult>(result);
+    return m_result->fetchAsync<Rows>().callbackTo(&QueryCoroutine::onRows);
+  }
+
+  Action onRows(const Rows& rows) {
+    m_outcome->rows = rows;
+    // connection goes back to the pool with the result
+    m_result.reset();
+    m_outcome->done = true;
+    return finish();
+  }
+
+};
+
+}
+
+void ExecuteAsyncTest::onRun() {
+
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+
+  // fewer connections than queries - getAsync() of the pool waits for the released ones
+  auto connectionPool = oatpp::mysql::ConnectionPool::createShared(
+    std::make_shared<oatpp::mysql::ConnectionProvider>(options),
+    2,
+    std::chrono::seconds(5)
+  );
+
+  auto executor = std::make_shared<oatpp::mysql::Executor>(connectionPool);
+
+  auto selectValue = executor->parseQueryTemplate(
+    "selectValue",
+    "SELECT CAST(:value AS SIGNED) AS value;",
+    {{"value", oatpp::Int64::Class::getType()}},
+    true
+  );
+
+  oatpp::async::Executor asyncExecutor(1, 1, 1);
+
+  const v_int32 queriesCount = 8;
+  std::vector<Outcome> outcomes(queriesCount);
+  for(v_int32 i = 0; i < queriesCount; i ++) {
+    outcomes[i].done = false;
+    outcomes[i].success = false;
+    asyncExecutor.execute<QueryCoroutine>(executor, selectValue, i, &outcomes[i]);
+  }
+
+  // coroutines hold the last references - executor is destroyed while the queries are running
+  executor.reset();
+
+  asyncExecutor.waitTasksFinished();
+  asyncExecutor.stop();
+  asyncExecutor.join();
+
+  for(v_int32 i = 0; i < queriesCount; i ++) {
+    auto& outcome = outcomes[i];
+    OATPP_ASSERT(outcome.done);
+    OATPP_ASSERT(outcome.success);
+    OATPP_ASSERT(outcome.rows->size() == 1);
+    OATPP_ASSERT(outcome.rows[0]->value == i);
+  }
+
+  connectionPool->stop();
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_connection_ExecuteAsyncTest_hpp
+#define oatpp_test_mysql_connection_ExecuteAsyncTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace connection {
+
+class ExecuteAsyncTest : public UnitTest {
+public:
+  ExecuteAsyncTest() : UnitTest("TEST[mysql::connection::ExecuteAsyncTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_connection_ExecuteAsyncTest_hpp
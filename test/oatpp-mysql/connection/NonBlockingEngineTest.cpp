@@ -0,0 +1,148 @@
+#include "NonBlockingEngineTest.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+#include "oatpp-mysql/NonBlockingEngine.hpp"
+
+#include "oatpp/async/Executor.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace connection {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class ValueRow : public oatpp::DTO {
+
+  DTO_INIT(ValueRow, DTO);
+
+  DTO_FIELD(Int64, value);
+  DTO_FIELD(String, text);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+struct Outcome {
+  std::atomic<bool> done;
+  std::atomic<bool> nonBlocking;
+  bool success;
+  oatpp::Vector<oatpp::Object<ValueRow>> rows;
+};
+
+class QueryCoroutine : public oatpp::async::Coroutine<QueryCoroutine> {
+private:
+  std::shared_ptr<oatpp::mysql::Executor> m_executor;
+  oatpp::data::share::StringTemplate m_queryTemplate;
+  std::unordered_map<oatpp::String, oatpp::Void> m_params;
+  Outcome* m_outcome;
+public:
+
+  QueryCoroutine(const std::shared_ptr<oatpp::mysql::Executor>& executor,
+                 const oatpp::data::share::StringTemplate& queryTemplate,
+                 const std::unordered_map<oatpp::String, oatpp::Void>& params,
+                 Outcome* outcome)
+    : m_executor(executor)
+    , m_queryTemplate(queryTemplate)
+    , m_params(params)
+    , m_outcome(outcome)
+  {}
+
+  Action act() override {
+    return m_executor->executeAsync(m_queryTemplate, m_params).callbackTo(&QueryCoroutine::onResult);
+  }
+
+  Action onResult(const std::shared_ptr<oatpp::orm::QueryResult>& result) {
+    auto connection = std::static_pointer_cast<oatpp::mysql::Connection>(result->getConnection().object);
+    m_outcome->nonBlocking = connection->isNonBlocking();
+    m_outcome->success = result->isSuccess();
+    if(m_outcome->success) {
+      m_outcome->rows = result->fetch<oatpp::Vector<oatpp::Object<ValueRow>>>();
+    }
+    m_outcome->done = true;
+    return finish();
+  }
+
+  Action handleError(Error* error) override {
+    // blocking connections fail on prepare, before the statement is executed
+    m_outcome->success = false;
+    m_outcome->done = true;
+    return error;
+  }
+
+};
+
+}
+
+void NonBlockingEngineTest::onRun() {
+
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+
+  auto nonBlockingOptions = options;
+  nonBlockingOptions.useNonBlockingEngine = true;
+
+  auto executor = std::make_shared<oatpp::mysql::Executor>(std::make_shared<oatpp::mysql::ConnectionProvider>(options));
+  executor->setNonBlockingConnectionProvider(std::make_shared<oatpp::mysql::ConnectionProvider>(nonBlockingOptions));
+
+  auto selectValue = executor->parseQueryTemplate(
+    "selectValue",
+    "SELECT CAST(:value AS SIGNED) AS value, :text AS text;",
+    {{"value", oatpp::Int64::Class::getType()}, {"text", oatpp::String::Class::getType()}},
+    true
+  );
+
+  auto selectUnknown = executor->parseQueryTemplate(
+    "selectUnknown",
+    "SELECT value FROM test_no_such_table;",
+    {},
+    true
+  );
+
+  oatpp::async::Executor asyncExecutor(1, 1, 1);
+
+  // quotes and backslashes of the literal survive the client-side statement
+  const v_int32 queriesCount = 8;
+  std::vector<Outcome> outcomes(queriesCount);
+  for(v_int32 i = 0; i < queriesCount; i ++) {
+    outcomes[i].done = false;
+    outcomes[i].nonBlocking = false;
+    outcomes[i].success = false;
+    asyncExecutor.execute<QueryCoroutine>(executor, selectValue,
+      std::unordered_map<oatpp::String, oatpp::Void>({
+        {"value", oatpp::Int64(i)},
+        {"text", oatpp::String("it's \\" + std::to_string(i))}
+      }),
+      &outcomes[i]);
+  }
+
+  Outcome failed;
+  failed.done = false;
+  failed.nonBlocking = false;
+  failed.success = true;
+  asyncExecutor.execute<QueryCoroutine>(executor, selectUnknown, std::unordered_map<oatpp::String, oatpp::Void>(), &failed);
+
+  asyncExecutor.waitTasksFinished();
+  asyncExecutor.stop();
+  asyncExecutor.join();
+
+  for(v_int32 i = 0; i < queriesCount; i ++) {
+    auto& outcome = outcomes[i];
+    OATPP_ASSERT(outcome.done);
+    OATPP_ASSERT(outcome.nonBlocking == oatpp::mysql::NonBlockingEngine::isSupported());
+    OATPP_ASSERT(outcome.success);
+    OATPP_ASSERT(outcome.rows->size() == 1);
+    OATPP_ASSERT(outcome.rows[0]->value == i);
+    OATPP_ASSERT(*outcome.rows[0]->text == "it's \\" + std::to_string(i));
+  }
+
+  // query error is reported through the result or thrown in the coroutine
+  OATPP_ASSERT(failed.done);
+  OATPP_ASSERT(!failed.success);
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_connection_NonBlockingEngineTest_hpp
+#define oatpp_test_mysql_connection_NonBlockingEngineTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace connection {
+
+class NonBlockingEngineTest : public UnitTest {
+public:
+  NonBlockingEngineTest() : UnitTest("TEST[mysql::connection::NonBlockingEngineTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_connection_NonBlockingEngineTest_hpp
@@ -0,0 +1,159 @@
+#include "ColumnarResultTest.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+#include <string>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+typedef oatpp::mysql::mapping::ColumnarResult ColumnarResult;
+
+#include OATPP_CODEGEN_BEGIN(DbClient)
+
+class MyClient : public oatpp::orm::DbClient {
+public:
+
+  MyClient(const std::shared_ptr<oatpp::orm::Executor>& executor)
+    : oatpp::orm::DbClient(executor)
+  {}
+
+  QUERY(selectRows,
+        "WITH RECURSIVE seq (n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < :count) "
+        "SELECT n AS id, IF(n % 3 = 0, NULL, n - 10) AS f_int, IF(n % 4 = 0, NULL, n / 4e0) AS f_double, "
+        "IF(n % 5 = 0, NULL, REPEAT('s', n % 5 - 1)) AS f_string, "
+        "TIMESTAMP('2020-01-01 00:00:00') + INTERVAL n SECOND AS f_datetime "
+        "FROM seq ORDER BY n;",
+        PARAM(oatpp::Int64, count))
+
+  QUERY(selectOther,
+        "SELECT 1 AS id;")
+
+};
+
+#include OATPP_CODEGEN_END(DbClient)
+
+// 2020-01-01 00:00:00 UTC
+constexpr v_int64 BASE_EPOCH_MICROS = 1577836800LL * 1000 * 1000;
+
+void checkRows(const ColumnarResult& columns, v_int64 rowsCount) {
+
+  OATPP_ASSERT(columns.getRowsCount() == rowsCount);
+  OATPP_ASSERT(columns.getColumns().size() == 5);
+
+  auto& id = columns.getColumn("id");
+  auto& fInt = columns.getColumn("f_int");
+  auto& fDouble = columns.getColumn("f_double");
+  auto& fString = columns.getColumn("f_string");
+  auto& fDatetime = columns.getColumn(4);
+
+  OATPP_ASSERT(id.type == ColumnarResult::ColumnType::INT64);
+  OATPP_ASSERT(fInt.type == ColumnarResult::ColumnType::INT64);
+  OATPP_ASSERT(fDouble.type == ColumnarResult::ColumnType::DOUBLE);
+  OATPP_ASSERT(fString.type == ColumnarResult::ColumnType::STRING);
+  OATPP_ASSERT(fDatetime.type == ColumnarResult::ColumnType::INT64);
+
+  // one bit per row
+  OATPP_ASSERT((v_int64) fInt.nulls.size() == (rowsCount + 7) / 8);
+  OATPP_ASSERT((v_int64) fString.offsets.size() == rowsCount + 1);
+
+  for(v_int64 row = 0; row < rowsCount; row ++) {
+
+    v_int64 n = row + 1;
+
+    OATPP_ASSERT(!id.isNull(row));
+    OATPP_ASSERT(id.int64s[row] == n);
+
+    OATPP_ASSERT(fInt.isNull(row) == (n % 3 == 0));
+    OATPP_ASSERT(fInt.int64s[row] == (n % 3 == 0 ? 0 : n - 10));
+
+    OATPP_ASSERT(fDouble.isNull(row) == (n % 4 == 0));
+    OATPP_ASSERT(fDouble.doubles[row] == (n % 4 == 0 ? 0 : n / 4.0));
+
+    OATPP_ASSERT(fString.isNull(row) == (n % 5 == 0));
+    v_buff_size size = (n % 5 == 0) ? 0 : n % 5 - 1;
+    OATPP_ASSERT(fString.getStringSize(row) == size);
+    OATPP_ASSERT(std::string(fString.getStringData(row), size) == std::string(size, 's'));
+
+    OATPP_ASSERT(!fDatetime.isNull(row));
+    OATPP_ASSERT(fDatetime.int64s[row] == BASE_EPOCH_MICROS + n * 1000 * 1000);
+
+  }
+
+}
+
+}
+
+void ColumnarResultTest::onRun() {
+
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+
+  auto connectionProvider = std::make_shared<oatpp::mysql::ConnectionProvider>(options);
+  auto executor = std::make_shared<oatpp::mysql::Executor>(connectionProvider);
+
+  auto client = MyClient(executor);
+
+  ColumnarResult columns;
+
+  {
+    auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectRows(20));
+    OATPP_ASSERT(res->isSuccess());
+
+    // the second read starts in the middle of a null bitmap byte
+    OATPP_ASSERT(res->fetchColumns(columns, 5) == 5);
+    checkRows(columns, 5);
+    OATPP_ASSERT(res->fetchColumns(columns) == 15);
+    checkRows(columns, 20);
+    OATPP_ASSERT(!res->hasMoreToFetch());
+    OATPP_ASSERT(res->fetchColumns(columns) == 0);
+
+    // f_int is null in rows 2, 5, 8, 11, 14, 17
+    auto& nulls = columns.getColumn("f_int").nulls;
+    OATPP_ASSERT(nulls[0] == 0x24);
+    OATPP_ASSERT(nulls[1] == 0x49);
+    OATPP_ASSERT(nulls[2] == 0x02);
+  }
+
+  {
+    // buffers are reused for the next batch
+    columns.clear();
+    OATPP_ASSERT(columns.getRowsCount() == 0);
+    OATPP_ASSERT(columns.getColumn("f_int").nulls.empty());
+    OATPP_ASSERT(columns.getColumn("f_string").offsets.size() == 1);
+
+    auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectRows(9));
+    OATPP_ASSERT(res->isSuccess());
+    OATPP_ASSERT(res->fetchColumns(columns) == 9);
+    checkRows(columns, 9);
+  }
+
+  {
+    auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectOther());
+    OATPP_ASSERT(res->isSuccess());
+
+    bool thrown = false;
+    try {
+      res->fetchColumns(columns);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    thrown = false;
+    try {
+      columns.getColumn("unknown");
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_ColumnarResultTest_hpp
+#define oatpp_test_mysql_mapping_ColumnarResultTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class ColumnarResultTest : public UnitTest {
+public:
+  ColumnarResultTest() : UnitTest("TEST[mysql::mapping::ColumnarResultTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_ColumnarResultTest_hpp
@@ -0,0 +1,100 @@
+#include "DecimalCodecTest.hpp"
+
+#include "oatpp-mysql/mapping/DecimalCodec.hpp"
+#include "oatpp-mysql/mapping/Serializer.hpp"
+#include "oatpp-mysql/Types.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+typedef oatpp::mysql::mapping::DecimalCodec DecimalCodec;
+
+oatpp::String format(v_int64 unscaled, v_int32 scale) {
+  char buffer[DecimalCodec::MAX_TEXT_SIZE];
+  auto size = DecimalCodec::format(unscaled, scale, buffer);
+  return oatpp::String(buffer, size);
+}
+
+bool parse(const char* text, v_int64& unscaled, v_int32& scale) {
+  return DecimalCodec::parse(text, std::strlen(text), unscaled, scale);
+}
+
+v_float64 toFloat64(const char* text) {
+  return DecimalCodec::toFloat64(text, std::strlen(text));
+}
+
+}
+
+void DecimalCodecTest::onRun() {
+
+  v_int64 unscaled;
+  v_int32 scale;
+
+  {
+    OATPP_ASSERT(parse("-12.50", unscaled, scale));
+    OATPP_ASSERT(unscaled == -1250 && scale == 2);
+
+    OATPP_ASSERT(parse("0.05", unscaled, scale));
+    OATPP_ASSERT(unscaled == 5 && scale == 2);
+
+    OATPP_ASSERT(parse("42", unscaled, scale));
+    OATPP_ASSERT(unscaled == 42 && scale == 0);
+
+    OATPP_ASSERT(!parse("99999999999999999999", unscaled, scale));
+    OATPP_ASSERT(!parse("20000000000000000000", unscaled, scale)); // wraps uint64 at the last digit
+    OATPP_ASSERT(!parse("9223372036854775808", unscaled, scale));
+
+    OATPP_ASSERT(parse("9223372036854775807", unscaled, scale));
+    OATPP_ASSERT(unscaled == std::numeric_limits<v_int64>::max() && scale == 0);
+    OATPP_ASSERT(!parse("1.2.3", unscaled, scale));
+    OATPP_ASSERT(!parse("-", unscaled, scale));
+  }
+
+  {
+    OATPP_ASSERT(format(-1250, 2) == "-12.50");
+    OATPP_ASSERT(format(5, 2) == "0.05");
+    OATPP_ASSERT(format(42, 0) == "42");
+    OATPP_ASSERT(format(0, 3) == "0.000");
+  }
+
+  {
+    // max scale - whatever parse() accepts is formatted and bound back unchanged
+    const char* text = "-0.000000000000000000000000000001";
+    OATPP_ASSERT(parse(text, unscaled, scale));
+    OATPP_ASSERT(unscaled == -1 && scale == DecimalCodec::MAX_SCALE);
+    OATPP_ASSERT(format(unscaled, scale) == text);
+    OATPP_ASSERT(format(std::numeric_limits<v_int64>::min(), DecimalCodec::MAX_SCALE) ==
+                 "-0.000000000009223372036854775808");
+
+    oatpp::mysql::mapping::Serializer serializer;
+    oatpp::mysql::DecimalValue value = {unscaled, scale};
+    serializer.serialize(nullptr, 0, oatpp::mysql::Decimal(value));
+    auto& bind = serializer.getBindParams()[0];
+    OATPP_ASSERT(std::string((const char*) bind.buffer, bind.buffer_length) == text);
+
+    OATPP_ASSERT(!parse("0.0000000000000000000000000000001", unscaled, scale));
+  }
+
+  {
+    // fast path and strtod fallback give the same double
+    const char* values[] = {"3.14", "0.1", "-123456.789012", "12345678901234567890.123", "0.0000000000000000000000001"};
+    for(auto value : values) {
+      OATPP_ASSERT(toFloat64(value) == std::strtod(value, nullptr));
+    }
+    OATPP_ASSERT(DecimalCodec::toFloat64(-1250, 2) == -12.5);
+  }
+
+  {
+    OATPP_ASSERT(DecimalCodec::compare("-1.50", 5, "1.20", 4) < 0);
+    OATPP_ASSERT(DecimalCodec::compare("10.00", 5, "9.99", 4) > 0);
+    OATPP_ASSERT(DecimalCodec::compare("1.00", 4, "1.00", 4) == 0);
+  }
+
+}
+
+}}}}
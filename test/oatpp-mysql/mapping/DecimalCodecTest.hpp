@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_DecimalCodecTest_hpp
+#define oatpp_test_mysql_mapping_DecimalCodecTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class DecimalCodecTest : public UnitTest {
+public:
+  DecimalCodecTest() : UnitTest("TEST[mysql::mapping::DecimalCodecTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_DecimalCodecTest_hpp
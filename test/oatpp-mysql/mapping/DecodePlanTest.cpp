@@ -0,0 +1,212 @@
+#include "DecodePlanTest.hpp"
+
+#include "oatpp-mysql/mapping/DecodePlan.hpp"
+
+#include "oatpp/macro/codegen.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+typedef oatpp::mysql::mapping::DecodePlan DecodePlan;
+typedef oatpp::mysql::mapping::Deserializer Deserializer;
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class DogDetails : public oatpp::DTO {
+
+  DTO_INIT(DogDetails, DTO);
+
+  DTO_FIELD(String, breed);
+
+};
+
+class FishDetails : public oatpp::DTO {
+
+  DTO_INIT(FishDetails, DTO);
+
+  DTO_FIELD(Int32, fins);
+
+};
+
+class Pet : public oatpp::DTO {
+
+  DTO_INIT(Pet, DTO);
+
+  DTO_FIELD(Int64, id);
+  DTO_FIELD(String, name);
+  DTO_FIELD(Float64, weight);
+  DTO_FIELD(Any, extra);
+  DTO_FIELD(String, kind);
+
+  DTO_FIELD(Any, details);
+  DTO_FIELD_TYPE_SELECTOR(details) {
+    if(kind == "dog") return oatpp::Object<DogDetails>::Class::getType();
+    if(kind == "fish") return oatpp::Object<FishDetails>::Class::getType();
+    return oatpp::Any::Class::getType();
+  }
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+/*
+ * Binds of one row. Values are copied to the buffers owned by the row - deserializers clear the buffers after read.
+ */
+class Row {
+private:
+
+  struct Value {
+    std::vector<char> buffer;
+    bool isNull;
+    unsigned long length;
+  };
+
+private:
+  std::vector<std::shared_ptr<Value>> m_values;
+public:
+  std::vector<MYSQL_BIND> binds;
+private:
+
+  void add(enum_field_types type, const void* data, unsigned long size, bool isNull) {
+    auto value = std::make_shared<Value>();
+    value->buffer.resize(size + 1, 0);
+    if(data != nullptr) {
+      std::memcpy(value->buffer.data(), data, size);
+    }
+    value->isNull = isNull;
+    value->length = size;
+
+    MYSQL_BIND bind;
+    std::memset(&bind, 0, sizeof(bind));
+    bind.buffer_type = type;
+    bind.buffer = value->buffer.data();
+    bind.buffer_length = (unsigned long) value->buffer.size();
+    bind.is_null = &value->isNull;
+    bind.length = &value->length;
+
+    m_values.push_back(value);
+    binds.push_back(bind);
+  }
+
+public:
+
+  Row& int64(v_int64 value) {
+    add(MYSQL_TYPE_LONGLONG, &value, sizeof(value), false);
+    return *this;
+  }
+
+  Row& float64(v_float64 value) {
+    add(MYSQL_TYPE_DOUBLE, &value, sizeof(value), false);
+    return *this;
+  }
+
+  Row& string(const char* value) {
+    add(MYSQL_TYPE_STRING, value, value ? (unsigned long) std::strlen(value) : 0, value == nullptr);
+    return *this;
+  }
+
+  Row& null(enum_field_types type) {
+    add(type, nullptr, 8, true);
+    return *this;
+  }
+
+};
+
+}
+
+void DecodePlanTest::onRun() {
+
+  Deserializer deserializer;
+  auto typeResolver = std::make_shared<oatpp::data::mapping::TypeResolver>();
+  auto petType = oatpp::Object<Pet>::Class::getType();
+
+  {
+    // columns in any order, fields without columns stay null. The plan is reused for every row
+    DecodePlan plan(&deserializer, {"name", "weight", "id"}, typeResolver, petType);
+
+    Row first;
+    first.string("Rex").float64(31.5).int64(1);
+    auto pet = plan.decode(first.binds).cast<oatpp::Object<Pet>>();
+
+    OATPP_ASSERT(pet->id == 1);
+    OATPP_ASSERT(pet->name == "Rex");
+    OATPP_ASSERT(pet->weight == 31.5);
+    OATPP_ASSERT(pet->kind == nullptr);
+    OATPP_ASSERT(pet->details == nullptr);
+
+    Row second;
+    second.string(nullptr).null(MYSQL_TYPE_DOUBLE).int64(2);
+    auto other = plan.decode(second.binds).cast<oatpp::Object<Pet>>();
+
+    OATPP_ASSERT(other.get() != pet.get());
+    OATPP_ASSERT(other->id == 2);
+    OATPP_ASSERT(other->name == nullptr);
+    OATPP_ASSERT(other->weight == nullptr);
+
+    // the first object is not affected by the next rows
+    OATPP_ASSERT(pet->id == 1);
+    OATPP_ASSERT(pet->name == "Rex");
+  }
+
+  {
+    // Any without type selector holds the column type
+    DecodePlan plan(&deserializer, {"extra"}, typeResolver, petType);
+
+    Row row;
+    row.int64(42);
+    auto pet = plan.decode(row.binds).cast<oatpp::Object<Pet>>();
+
+    OATPP_ASSERT(pet->extra.getStoredType() == oatpp::Int64::Class::getType());
+    OATPP_ASSERT(pet->extra.retrieve<oatpp::Int64>() == 42);
+  }
+
+  {
+    // type of the polymorphic field is selected after the other fields are set - column order doesn't matter
+    DecodePlan plan(&deserializer, {"details", "id", "kind"}, typeResolver, petType);
+
+    Row dog;
+    dog.string("{\"breed\":\"beagle\"}").int64(1).string("dog");
+    auto dogPet = plan.decode(dog.binds).cast<oatpp::Object<Pet>>();
+
+    OATPP_ASSERT(dogPet->details.getStoredType() == oatpp::Object<DogDetails>::Class::getType());
+    OATPP_ASSERT(dogPet->details.retrieve<oatpp::Object<DogDetails>>()->breed == "beagle");
+
+    Row fish;
+    fish.string("{\"fins\":7}").int64(2).string("fish");
+    auto fishPet = plan.decode(fish.binds).cast<oatpp::Object<Pet>>();
+
+    OATPP_ASSERT(fishPet->details.getStoredType() == oatpp::Object<FishDetails>::Class::getType());
+    OATPP_ASSERT(fishPet->details.retrieve<oatpp::Object<FishDetails>>()->fins == 7);
+
+    Row empty;
+    empty.string(nullptr).int64(3).string("dog");
+    auto emptyPet = plan.decode(empty.binds).cast<oatpp::Object<Pet>>();
+
+    OATPP_ASSERT(emptyPet->details.getStoredType() == oatpp::Object<DogDetails>::Class::getType());
+    OATPP_ASSERT(emptyPet->details.retrieve<oatpp::Object<DogDetails>>() == nullptr);
+  }
+
+  {
+    bool thrown = false;
+    try {
+      DecodePlan plan(&deserializer, {"id", "unknown"}, typeResolver, petType);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    thrown = false;
+    try {
+      DecodePlan plan(&deserializer, {"id"}, typeResolver, oatpp::Vector<oatpp::Int64>::Class::getType());
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+}
+
+}}}}
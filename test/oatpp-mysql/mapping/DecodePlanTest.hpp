@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_DecodePlanTest_hpp
+#define oatpp_test_mysql_mapping_DecodePlanTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class DecodePlanTest : public UnitTest {
+public:
+  DecodePlanTest() : UnitTest("TEST[mysql::mapping::DecodePlanTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_DecodePlanTest_hpp
@@ -0,0 +1,78 @@
+#include "EnumCodecTest.hpp"
+
+#include "oatpp-mysql/mapping/EnumCodec.hpp"
+#include "oatpp/macro/codegen.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+typedef oatpp::mysql::mapping::EnumCodec EnumCodec;
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+ENUM(Status, v_int32,
+  VALUE(ACTIVE, 0, "active"),
+  VALUE(BLOCKED, 1, "blocked"),
+  VALUE(DELETED, 2, "deleted")
+)
+
+#include OATPP_CODEGEN_END(DTO)
+
+v_int32 find(const EnumCodec& codec, const char* name) {
+  return codec.find(name, std::strlen(name));
+}
+
+}
+
+void EnumCodecTest::onRun() {
+
+  {
+    std::vector<std::string> names;
+    for(v_int32 i = 0; i < 1000; i ++) {
+      names.push_back("value_" + std::to_string(i));
+    }
+    EnumCodec codec(names);
+    for(v_int32 i = 0; i < 1000; i ++) {
+      OATPP_ASSERT(codec.find(names[i].data(), names[i].size()) == i);
+    }
+    OATPP_ASSERT(find(codec, "value_1000") == -1);
+    OATPP_ASSERT(find(codec, "") == -1);
+  }
+
+  {
+    EnumCodec codec({"read", "write", "admin"});
+    v_uint64 mask;
+    std::string text;
+
+    OATPP_ASSERT(codec.parseSet("read,admin", 10, mask) && mask == 5);
+    OATPP_ASSERT(codec.parseSet("", 0, mask) && mask == 0);
+    OATPP_ASSERT(!codec.parseSet("read,,admin", 11, mask));
+    OATPP_ASSERT(!codec.parseSet("read,root", 9, mask));
+
+    OATPP_ASSERT(codec.formatSet(6, text) && text == "write,admin");
+    OATPP_ASSERT(codec.formatSet(0, text) && text.empty());
+    OATPP_ASSERT(!codec.formatSet(8, text));
+  }
+
+  {
+    auto codec = EnumCodec::get(oatpp::Enum<Status>::AsString::Class::getType());
+    OATPP_ASSERT(codec != nullptr);
+    OATPP_ASSERT(codec == EnumCodec::get(oatpp::Enum<Status>::AsString::Class::getType()));
+    OATPP_ASSERT(codec->getCount() == 3);
+
+    auto index = find(*codec, "blocked");
+    OATPP_ASSERT(index == 1);
+    OATPP_ASSERT(codec->getValue(index).cast<oatpp::Enum<Status>::AsString>() == Status::BLOCKED);
+    // built once - no interpreter call per cell
+    OATPP_ASSERT(&codec->getValue(index) == &codec->getValue(index));
+    OATPP_ASSERT(codec->getValue(0).cast<oatpp::Enum<Status>::AsString>() == Status::ACTIVE);
+
+    OATPP_ASSERT(EnumCodec::get(oatpp::Enum<Status>::AsNumber::Class::getType()) == nullptr);
+  }
+
+}
+
+}}}}
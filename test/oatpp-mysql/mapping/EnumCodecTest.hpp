@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_EnumCodecTest_hpp
+#define oatpp_test_mysql_mapping_EnumCodecTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class EnumCodecTest : public UnitTest {
+public:
+  EnumCodecTest() : UnitTest("TEST[mysql::mapping::EnumCodecTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_EnumCodecTest_hpp
@@ -0,0 +1,151 @@
+#include "FetchPipelineTest.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+#include <string>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+typedef oatpp::mysql::mapping::FetchPipeline FetchPipeline;
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Row : public oatpp::DTO {
+
+  DTO_INIT(Row, DTO);
+
+  DTO_FIELD(Int64, id);
+  DTO_FIELD(Int64, f_int);
+  DTO_FIELD(Float64, f_double);
+  DTO_FIELD(String, f_string);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+#include OATPP_CODEGEN_BEGIN(DbClient)
+
+class MyClient : public oatpp::orm::DbClient {
+public:
+
+  MyClient(const std::shared_ptr<oatpp::orm::Executor>& executor)
+    : oatpp::orm::DbClient(executor)
+  {}
+
+  QUERY(selectRows,
+        "WITH RECURSIVE seq (n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < :count) "
+        "SELECT n AS id, IF(n % 5 = 0, NULL, n * 10) AS f_int, n / 4e0 AS f_double, "
+        "IF(n % 7 = 0, NULL, CONCAT('row-', n)) AS f_string "
+        "FROM seq ORDER BY n;",
+        PARAM(oatpp::Int64, count))
+
+};
+
+#include OATPP_CODEGEN_END(DbClient)
+
+// rows [from, to] in the order of the query
+void checkRows(const oatpp::Vector<oatpp::Object<Row>>& rows, v_int64 from, v_int64 to) {
+
+  OATPP_ASSERT(rows->size() == (size_t) (to - from + 1));
+
+  for(v_int64 n = from; n <= to; n ++) {
+
+    auto& row = rows[n - from];
+    OATPP_ASSERT(row->id == n);
+
+    if(n % 5 == 0) {
+      OATPP_ASSERT(row->f_int == nullptr);
+    } else {
+      OATPP_ASSERT(row->f_int == n * 10);
+    }
+
+    OATPP_ASSERT(row->f_double == n / 4.0);
+
+    if(n % 7 == 0) {
+      OATPP_ASSERT(row->f_string == nullptr);
+    } else {
+      OATPP_ASSERT(*row->f_string == "row-" + std::to_string(n));
+    }
+
+  }
+
+}
+
+}
+
+void FetchPipelineTest::onRun() {
+
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+
+  // small queue - some batches don't fit it and are decoded by the calling thread
+  auto workerPool = std::make_shared<oatpp::mysql::WorkerPool>(2, 1);
+  auto connectionProvider = std::make_shared<oatpp::mysql::ConnectionProvider>(options, workerPool);
+  auto executor = std::make_shared<oatpp::mysql::Executor>(connectionProvider, workerPool);
+
+  auto client = MyClient(executor);
+
+  FetchPipeline::Config config;
+  config.batchSize = 3;
+  config.depth = 2;
+
+  {
+    // the ring is reused many times - batches are appended in the order rows were read
+    auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectRows(500));
+    OATPP_ASSERT(res->isSuccess());
+
+    auto rows = res->fetchPipelined<oatpp::Vector<oatpp::Object<Row>>>(-1, config);
+    checkRows(rows, 1, 500);
+    OATPP_ASSERT(!res->hasMoreToFetch());
+  }
+
+  {
+    // count is not a multiple of the batch size. The next fetch continues from the next row
+    auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectRows(100));
+    OATPP_ASSERT(res->isSuccess());
+
+    checkRows(res->fetchPipelined<oatpp::Vector<oatpp::Object<Row>>>(10, config), 1, 10);
+    checkRows(res->fetch<oatpp::Vector<oatpp::Object<Row>>>(5), 11, 15);
+    checkRows(res->fetchPipelined<oatpp::Vector<oatpp::Object<Row>>>(-1, config), 16, 100);
+    OATPP_ASSERT(!res->hasMoreToFetch());
+
+    OATPP_ASSERT(res->fetchPipelined<oatpp::Vector<oatpp::Object<Row>>>(-1, config)->size() == 0);
+  }
+
+  {
+    // default config - single batch
+    auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectRows(50));
+    OATPP_ASSERT(res->isSuccess());
+
+    auto rows = res->fetchPipelined<oatpp::List<oatpp::Object<Row>>>();
+    OATPP_ASSERT(rows->size() == 50);
+
+    v_int64 n = 1;
+    for(auto& row : *rows) {
+      OATPP_ASSERT(row->id == n);
+      n ++;
+    }
+  }
+
+  {
+    auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectRows(10));
+    OATPP_ASSERT(res->isSuccess());
+
+    bool thrown = false;
+    try {
+      res->fetchPipelined<oatpp::Fields<oatpp::Any>>(-1, config);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_FetchPipelineTest_hpp
+#define oatpp_test_mysql_mapping_FetchPipelineTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class FetchPipelineTest : public UnitTest {
+public:
+  FetchPipelineTest() : UnitTest("TEST[mysql::mapping::FetchPipelineTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_FetchPipelineTest_hpp
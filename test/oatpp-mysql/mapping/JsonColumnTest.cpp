@@ -0,0 +1,248 @@
+#include "JsonColumnTest.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+#include <string>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class Child : public oatpp::DTO {
+
+  DTO_INIT(Child, DTO);
+
+  DTO_FIELD(Int64, id);
+  DTO_FIELD(String, title);
+
+};
+
+class Attributes : public oatpp::DTO {
+
+  DTO_INIT(Attributes, DTO);
+
+  DTO_FIELD(String, color);
+  DTO_FIELD(Int32, size);
+  DTO_FIELD(Vector<String>, tags);
+  DTO_FIELD(String, note);
+
+};
+
+class Parent : public oatpp::DTO {
+
+  DTO_INIT(Parent, DTO);
+
+  DTO_FIELD(Int64, id);
+  DTO_FIELD(String, name);
+  DTO_FIELD(Object<Attributes>, attributes);
+  DTO_FIELD(Vector<Object<Child>>, children);
+
+};
+
+class Collections : public oatpp::DTO {
+
+  DTO_INIT(Collections, DTO);
+
+  DTO_FIELD(UnorderedFields<Int64>, counts);
+  DTO_FIELD(List<Int64>, numbers);
+  DTO_FIELD(Fields<String>, names);
+
+};
+
+class AttributesOnly : public oatpp::DTO {
+
+  DTO_INIT(AttributesOnly, DTO);
+
+  DTO_FIELD(Object<Attributes>, attributes);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+#include OATPP_CODEGEN_BEGIN(DbClient)
+
+class MyClient : public oatpp::orm::DbClient {
+public:
+
+  MyClient(const std::shared_ptr<oatpp::orm::Executor>& executor)
+    : oatpp::orm::DbClient(executor)
+  {}
+
+  QUERY(createParentTable,
+        "CREATE TABLE IF NOT EXISTS test_json_parent (id BIGINT PRIMARY KEY, name VARCHAR(32), attributes JSON);")
+
+  QUERY(createChildTable,
+        "CREATE TABLE IF NOT EXISTS test_json_child (id BIGINT PRIMARY KEY, parent_id BIGINT, title VARCHAR(32));")
+
+  QUERY(deleteParents,
+        "DELETE FROM test_json_parent;")
+
+  QUERY(deleteChildren,
+        "DELETE FROM test_json_child;")
+
+  QUERY(insertParent,
+        "INSERT INTO test_json_parent (id, name, attributes) VALUES (:id, :name, :attributes);",
+        PARAM(oatpp::Int64, id),
+        PARAM(oatpp::String, name),
+        PARAM(oatpp::String, attributes))
+
+  QUERY(insertChild,
+        "INSERT INTO test_json_child (id, parent_id, title) VALUES (:id, :parentId, :title);",
+        PARAM(oatpp::Int64, id),
+        PARAM(oatpp::Int64, parentId),
+        PARAM(oatpp::String, title))
+
+  // children are aggregated in the same query - one round trip for the whole tree
+  QUERY(selectParents,
+        "SELECT p.id, p.name, p.attributes, "
+        "(SELECT JSON_ARRAYAGG(JSON_OBJECT('id', c.id, 'title', c.title)) FROM test_json_child c WHERE c.parent_id = p.id) AS children "
+        "FROM test_json_parent p ORDER BY p.id;")
+
+  QUERY(selectCollections,
+        "SELECT JSON_OBJECT('a', 1, 'b', 2) AS counts, JSON_ARRAY(1, 2, 3) AS numbers, "
+        "CAST('{\"first\":\"x\",\"second\":null}' AS CHAR) AS names;")
+
+  QUERY(selectNonText,
+        "SELECT id AS attributes FROM test_json_parent ORDER BY id;")
+
+  QUERY(selectInvalid,
+        "SELECT '{\"color\": ' AS attributes;")
+
+};
+
+#include OATPP_CODEGEN_END(DbClient)
+
+}
+
+void JsonColumnTest::onRun() {
+
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+
+  auto connectionProvider = std::make_shared<oatpp::mysql::ConnectionProvider>(options);
+  auto executor = std::make_shared<oatpp::mysql::Executor>(connectionProvider);
+
+  auto client = MyClient(executor);
+
+  OATPP_ASSERT(client.createParentTable()->isSuccess());
+  OATPP_ASSERT(client.createChildTable()->isSuccess());
+  OATPP_ASSERT(client.deleteParents()->isSuccess());
+  OATPP_ASSERT(client.deleteChildren()->isSuccess());
+
+  // larger than the result bind buffer - the rest of the document is fetched on demand
+  std::string longNote(70000, 'n');
+
+  OATPP_ASSERT(client.insertParent(1, "first", "{\"color\": \"red\", \"size\": 3, \"tags\": [\"a\", \"b\"]}")->isSuccess());
+  OATPP_ASSERT(client.insertParent(2, "second", nullptr)->isSuccess());
+  OATPP_ASSERT(client.insertParent(3, "third", oatpp::String("{\"color\": \"blue\", \"note\": \"" + longNote + "\"}"))->isSuccess());
+
+  OATPP_ASSERT(client.insertChild(11, 1, "child-11")->isSuccess());
+  OATPP_ASSERT(client.insertChild(12, 1, "child-12")->isSuccess());
+  OATPP_ASSERT(client.insertChild(31, 3, "child-31")->isSuccess());
+
+  {
+    auto res = client.selectParents();
+    OATPP_ASSERT(res->isSuccess());
+
+    auto parents = res->fetch<oatpp::Vector<oatpp::Object<Parent>>>();
+    OATPP_ASSERT(parents->size() == 3);
+
+    {
+      auto& parent = parents[0];
+      OATPP_ASSERT(parent->id == 1);
+      OATPP_ASSERT(parent->name == "first");
+      OATPP_ASSERT(parent->attributes->color == "red");
+      OATPP_ASSERT(parent->attributes->size == 3);
+      OATPP_ASSERT(parent->attributes->tags->size() == 2);
+      OATPP_ASSERT(parent->attributes->tags[0] == "a");
+      OATPP_ASSERT(parent->attributes->tags[1] == "b");
+      OATPP_ASSERT(parent->attributes->note == nullptr);
+
+      // order of the aggregated rows is not defined
+      OATPP_ASSERT(parent->children->size() == 2);
+      for(auto& child : *parent->children) {
+        OATPP_ASSERT(child->id == 11 || child->id == 12);
+        OATPP_ASSERT(*child->title == "child-" + std::to_string(*child->id));
+      }
+    }
+
+    {
+      // no document, no children
+      auto& parent = parents[1];
+      OATPP_ASSERT(parent->id == 2);
+      OATPP_ASSERT(parent->attributes == nullptr);
+      OATPP_ASSERT(parent->children == nullptr);
+    }
+
+    {
+      auto& parent = parents[2];
+      OATPP_ASSERT(parent->id == 3);
+      OATPP_ASSERT(parent->attributes->color == "blue");
+      OATPP_ASSERT(parent->attributes->size == nullptr);
+      OATPP_ASSERT(parent->attributes->note->size() == longNote.size());
+      OATPP_ASSERT(parent->children->size() == 1);
+      OATPP_ASSERT(parent->children[0]->id == 31);
+    }
+  }
+
+  {
+    // text columns holding JSON are decoded the same way
+    auto res = client.selectCollections();
+    OATPP_ASSERT(res->isSuccess());
+
+    auto rows = res->fetch<oatpp::Vector<oatpp::Object<Collections>>>();
+    OATPP_ASSERT(rows->size() == 1);
+
+    auto& row = rows[0];
+    OATPP_ASSERT(row->counts->size() == 2);
+    OATPP_ASSERT(row->counts["a"] == 1);
+    OATPP_ASSERT(row->counts["b"] == 2);
+
+    OATPP_ASSERT(row->numbers->size() == 3);
+    OATPP_ASSERT(row->numbers->front() == 1);
+    OATPP_ASSERT(row->numbers->back() == 3);
+
+    // order of the document members is kept
+    OATPP_ASSERT(row->names->size() == 2);
+    OATPP_ASSERT(row->names->front().first == "first");
+    OATPP_ASSERT(row->names->front().second == "x");
+    OATPP_ASSERT(row->names->back().first == "second");
+    OATPP_ASSERT(row->names->back().second == nullptr);
+  }
+
+  {
+    auto res = client.selectNonText();
+    OATPP_ASSERT(res->isSuccess());
+
+    bool thrown = false;
+    try {
+      res->fetch<oatpp::Vector<oatpp::Object<AttributesOnly>>>();
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+  {
+    auto res = client.selectInvalid();
+    OATPP_ASSERT(res->isSuccess());
+
+    bool thrown = false;
+    try {
+      res->fetch<oatpp::Vector<oatpp::Object<AttributesOnly>>>();
+    } catch (const std::runtime_error& e) {
+      OATPP_LOGd(TAG, "invalid document: {}", e.what());
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_JsonColumnTest_hpp
+#define oatpp_test_mysql_mapping_JsonColumnTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class JsonColumnTest : public UnitTest {
+public:
+  JsonColumnTest() : UnitTest("TEST[mysql::mapping::JsonColumnTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_JsonColumnTest_hpp
@@ -0,0 +1,164 @@
+#include "RowBatchTest.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+#include <string>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+typedef oatpp::mysql::mapping::RowBatch RowBatch;
+
+#include OATPP_CODEGEN_BEGIN(DbClient)
+
+class MyClient : public oatpp::orm::DbClient {
+public:
+
+  MyClient(const std::shared_ptr<oatpp::orm::Executor>& executor)
+    : oatpp::orm::DbClient(executor)
+  {}
+
+  QUERY(selectRows,
+        "WITH RECURSIVE seq (n) AS (SELECT 1 UNION ALL SELECT n + 1 FROM seq WHERE n < :count) "
+        "SELECT n AS id, n * 1.25 AS f_decimal, n / 2e0 AS f_double, "
+        "IF(n % 4 = 0, NULL, CONCAT('name-', n)) AS f_string, "
+        "TIMESTAMP('2020-01-01 00:00:00') + INTERVAL n MINUTE AS f_datetime "
+        "FROM seq ORDER BY n;",
+        PARAM(oatpp::Int64, count))
+
+};
+
+#include OATPP_CODEGEN_END(DbClient)
+
+// 2020-01-01 00:00:00 UTC
+constexpr v_int64 BASE_EPOCH_MICROS = 1577836800LL * 1000 * 1000;
+
+void checkBatch(const RowBatch& batch, v_int64 firstId, v_int64 rowsCount) {
+
+  OATPP_ASSERT(batch.getRowsCount() == rowsCount);
+  OATPP_ASSERT(batch.getColumnsCount() == 5);
+
+  for(v_int64 i = 0; i < rowsCount; i ++) {
+
+    auto row = batch.getRow(i);
+    v_int64 n = firstId + i;
+
+    OATPP_ASSERT(row.getInt64(0) == n);
+    OATPP_ASSERT(row.getFloat64(1) == n * 1.25);
+    OATPP_ASSERT(row.getFloat64(2) == n / 2.0);
+    OATPP_ASSERT(row.getInt64(4) == BASE_EPOCH_MICROS + n * 60 * 1000 * 1000);
+
+    auto name = row.getString(3);
+    if(n % 4 == 0) {
+      OATPP_ASSERT(row.isNull(3));
+      OATPP_ASSERT(name.data == nullptr);
+      OATPP_ASSERT(name.toString() == nullptr);
+    } else {
+      OATPP_ASSERT(!row.isNull(3));
+      OATPP_ASSERT(name.toStdString() == "name-" + std::to_string(n));
+    }
+
+    // on demand conversion - same as for DTO fields
+    OATPP_ASSERT(row.get<oatpp::Int64>(0) == n);
+    auto nameValue = row.get<oatpp::String>(3);
+    if(n % 4 == 0) {
+      OATPP_ASSERT(nameValue == nullptr);
+    } else {
+      OATPP_ASSERT(*nameValue == "name-" + std::to_string(n));
+    }
+
+  }
+
+}
+
+}
+
+void RowBatchTest::onRun() {
+
+  {
+    RowBatch::StringView view;
+    view.data = "hello world";
+    view.size = 5;
+
+    OATPP_ASSERT(view.equals("hello"));
+    OATPP_ASSERT(!view.equals("hello world"));
+    OATPP_ASSERT(!view.equals("hell"));
+    OATPP_ASSERT(!view.equals(nullptr));
+    OATPP_ASSERT(view.toString() == "hello");
+    OATPP_ASSERT(view.toStdString() == "hello");
+
+    RowBatch::StringView nullView;
+    nullView.data = nullptr;
+    nullView.size = 0;
+
+    OATPP_ASSERT(nullView.equals(nullptr));
+    OATPP_ASSERT(!nullView.equals(""));
+    OATPP_ASSERT(nullView.toString() == nullptr);
+    OATPP_ASSERT(nullView.toStdString().empty());
+  }
+
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+
+  auto connectionProvider = std::make_shared<oatpp::mysql::ConnectionProvider>(options);
+  auto executor = std::make_shared<oatpp::mysql::Executor>(connectionProvider);
+
+  auto client = MyClient(executor);
+
+  {
+    auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectRows(25));
+    OATPP_ASSERT(res->isSuccess());
+
+    RowBatch batch;
+
+    // each read replaces rows of the batch
+    OATPP_ASSERT(res->fetchBatch(batch, 10) == 10);
+    checkBatch(batch, 1, 10);
+
+    OATPP_ASSERT(batch.getColumnIndex("id") == 0);
+    OATPP_ASSERT(batch.getColumnIndex("f_datetime") == 4);
+    OATPP_ASSERT(batch.getColumnIndex("unknown") == -1);
+
+    OATPP_ASSERT(res->fetchBatch(batch, 10) == 10);
+    checkBatch(batch, 11, 10);
+
+    OATPP_ASSERT(res->fetchBatch(batch, 10) == 5);
+    checkBatch(batch, 21, 5);
+
+    bool thrown = false;
+    try {
+      batch.getRow(5).getInt64(0);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    thrown = false;
+    try {
+      batch.getRow(0).getInt64(3);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    thrown = false;
+    try {
+      batch.getRow(0).getFloat64(3);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    OATPP_ASSERT(!res->hasMoreToFetch());
+    OATPP_ASSERT(res->fetchBatch(batch, 10) == 0);
+    OATPP_ASSERT(batch.getRowsCount() == 0);
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_RowBatchTest_hpp
+#define oatpp_test_mysql_mapping_RowBatchTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class RowBatchTest : public UnitTest {
+public:
+  RowBatchTest() : UnitTest("TEST[mysql::mapping::RowBatchTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_RowBatchTest_hpp
@@ -0,0 +1,168 @@
+#include "StreamColumnTest.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+#include "oatpp/data/stream/BufferStream.hpp"
+
+#include <string>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class FileRow : public oatpp::DTO {
+
+  DTO_INIT(FileRow, DTO);
+
+  DTO_FIELD(Int64, id);
+  DTO_FIELD(String, name);
+  DTO_FIELD(String, data);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+#include OATPP_CODEGEN_BEGIN(DbClient)
+
+class MyClient : public oatpp::orm::DbClient {
+public:
+
+  MyClient(const std::shared_ptr<oatpp::orm::Executor>& executor)
+    : oatpp::orm::DbClient(executor)
+  {}
+
+  QUERY(createTable,
+        "CREATE TABLE IF NOT EXISTS test_stream_column (id BIGINT PRIMARY KEY, name VARCHAR(32), data LONGBLOB);")
+
+  QUERY(deleteAll,
+        "DELETE FROM test_stream_column;")
+
+  QUERY(insertFile,
+        "INSERT INTO test_stream_column (id, name, data) VALUES (:id, :name, :data);",
+        PARAM(oatpp::Int64, id),
+        PARAM(oatpp::String, name),
+        PARAM(oatpp::String, data))
+
+  QUERY(selectAll,
+        "SELECT id, name, data FROM test_stream_column ORDER BY id;")
+
+};
+
+#include OATPP_CODEGEN_END(DbClient)
+
+}
+
+void StreamColumnTest::onRun() {
+
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+
+  auto connectionProvider = std::make_shared<oatpp::mysql::ConnectionProvider>(options);
+  auto executor = std::make_shared<oatpp::mysql::Executor>(connectionProvider);
+
+  auto client = MyClient(executor);
+
+  OATPP_ASSERT(client.createTable()->isSuccess());
+  OATPP_ASSERT(client.deleteAll()->isSuccess());
+
+  // larger than the result bind buffer, zero bytes included
+  std::string large(300000, '\0');
+  for(size_t i = 0; i < large.size(); i ++) {
+    large[i] = (char) ((i * 7) % 256);
+  }
+
+  std::vector<oatpp::String> values = {oatpp::String(large), nullptr, "", "small"};
+
+  for(size_t i = 0; i < values.size(); i ++) {
+    OATPP_ASSERT(client.insertFile((v_int64) i + 1, oatpp::String("file-" + std::to_string(i + 1)), values[i])->isSuccess());
+  }
+
+  {
+    auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectAll());
+    OATPP_ASSERT(res->isSuccess());
+
+    bool thrown = false;
+    try {
+      oatpp::data::stream::BufferOutputStream stream;
+      res->streamColumn("id", &stream);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    thrown = false;
+    try {
+      oatpp::data::stream::BufferOutputStream stream;
+      res->streamColumn("unknown", &stream);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    v_int64 id = 1;
+
+    while(res->hasMoreToFetch()) {
+
+      const auto& value = values[id - 1];
+
+      // chunk is much smaller than the value
+      oatpp::data::stream::BufferOutputStream stream;
+      auto written = res->streamColumn("data", &stream, 1000);
+
+      if(value) {
+        OATPP_ASSERT(written == (v_int64) value->size());
+        OATPP_ASSERT(stream.toString() == value);
+      } else {
+        OATPP_ASSERT(written == 0);
+        OATPP_ASSERT(stream.getCurrentPosition() == 0);
+      }
+
+      // other columns of the row are fetched as usual
+      auto rows = res->fetch<oatpp::Vector<oatpp::Object<FileRow>>>(1);
+      OATPP_ASSERT(rows->size() == 1);
+      OATPP_ASSERT(rows[0]->id == id);
+      OATPP_ASSERT(*rows[0]->name == "file-" + std::to_string(id));
+
+      // the streamed column holds the prefix only
+      if(value) {
+        OATPP_ASSERT(rows[0]->data != nullptr);
+        OATPP_ASSERT(rows[0]->data->size() <= value->size());
+        OATPP_ASSERT(value->compare(0, rows[0]->data->size(), *rows[0]->data) == 0);
+      } else {
+        OATPP_ASSERT(rows[0]->data == nullptr);
+      }
+
+      id ++;
+
+    }
+
+    OATPP_ASSERT(id == (v_int64) values.size() + 1);
+
+    thrown = false;
+    try {
+      oatpp::data::stream::BufferOutputStream stream;
+      res->streamColumn("data", &stream);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+  {
+    // the whole value is fetched if the column is not streamed
+    auto res = client.selectAll();
+    OATPP_ASSERT(res->isSuccess());
+    auto rows = res->fetch<oatpp::Vector<oatpp::Object<FileRow>>>();
+    OATPP_ASSERT(rows->size() == values.size());
+    OATPP_ASSERT(*rows[0]->data == large);
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_StreamColumnTest_hpp
+#define oatpp_test_mysql_mapping_StreamColumnTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class StreamColumnTest : public UnitTest {
+public:
+  StreamColumnTest() : UnitTest("TEST[mysql::mapping::StreamColumnTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_StreamColumnTest_hpp
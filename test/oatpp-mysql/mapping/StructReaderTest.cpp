@@ -0,0 +1,138 @@
+#include "StructReaderTest.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+#include <string>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+typedef oatpp::mysql::mapping::StructReader StructReader;
+
+struct Item {
+  v_int64 id;
+  v_float64 price;
+  v_uint16 quantity;
+  StructReader::StringRef currency;
+  StructReader::StringRef note;
+};
+
+#include OATPP_CODEGEN_BEGIN(DbClient)
+
+class MyClient : public oatpp::orm::DbClient {
+public:
+
+  MyClient(const std::shared_ptr<oatpp::orm::Executor>& executor)
+    : oatpp::orm::DbClient(executor)
+  {}
+
+  QUERY(createTable,
+        "CREATE TABLE IF NOT EXISTS test_struct_reader ("
+        "id BIGINT PRIMARY KEY, price DOUBLE, quantity SMALLINT UNSIGNED, currency VARCHAR(8), note MEDIUMTEXT);")
+
+  QUERY(deleteAll,
+        "DELETE FROM test_struct_reader;")
+
+  QUERY(insertItem,
+        "INSERT INTO test_struct_reader (id, price, quantity, currency, note) "
+        "VALUES (:id, :price, :quantity, :currency, :note);",
+        PARAM(oatpp::Int64, id),
+        PARAM(oatpp::Float64, price),
+        PARAM(oatpp::Int32, quantity),
+        PARAM(oatpp::String, currency),
+        PARAM(oatpp::String, note))
+
+  QUERY(selectAll,
+        "SELECT id, price, quantity, currency, note FROM test_struct_reader ORDER BY id;")
+
+};
+
+#include OATPP_CODEGEN_END(DbClient)
+
+}
+
+void StructReaderTest::onRun() {
+
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+
+  auto connectionProvider = std::make_shared<oatpp::mysql::ConnectionProvider>(options);
+  auto executor = std::make_shared<oatpp::mysql::Executor>(connectionProvider);
+
+  auto client = MyClient(executor);
+
+  OATPP_ASSERT(client.createTable()->isSuccess());
+  OATPP_ASSERT(client.deleteAll()->isSuccess());
+
+  // longer than the result bind buffer - the rest is fetched with mysql_stmt_fetch_column()
+  std::string longNote(70000, 'n');
+
+  OATPP_ASSERT(client.insertItem(1, 1.5, 10, "USD", "first")->isSuccess());
+  OATPP_ASSERT(client.insertItem(2, 2.5, 20, "EUR", nullptr)->isSuccess());
+  OATPP_ASSERT(client.insertItem(3, nullptr, nullptr, nullptr, "")->isSuccess());
+  OATPP_ASSERT(client.insertItem(4, 4.5, 65535, "GBP", longNote.c_str())->isSuccess());
+  OATPP_ASSERT(client.insertItem(5, 5.5, 50, "JPY", "last")->isSuccess());
+
+  StructReader reader({
+    OATPP_MYSQL_STRUCT_MEMBER(Item, id),
+    OATPP_MYSQL_STRUCT_MEMBER(Item, price),
+    OATPP_MYSQL_STRUCT_MEMBER(Item, quantity),
+    OATPP_MYSQL_STRUCT_MEMBER(Item, currency),
+    OATPP_MYSQL_STRUCT_MEMBER(Item, note)
+  });
+
+  auto res = std::static_pointer_cast<oatpp::mysql::QueryResult>(client.selectAll());
+  OATPP_ASSERT(res->isSuccess());
+
+  Item items[5];
+
+  // several reads - the first row of each read comes from the result binds, the others from the staging row
+  OATPP_ASSERT(res->fetchInto(reader, items, 2) == 2);
+  OATPP_ASSERT(res->fetchInto(reader, items + 2, 2) == 2);
+  OATPP_ASSERT(res->fetchInto(reader, items + 4, 2) == 1);
+  OATPP_ASSERT(res->fetchInto(reader, items, 2) == 0);
+  OATPP_ASSERT(!res->hasMoreToFetch());
+
+  for(v_int64 i = 0; i < 5; i ++) {
+    OATPP_ASSERT(items[i].id == i + 1);
+  }
+
+  OATPP_ASSERT(items[0].price == 1.5);
+  OATPP_ASSERT(items[0].quantity == 10);
+  OATPP_ASSERT(reader.getString(items[0].currency) == "USD");
+  OATPP_ASSERT(reader.getString(items[0].note) == "first");
+
+  OATPP_ASSERT(items[1].price == 2.5);
+  OATPP_ASSERT(items[1].quantity == 20);
+  OATPP_ASSERT(reader.getString(items[1].currency) == "EUR");
+  OATPP_ASSERT(items[1].note.isNull());
+  OATPP_ASSERT(reader.getData(items[1].note) == nullptr);
+
+  // nulls of the fixed-size members are zeros
+  OATPP_ASSERT(items[2].price == 0);
+  OATPP_ASSERT(items[2].quantity == 0);
+  OATPP_ASSERT(items[2].currency.isNull());
+  OATPP_ASSERT(!items[2].note.isNull());
+  OATPP_ASSERT(items[2].note.size == 0);
+
+  OATPP_ASSERT(items[3].price == 4.5);
+  OATPP_ASSERT(items[3].quantity == 65535);
+  OATPP_ASSERT(reader.getString(items[3].currency) == "GBP");
+  OATPP_ASSERT(items[3].note.size == (v_buff_size) longNote.size());
+  OATPP_ASSERT(reader.getString(items[3].note) == longNote.c_str());
+
+  OATPP_ASSERT(items[4].price == 5.5);
+  OATPP_ASSERT(items[4].quantity == 50);
+  OATPP_ASSERT(reader.getString(items[4].currency) == "JPY");
+  OATPP_ASSERT(reader.getString(items[4].note) == "last");
+
+  reader.clearArena();
+
+}
+
+}}}}
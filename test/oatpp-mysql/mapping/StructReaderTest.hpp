@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_StructReaderTest_hpp
+#define oatpp_test_mysql_mapping_StructReaderTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class StructReaderTest : public UnitTest {
+public:
+  StructReaderTest() : UnitTest("TEST[mysql::mapping::StructReaderTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_StructReaderTest_hpp
@@ -0,0 +1,80 @@
+#include "TimeCodecTest.hpp"
+
+#include "oatpp-mysql/mapping/TimeCodec.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+typedef oatpp::mysql::mapping::TimeCodec TimeCodec;
+
+oatpp::String format(const MYSQL_TIME& time) {
+  char buffer[TimeCodec::MAX_TEXT_SIZE];
+  auto size = TimeCodec::format(time, buffer);
+  return oatpp::String(buffer, size);
+}
+
+bool parse(const char* text, enum_field_types type, MYSQL_TIME& time) {
+  return TimeCodec::parse(text, std::strlen(text), type, time);
+}
+
+}
+
+void TimeCodecTest::onRun() {
+
+  MYSQL_TIME time;
+
+  {
+    OATPP_ASSERT(parse("2020-09-04", MYSQL_TYPE_DATE, time));
+    OATPP_ASSERT(time.time_type == MYSQL_TIMESTAMP_DATE);
+    OATPP_ASSERT(TimeCodec::toEpochMicros(time) == 1599177600000000LL);
+    OATPP_ASSERT(format(time) == "2020-09-04");
+  }
+
+  {
+    OATPP_ASSERT(parse("2020-09-04 00:00:00", MYSQL_TYPE_DATETIME, time));
+    OATPP_ASSERT(TimeCodec::toEpochMicros(time) == 1599177600000000LL);
+    OATPP_ASSERT(format(time) == "2020-09-04 00:00:00");
+  }
+
+  {
+    OATPP_ASSERT(parse("2020-09-03 23:59:59.25", MYSQL_TYPE_TIMESTAMP, time));
+    OATPP_ASSERT(time.second_part == 250000);
+    OATPP_ASSERT(TimeCodec::toEpochMicros(time) == 1599177599250000LL);
+    OATPP_ASSERT(format(time) == "2020-09-03 23:59:59.250000");
+  }
+
+  {
+    OATPP_ASSERT(parse("-838:59:59", MYSQL_TYPE_TIME, time));
+    OATPP_ASSERT(time.neg);
+    OATPP_ASSERT(TimeCodec::toEpochMicros(time) == -3020399000000LL);
+    OATPP_ASSERT(format(time) == "-838:59:59");
+  }
+
+  {
+    TimeCodec::fromEpochMicros(-1, MYSQL_TIMESTAMP_DATETIME, time);
+    OATPP_ASSERT(format(time) == "1969-12-31 23:59:59.999999");
+
+    TimeCodec::fromEpochMicros(951782400000000LL, MYSQL_TIMESTAMP_DATE, time);
+    OATPP_ASSERT(format(time) == "2000-02-29");
+  }
+
+  {
+    // round trip over years 1811 - 2128
+    for(v_int64 micros = -5000000000000000LL; micros < 5000000000000000LL; micros += 123456789012LL) {
+      TimeCodec::fromEpochMicros(micros, MYSQL_TIMESTAMP_DATETIME, time);
+      OATPP_ASSERT(TimeCodec::toEpochMicros(time) == micros);
+    }
+  }
+
+  {
+    OATPP_ASSERT(!parse("2020-09-0x", MYSQL_TYPE_DATE, time));
+    OATPP_ASSERT(!parse("2020-09-04 00:00", MYSQL_TYPE_DATETIME, time));
+    OATPP_ASSERT(!parse("12:00:00.", MYSQL_TYPE_TIME, time));
+  }
+
+}
+
+}}}}
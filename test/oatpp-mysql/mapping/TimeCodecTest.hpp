@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_TimeCodecTest_hpp
+#define oatpp_test_mysql_mapping_TimeCodecTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class TimeCodecTest : public UnitTest {
+public:
+  TimeCodecTest() : UnitTest("TEST[mysql::mapping::TimeCodecTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_TimeCodecTest_hpp
@@ -0,0 +1,68 @@
+#include "UuidCodecTest.hpp"
+
+#include "oatpp-mysql/mapping/UuidCodec.hpp"
+
+#include <cstring>
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+namespace {
+
+typedef oatpp::mysql::mapping::UuidCodec UuidCodec;
+
+oatpp::String format(const v_uint8* bytes) {
+  char text[UuidCodec::TEXT_SIZE];
+  UuidCodec::format(bytes, text);
+  return oatpp::String(text, UuidCodec::TEXT_SIZE);
+}
+
+bool parse(const char* text, v_uint8* bytes) {
+  return UuidCodec::parse(text, std::strlen(text), bytes);
+}
+
+}
+
+void UuidCodecTest::onRun() {
+
+  v_uint8 bytes[UuidCodec::SIZE];
+
+  {
+    OATPP_ASSERT(parse("123e4567-e89b-12d3-a456-426614174000", bytes));
+    OATPP_ASSERT(bytes[0] == 0x12 && bytes[15] == 0x00 && bytes[6] == 0x12);
+    OATPP_ASSERT(format(bytes) == "123e4567-e89b-12d3-a456-426614174000");
+
+    OATPP_ASSERT(parse("123E4567E89B12D3A456426614174000", bytes));
+    OATPP_ASSERT(format(bytes) == "123e4567-e89b-12d3-a456-426614174000");
+
+    OATPP_ASSERT(!parse("123e4567-e89b-12d3-a456-42661417400g", bytes));
+    OATPP_ASSERT(!parse("123e4567_e89b-12d3-a456-426614174000", bytes));
+    OATPP_ASSERT(!parse("123e4567-e89b-12d3-a456-42661417400", bytes));
+  }
+
+  {
+    // every byte value survives the round trip
+    for(v_int32 start = 0; start < 256; start += UuidCodec::SIZE) {
+      v_uint8 value[UuidCodec::SIZE];
+      for(v_int32 i = 0; i < UuidCodec::SIZE; i ++) {
+        value[i] = (v_uint8) (start + i);
+      }
+      OATPP_ASSERT(parse(format(value)->c_str(), bytes));
+      OATPP_ASSERT(std::memcmp(value, bytes, UuidCodec::SIZE) == 0);
+    }
+  }
+
+  {
+    v_uint8 first[UuidCodec::SIZE];
+    v_uint8 second[UuidCodec::SIZE];
+    UuidCodec::generateV7(1700000000000, first);
+    UuidCodec::generateV7(1700000000001, second);
+
+    OATPP_ASSERT(UuidCodec::getV7Millis(first) == 1700000000000);
+    OATPP_ASSERT((first[6] >> 4) == 7);
+    OATPP_ASSERT((first[8] >> 6) == 2);
+    OATPP_ASSERT(std::memcmp(first, second, UuidCodec::SIZE) < 0);
+  }
+
+}
+
+}}}}
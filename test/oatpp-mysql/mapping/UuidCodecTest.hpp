@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_mapping_UuidCodecTest_hpp
+#define oatpp_test_mysql_mapping_UuidCodecTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace mapping {
+
+class UuidCodecTest : public UnitTest {
+public:
+  UuidCodecTest() : UnitTest("TEST[mysql::mapping::UuidCodecTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_mapping_UuidCodecTest_hpp
@@ -0,0 +1,121 @@
+#include "ListExpanderTest.hpp"
+
+#include "oatpp-mysql/ql_template/ListExpander.hpp"
+
+#include <limits>
+#include <stdexcept>
+
+namespace oatpp { namespace test { namespace mysql { namespace ql_template {
+
+namespace {
+
+typedef oatpp::mysql::ql_template::ListExpander ListExpander;
+
+}
+
+void ListExpanderTest::onRun() {
+
+  {
+    OATPP_ASSERT(ListExpander::getBucketSize(1) == 1);
+    OATPP_ASSERT(ListExpander::getBucketSize(2) == 2);
+    OATPP_ASSERT(ListExpander::getBucketSize(3) == 4);
+    OATPP_ASSERT(ListExpander::getBucketSize(5) == 8);
+    OATPP_ASSERT(ListExpander::getBucketSize(512) == 512);
+  }
+
+  {
+    OATPP_ASSERT(ListExpander::isList(oatpp::Vector<oatpp::Int64>::Class::getType()));
+    OATPP_ASSERT(ListExpander::isList(oatpp::List<oatpp::String>::Class::getType()));
+    OATPP_ASSERT(ListExpander::isList(oatpp::UnorderedSet<oatpp::Int32>::Class::getType()));
+    OATPP_ASSERT(!ListExpander::isList(oatpp::String::Class::getType()));
+    OATPP_ASSERT(!ListExpander::isList(oatpp::Fields<oatpp::String>::Class::getType()));
+  }
+
+  {
+    // padded with the last value
+    oatpp::Vector<oatpp::Int64> ids = {1, 2, 3};
+    std::vector<oatpp::Void> values;
+    auto text = ListExpander::expand(ids, true, 0, values);
+    OATPP_ASSERT(text == "?,?,?,?");
+    OATPP_ASSERT(values.size() == 4);
+    OATPP_ASSERT(values[2].get() == values[3].get());
+  }
+
+  {
+    // no padding for the literal queries
+    oatpp::List<oatpp::String> names = {"a", "b", "c"};
+    std::vector<oatpp::Void> values;
+    auto text = ListExpander::expand(names, false, 0, values);
+    OATPP_ASSERT(text == "?,?,?");
+    OATPP_ASSERT(values.size() == 3);
+  }
+
+  {
+    auto empty = oatpp::Vector<oatpp::Int64>::createShared();
+    std::vector<oatpp::Void> values;
+    // empty subquery - NOT IN must match all rows
+    OATPP_ASSERT(ListExpander::expand(empty, true, 0, values) == "SELECT NULL FROM DUAL WHERE FALSE");
+    OATPP_ASSERT(ListExpander::expand(empty, false, 0, values) == ListExpander::EMPTY_LIST);
+    OATPP_ASSERT(ListExpander::expand(oatpp::Vector<oatpp::Int64>(nullptr), true, 0, values) == ListExpander::EMPTY_LIST);
+    OATPP_ASSERT(values.empty());
+  }
+
+  {
+    // large numeric list - one JSON parameter
+    auto ids = oatpp::Vector<oatpp::UInt32>::createShared();
+    for(v_uint32 i = 0; i <= ListExpander::MAX_PLACEHOLDERS; i ++) {
+      ids->push_back(i);
+    }
+    ids[5] = nullptr;
+
+    std::vector<oatpp::Void> values;
+    auto text = ListExpander::expand(ids, true, 2, values);
+    OATPP_ASSERT(text == "SELECT v FROM JSON_TABLE(?, '$[*]' COLUMNS(v BIGINT UNSIGNED PATH '$')) AS oatpp_list_2");
+    OATPP_ASSERT(values.size() == 1);
+
+    oatpp::String json = values[0].cast<oatpp::String>();
+    OATPP_ASSERT(json->substr(0, 14) == "[0,1,2,3,4,nul");
+    OATPP_ASSERT(json->substr(json->size() - 5) == ",512]");
+  }
+
+  {
+    // floats in JSON
+    auto prices = oatpp::Vector<oatpp::Float64>::createShared();
+    for(v_int64 i = 0; i <= ListExpander::MAX_PLACEHOLDERS; i ++) {
+      prices->push_back(0.5);
+    }
+
+    std::vector<oatpp::Void> values;
+    auto text = ListExpander::expand(prices, true, 0, values);
+    OATPP_ASSERT(text == "SELECT v FROM JSON_TABLE(?, '$[*]' COLUMNS(v DOUBLE PATH '$')) AS oatpp_list_0");
+    OATPP_ASSERT(values[0].cast<oatpp::String>()->substr(0, 9) == "[0.5,0.5,");
+
+    // NaN and infinity are not JSON
+    const v_float64 invalid[] = {std::numeric_limits<v_float64>::quiet_NaN(), std::numeric_limits<v_float64>::infinity()};
+    for(auto value : invalid) {
+      prices[3] = value;
+      bool thrown = false;
+      try {
+        ListExpander::expand(prices, true, 0, values);
+      } catch (const std::runtime_error&) {
+        thrown = true;
+      }
+      OATPP_ASSERT(thrown);
+    }
+  }
+
+  {
+    // large string list - one placeholder per item
+    auto names = oatpp::Vector<oatpp::String>::createShared();
+    for(v_int64 i = 0; i < ListExpander::MAX_PLACEHOLDERS + 3; i ++) {
+      names->push_back("name");
+    }
+    std::vector<oatpp::Void> values;
+    auto text = ListExpander::expand(names, true, 0, values);
+    OATPP_ASSERT((v_int64) values.size() == ListExpander::MAX_PLACEHOLDERS + 3);
+    OATPP_ASSERT((v_int64) text->size() == (ListExpander::MAX_PLACEHOLDERS + 3) * 2 - 1);
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_ql_template_ListExpanderTest_hpp
+#define oatpp_test_mysql_ql_template_ListExpanderTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace ql_template {
+
+class ListExpanderTest : public UnitTest {
+public:
+  ListExpanderTest() : UnitTest("TEST[mysql::ql_template::ListExpanderTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_ql_template_ListExpanderTest_hpp
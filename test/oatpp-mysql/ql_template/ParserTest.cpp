@@ -76,6 +76,51 @@ void ParserTest::onRun() {
     OATPP_ASSERT(vars[1].name == "name");
   }
 
+  {
+    // CASE 4: skip comments and read query hints
+    oatpp::String text = "/*oatpp: compress, shard_key=user.id*/ SELECT * FROM table -- :skipped\n WHERE id = :id; # :skipped";
+    auto result = Parser::parseTemplate(text);
+
+    OATPP_LOGd(TAG, "--- case4 comments ---");
+    OATPP_LOGd(TAG, "sql='{}'", text->c_str());
+
+    OATPP_ASSERT(result.getTemplateVariables().size() == 1);
+
+    auto vars = result.getTemplateVariables();
+    OATPP_ASSERT(vars[0].name == "id");
+
+    auto extra = std::static_pointer_cast<Parser::TemplateExtra>(result.getExtraData());
+    OATPP_ASSERT(extra);
+    OATPP_ASSERT(extra->hasHint("compress"));
+    OATPP_ASSERT(extra->getHint("shard_key") == "user.id");
+    OATPP_ASSERT(!extra->hasHint("hedge"));
+  }
+
+  {
+    // CASE 5: classify read-only statements
+    OATPP_LOGd(TAG, "--- case5 read/write ---");
+
+    auto isReadOnly = [](const oatpp::String& text) {
+      auto result = Parser::parseTemplate(text);
+      return std::static_pointer_cast<Parser::TemplateExtra>(result.getExtraData())->readOnly;
+    };
+
+    OATPP_ASSERT(isReadOnly("SELECT * FROM table WHERE id = :id;"));
+    OATPP_ASSERT(isReadOnly("  /* comment */ select * from table;"));
+    OATPP_ASSERT(isReadOnly("SELECT * FROM table WHERE name = 'for update';"));
+    OATPP_ASSERT(!isReadOnly("SELECT * FROM table WHERE id = :id FOR UPDATE;"));
+    OATPP_ASSERT(!isReadOnly("INSERT INTO table (id) VALUES (:id);"));
+    OATPP_ASSERT(!isReadOnly("/*oatpp: write*/ SELECT GET_LOCK('lock', 10);"));
+    OATPP_ASSERT(!isReadOnly("SELECT LAST_INSERT_ID();"));
+    OATPP_ASSERT(!isReadOnly("SELECT found_rows();"));
+    OATPP_ASSERT(!isReadOnly("SELECT GET_LOCK('lock', 10);"));
+    OATPP_ASSERT(!isReadOnly("SELECT @counter;"));
+    OATPP_ASSERT(!isReadOnly("SELECT @@session.sql_mode;"));
+    OATPP_ASSERT(!isReadOnly("SHOW WARNINGS;"));
+    OATPP_ASSERT(isReadOnly("SELECT * FROM table WHERE email = 'user@example.com';"));
+    OATPP_ASSERT(isReadOnly("/*oatpp: read*/ CALL get_users();"));
+  }
+
 }
 
 }}}}
@@ -0,0 +1,232 @@
+#include "RoutingExecutorTest.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+#include "oatpp-mysql/RoutingExecutor.hpp"
+
+#include "oatpp/Environment.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace oatpp { namespace test { namespace mysql { namespace routing {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class ValueRow : public oatpp::DTO {
+
+  DTO_INIT(ValueRow, DTO);
+
+  DTO_FIELD(Int64, value);
+
+};
+
+class ModeRow : public oatpp::DTO {
+
+  DTO_INIT(ModeRow, DTO);
+
+  DTO_FIELD(String, mode);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+#include OATPP_CODEGEN_BEGIN(DbClient)
+
+class MyClient : public oatpp::orm::DbClient {
+public:
+
+  MyClient(const std::shared_ptr<oatpp::orm::Executor>& executor)
+    : oatpp::orm::DbClient(executor)
+  {}
+
+  QUERY(selectValue,
+        "SELECT CAST(:value AS SIGNED) AS value;",
+        PARAM(oatpp::Int64, value))
+
+  QUERY(selectValueOnPrimary,
+        "/*oatpp: write*/ SELECT CAST(:value AS SIGNED) AS value;",
+        PARAM(oatpp::Int64, value))
+
+  QUERY(selectLastInsertId,
+        "SELECT LAST_INSERT_ID() AS value;")
+
+  QUERY(selectValueHedged,
+        "/*oatpp: hedge*/ SELECT CAST(:value AS SIGNED) AS value;",
+        PARAM(oatpp::Int64, value))
+
+  QUERY(createTable,
+        "CREATE TABLE IF NOT EXISTS test_routing_gtids (id BIGINT PRIMARY KEY AUTO_INCREMENT, value BIGINT) ENGINE=InnoDB;")
+
+  QUERY(insertValue,
+        "INSERT INTO test_routing_gtids (value) VALUES (:value);",
+        PARAM(oatpp::Int64, value))
+
+  QUERY(selectGtidMode,
+        "SELECT @@GLOBAL.gtid_mode AS mode;")
+
+};
+
+#include OATPP_CODEGEN_END(DbClient)
+
+/*
+ * Replica provider with the connect delay - the next connect of any replica sharing the delay takes that long.
+ */
+class DelayedProvider : public oatpp::provider::Provider<oatpp::mysql::Connection> {
+private:
+  std::shared_ptr<oatpp::mysql::ConnectionProvider> m_provider;
+  std::shared_ptr<std::atomic<v_int64>> m_delayMicros;
+public:
+
+  DelayedProvider(const std::shared_ptr<oatpp::mysql::ConnectionProvider>& provider,
+                  const std::shared_ptr<std::atomic<v_int64>>& delayMicros)
+    : m_provider(provider)
+    , m_delayMicros(delayMicros)
+  {}
+
+  oatpp::provider::ResourceHandle<oatpp::mysql::Connection> get() override {
+    v_int64 delay = m_delayMicros->exchange(0);
+    if(delay > 0) {
+      std::this_thread::sleep_for(std::chrono::microseconds(delay));
+    }
+    return m_provider->get();
+  }
+
+  oatpp::async::CoroutineStarterForResult<const oatpp::provider::ResourceHandle<oatpp::mysql::Connection>&> getAsync() override {
+    return m_provider->getAsync();
+  }
+
+  void stop() override {
+    m_provider->stop();
+  }
+
+};
+
+v_int64 fetchValue(const std::shared_ptr<oatpp::orm::QueryResult>& result) {
+  OATPP_ASSERT(result->isSuccess());
+  auto rows = result->fetch<oatpp::Vector<oatpp::Object<ValueRow>>>();
+  OATPP_ASSERT(rows->size() == 1);
+  return *rows[0]->value;
+}
+
+v_int64 countReplicaQueries(oatpp::mysql::RoutingExecutor& executor) {
+  v_int64 count = 0;
+  for(auto& stats : executor.getReplicaStats()) {
+    OATPP_ASSERT(stats.outstanding == 0);
+    count += stats.queriesCount;
+  }
+  return count;
+}
+
+}
+
+void RoutingExecutorTest::onRun() {
+
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+
+  OATPP_LOGd(TAG, "Connect to database '{}' on '{}:{}'", options.database->c_str(), options.host->c_str(), options.port);
+
+  // the same server plays the primary and both replicas
+  auto delayMicros = std::make_shared<std::atomic<v_int64>>(0);
+  std::vector<std::shared_ptr<oatpp::provider::Provider<oatpp::mysql::Connection>>> replicaProviders = {
+    std::make_shared<DelayedProvider>(std::make_shared<oatpp::mysql::ConnectionProvider>(options), delayMicros),
+    std::make_shared<DelayedProvider>(std::make_shared<oatpp::mysql::ConnectionProvider>(options), delayMicros)
+  };
+
+  auto executor = std::make_shared<oatpp::mysql::RoutingExecutor>(
+    std::make_shared<oatpp::mysql::ConnectionProvider>(options),
+    replicaProviders
+  );
+
+  auto client = MyClient(executor);
+
+  {
+    // reads go to the replicas
+    for(v_int64 i = 0; i < 4; i ++) {
+      OATPP_ASSERT(fetchValue(client.selectValue(i)) == i);
+    }
+    OATPP_ASSERT(countReplicaQueries(*executor) == 4);
+
+    // hinted writes and reads of the session state go to the primary
+    OATPP_ASSERT(fetchValue(client.selectValueOnPrimary(5)) == 5);
+    OATPP_ASSERT(fetchValue(client.selectLastInsertId()) == 0);
+    OATPP_ASSERT(countReplicaQueries(*executor) == 4);
+
+    // transaction stays on the primary connection
+    auto connection = executor->getConnection();
+    OATPP_ASSERT(fetchValue(client.selectValue(6, connection)) == 6);
+    OATPP_ASSERT(countReplicaQueries(*executor) == 4);
+
+    for(auto& stats : executor->getReplicaStats()) {
+      OATPP_ASSERT(stats.queriesCount == 0 || stats.latencyMicros > 0);
+    }
+  }
+
+  {
+    executor->setHedging(0.5, 1.0);
+
+    // reads are not hedged until the latency window is filled
+    for(v_int64 i = 0; i < 64; i ++) {
+      OATPP_ASSERT(fetchValue(client.selectValueHedged(i)) == i);
+    }
+
+    // cancellations of the warm-up hedges connect to the replicas too - let them finish
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    v_int64 hedgesCount = executor->getHedgesCount();
+
+    // the first attempt is stuck in connect - the hedge answers first
+    *delayMicros = 2 * 1000 * 1000;
+
+    v_int64 startTime = oatpp::Environment::getMicroTickCount();
+    OATPP_ASSERT(fetchValue(client.selectValueHedged(100)) == 100);
+    v_int64 elapsed = oatpp::Environment::getMicroTickCount() - startTime;
+
+    OATPP_LOGd(TAG, "hedged read took {}us", elapsed);
+    OATPP_ASSERT(executor->getHedgesCount() == hedgesCount + 1);
+    OATPP_ASSERT(elapsed < 2 * 1000 * 1000);
+    OATPP_ASSERT(*delayMicros == 0);
+  }
+
+  {
+    auto trackingOptions = options;
+    trackingOptions.trackGtids = true;
+
+    auto trackingExecutor = std::make_shared<oatpp::mysql::RoutingExecutor>(
+      std::make_shared<oatpp::mysql::ConnectionProvider>(trackingOptions),
+      std::vector<std::shared_ptr<oatpp::provider::Provider<oatpp::mysql::Connection>>>()
+    );
+    auto trackingClient = MyClient(trackingExecutor);
+
+    OATPP_ASSERT(trackingClient.createTable()->isSuccess());
+
+    auto modes = trackingClient.selectGtidMode()->fetch<oatpp::Vector<oatpp::Object<ModeRow>>>();
+    OATPP_ASSERT(modes->size() == 1);
+    bool gtidsEnabled = (modes[0]->mode == "ON");
+    OATPP_LOGd(TAG, "gtid_mode={}", modes[0]->mode->c_str());
+
+    auto session = std::make_shared<oatpp::mysql::ConsistencySession>();
+
+    {
+      oatpp::mysql::ConsistencySession::Scope scope(session);
+
+      auto transaction = trackingClient.beginTransaction();
+      OATPP_ASSERT(trackingClient.insertValue(1, transaction.getConnection())->isSuccess());
+      OATPP_ASSERT(trackingClient.insertValue(2, transaction.getConnection())->isSuccess());
+
+      // the transaction gets its GTID on commit
+      OATPP_ASSERT(session->getGtids().isEmpty());
+      OATPP_ASSERT(transaction.commit()->isSuccess());
+    }
+
+    OATPP_ASSERT(session->getGtids().isEmpty() == !gtidsEnabled);
+  }
+
+}
+
+}}}}
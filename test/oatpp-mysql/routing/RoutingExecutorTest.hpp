@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_routing_RoutingExecutorTest_hpp
+#define oatpp_test_mysql_routing_RoutingExecutorTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace routing {
+
+class RoutingExecutorTest : public UnitTest {
+public:
+  RoutingExecutorTest() : UnitTest("TEST[mysql::routing::RoutingExecutorTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_routing_RoutingExecutorTest_hpp
@@ -0,0 +1,71 @@
+#include "ParallelScanTest.hpp"
+
+#include "oatpp-mysql/ParallelScan.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace scan {
+
+namespace {
+
+typedef oatpp::mysql::ParallelScan ParallelScan;
+
+v_int64 boundary(const std::vector<oatpp::Void>& boundaries, size_t index) {
+  return *boundaries[index].cast<oatpp::Int64>();
+}
+
+}
+
+void ParallelScanTest::onRun() {
+
+  {
+    auto boundaries = ParallelScan::splitRange(0, 100, 4);
+    OATPP_ASSERT(boundaries.size() == 5);
+    OATPP_ASSERT(boundary(boundaries, 0) == 0);
+    OATPP_ASSERT(boundary(boundaries, 1) == 25);
+    OATPP_ASSERT(boundary(boundaries, 2) == 50);
+    OATPP_ASSERT(boundary(boundaries, 3) == 75);
+    OATPP_ASSERT(boundary(boundaries, 4) == 100);
+  }
+
+  {
+    // remainder goes to the first partitions - sizes differ by one at most
+    auto boundaries = ParallelScan::splitRange(10, 20, 3);
+    OATPP_ASSERT(boundaries.size() == 4);
+    OATPP_ASSERT(boundary(boundaries, 0) == 10);
+    OATPP_ASSERT(boundary(boundaries, 1) == 14);
+    OATPP_ASSERT(boundary(boundaries, 2) == 17);
+    OATPP_ASSERT(boundary(boundaries, 3) == 20);
+  }
+
+  {
+    // more partitions than keys - empty partitions at the end
+    auto boundaries = ParallelScan::splitRange(-2, 1, 5);
+    OATPP_ASSERT(boundaries.size() == 6);
+    for(size_t i = 1; i < boundaries.size(); i ++) {
+      OATPP_ASSERT(boundary(boundaries, i - 1) <= boundary(boundaries, i));
+    }
+    OATPP_ASSERT(boundary(boundaries, 0) == -2);
+    OATPP_ASSERT(boundary(boundaries, 3) == 1);
+    OATPP_ASSERT(boundary(boundaries, 5) == 1);
+  }
+
+  {
+    bool thrown = false;
+    try {
+      ParallelScan::splitRange(5, 5, 2);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    thrown = false;
+    try {
+      ParallelScan::splitRange(0, 10, 0);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_scan_ParallelScanTest_hpp
+#define oatpp_test_mysql_scan_ParallelScanTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace scan {
+
+class ParallelScanTest : public UnitTest {
+public:
+  ParallelScanTest() : UnitTest("TEST[mysql::scan::ParallelScanTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_scan_ParallelScanTest_hpp
@@ -0,0 +1,78 @@
+#include "GtidSetTest.hpp"
+
+#include "oatpp-mysql/ConsistencySession.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace session {
+
+namespace {
+
+typedef oatpp::mysql::ConsistencySession::GtidSet GtidSet;
+
+}
+
+void GtidSetTest::onRun() {
+
+  {
+    GtidSet set;
+    OATPP_ASSERT(set.isEmpty());
+
+    set.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:23");
+    set.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:5");
+
+    OATPP_LOGd(TAG, "set='{}'", set.toString());
+    OATPP_ASSERT(set.toString() == "3E11FA47-71CA-11E1-9E33-C80AA9429562:5:23");
+
+    set.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:6-22");
+    OATPP_ASSERT(set.toString() == "3E11FA47-71CA-11E1-9E33-C80AA9429562:5-23");
+  }
+
+  {
+    GtidSet set;
+    set.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:1-5:11-18,\n 4E11FA47-71CA-11E1-9E33-C80AA9429562:tag:1-3");
+
+    OATPP_LOGd(TAG, "set='{}'", set.toString());
+    OATPP_ASSERT(set.toString() == "3E11FA47-71CA-11E1-9E33-C80AA9429562:1-5:11-18,4E11FA47-71CA-11E1-9E33-C80AA9429562:tag:1-3");
+
+    set.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:4-12");
+    OATPP_ASSERT(set.toString() == "3E11FA47-71CA-11E1-9E33-C80AA9429562:1-18,4E11FA47-71CA-11E1-9E33-C80AA9429562:tag:1-3");
+  }
+
+  {
+    GtidSet applied;
+    applied.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:1-100");
+
+    GtidSet written;
+    written.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:42");
+    OATPP_ASSERT(applied.contains(written));
+
+    written.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:101");
+    OATPP_ASSERT(!applied.contains(written));
+
+    applied.merge(written);
+    OATPP_ASSERT(applied.contains(written));
+
+    written.add("4E11FA47-71CA-11E1-9E33-C80AA9429562:1");
+    OATPP_ASSERT(!applied.contains(written));
+  }
+
+  {
+    // executed set of the source with a gap - purged or skipped transactions
+    GtidSet applied;
+    applied.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:1-10:20-30");
+
+    GtidSet written;
+    written.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:25");
+    OATPP_ASSERT(applied.contains(written));
+    OATPP_ASSERT(written.toString() == "3E11FA47-71CA-11E1-9E33-C80AA9429562:25");
+
+    written.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:15");
+    OATPP_ASSERT(!applied.contains(written));
+
+    GtidSet spanning;
+    spanning.add("3E11FA47-71CA-11E1-9E33-C80AA9429562:8-22");
+    OATPP_ASSERT(!applied.contains(spanning));
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_session_GtidSetTest_hpp
+#define oatpp_test_mysql_session_GtidSetTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace session {
+
+class GtidSetTest : public UnitTest {
+public:
+  GtidSetTest() : UnitTest("TEST[mysql::session::GtidSetTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_session_GtidSetTest_hpp
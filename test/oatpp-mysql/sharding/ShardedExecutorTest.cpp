@@ -0,0 +1,177 @@
+#include "ShardedExecutorTest.hpp"
+
+#include "oatpp-mysql/ShardedExecutor.hpp"
+#include "oatpp-mysql/ql_template/Parser.hpp"
+
+#include <cctype>
+#include <cstring>
+
+namespace oatpp { namespace test { namespace mysql { namespace sharding {
+
+namespace {
+
+typedef oatpp::mysql::ShardedQueryResult ShardedQueryResult;
+
+struct Value {
+
+  MYSQL_BIND bind;
+  bool isNull;
+  unsigned long length;
+  v_int64 number;
+  std::string text;
+
+  Value() {
+    std::memset(&bind, 0, sizeof(bind));
+    bind.is_null = &isNull;
+    bind.length = &length;
+    isNull = false;
+  }
+
+  static Value null(enum_field_types type) {
+    Value result;
+    result.bind.buffer_type = type;
+    result.isNull = true;
+    return result;
+  }
+
+  static Value int64(v_int64 value) {
+    Value result;
+    result.number = value;
+    result.bind.buffer_type = MYSQL_TYPE_LONGLONG;
+    result.length = sizeof(v_int64);
+    return result;
+  }
+
+  static Value string(const std::string& value) {
+    Value result;
+    result.text = value;
+    result.bind.buffer_type = MYSQL_TYPE_STRING;
+    result.length = value.size();
+    return result;
+  }
+
+  // buffers are pointed after the copy
+  const MYSQL_BIND& get() {
+    if(bind.buffer_type == MYSQL_TYPE_LONGLONG) {
+      bind.buffer = &number;
+    } else {
+      bind.buffer = &text[0];
+      bind.buffer_length = text.size() + 1;
+    }
+    bind.is_null = &isNull;
+    bind.length = &length;
+    return bind;
+  }
+
+};
+
+v_int32 compare(Value a, Value b, const ShardedQueryResult::StringComparator& comparator = nullptr) {
+  return ShardedQueryResult::compareValues(a.get(), b.get(), comparator);
+}
+
+v_int32 compareCaseInsensitive(const char* a, v_buff_size aSize, const char* b, v_buff_size bSize) {
+  for(v_buff_size i = 0; i < aSize && i < bSize; i ++) {
+    int x = std::tolower((unsigned char) a[i]);
+    int y = std::tolower((unsigned char) b[i]);
+    if(x != y) {
+      return x - y;
+    }
+  }
+  return (aSize > bSize) - (aSize < bSize);
+}
+
+}
+
+void ShardedExecutorTest::onRun() {
+
+  {
+    // providers are not used - no queries are executed
+    std::vector<std::shared_ptr<oatpp::provider::Provider<oatpp::mysql::Connection>>> providers(3);
+    oatpp::mysql::ShardedExecutor executor(providers);
+
+    OATPP_ASSERT(executor.getShardsCount() == 3);
+
+    // integers modulo shards count, strings by FNV-1a
+    OATPP_ASSERT(executor.getShardIndex(oatpp::Int64(7)) == 1);
+    OATPP_ASSERT(executor.getShardIndex(oatpp::Int64(-7)) == 1);
+    OATPP_ASSERT(executor.getShardIndex(oatpp::UInt32(9)) == 0);
+    OATPP_ASSERT(executor.getShardIndex(oatpp::String("tenant-42")) == 1);
+
+    bool thrown = false;
+    try {
+      executor.getShardIndex(oatpp::Float64(1.5));
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    executor.setShardFunction([](const oatpp::Void& key, v_int32 shardsCount) {
+      (void) key;
+      return shardsCount - 1;
+    });
+    OATPP_ASSERT(executor.getShardIndex(oatpp::Int64(7)) == 2);
+
+    auto queryTemplate = executor.parseQueryTemplate(
+      "getUsers",
+      "/*oatpp: shard_key=user.tenantId, merge_order=created_at:desc*/ SELECT * FROM users WHERE tenant_id=:user.tenantId;",
+      {}, false
+    );
+    auto extra = std::static_pointer_cast<oatpp::mysql::ql_template::Parser::TemplateExtra>(queryTemplate.getExtraData());
+    OATPP_ASSERT(extra->getHint("shard_key") == "user.tenantId");
+    OATPP_ASSERT(extra->getHint("merge_order") == "created_at:desc");
+
+    // writes without the key value are not fanned out
+    auto updateAll = executor.parseQueryTemplate("updateAll", "UPDATE users SET active=0;", {}, false);
+    thrown = false;
+    try {
+      executor.execute(updateAll, {});
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    auto updateTenant = executor.parseQueryTemplate(
+      "updateTenant",
+      "/*oatpp: shard_key=tenantId*/ UPDATE users SET active=0 WHERE tenant_id=:tenantId;",
+      {}, false
+    );
+    thrown = false;
+    try {
+      executor.execute(updateTenant, {{"tenantId", oatpp::Int64(nullptr)}});
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+
+    // transaction can't span shards
+    thrown = false;
+    try {
+      executor.begin();
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+  {
+    OATPP_ASSERT(compare(Value::int64(1), Value::int64(2)) < 0);
+    OATPP_ASSERT(compare(Value::int64(-5), Value::int64(-5)) == 0);
+    OATPP_ASSERT(compare(Value::null(MYSQL_TYPE_LONGLONG), Value::int64(-5)) < 0);
+    OATPP_ASSERT(compare(Value::int64(-5), Value::null(MYSQL_TYPE_LONGLONG)) > 0);
+
+    OATPP_ASSERT(compare(Value::string("B"), Value::string("a")) < 0);
+    OATPP_ASSERT(compare(Value::string("ab"), Value::string("abc")) < 0);
+    OATPP_ASSERT(compare(Value::string("B"), Value::string("a"), &compareCaseInsensitive) > 0);
+    OATPP_ASSERT(compare(Value::string("ABC"), Value::string("abc"), &compareCaseInsensitive) == 0);
+  }
+
+  {
+    OATPP_ASSERT(ShardedQueryResult::isBytewiseCollation(63));  // binary
+    OATPP_ASSERT(ShardedQueryResult::isBytewiseCollation(46));  // utf8mb4_bin
+    OATPP_ASSERT(!ShardedQueryResult::isBytewiseCollation(255)); // utf8mb4_0900_ai_ci
+    OATPP_ASSERT(!ShardedQueryResult::isBytewiseCollation(45));  // utf8mb4_general_ci
+  }
+
+}
+
+}}}}
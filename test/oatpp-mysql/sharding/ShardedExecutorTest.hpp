@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_sharding_ShardedExecutorTest_hpp
+#define oatpp_test_mysql_sharding_ShardedExecutorTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace sharding {
+
+class ShardedExecutorTest : public UnitTest {
+public:
+  ShardedExecutorTest() : UnitTest("TEST[mysql::sharding::ShardedExecutorTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_sharding_ShardedExecutorTest_hpp
@@ -0,0 +1,49 @@
+#include "CsvRowSinkTest.hpp"
+
+#include "oatpp-mysql/stream/CsvRowSink.hpp"
+#include "oatpp/data/stream/BufferStream.hpp"
+
+#include <string>
+
+namespace oatpp { namespace test { namespace mysql { namespace stream {
+
+namespace {
+
+typedef oatpp::mysql::stream::CsvRowSink CsvRowSink;
+
+oatpp::String writeField(CsvRowSink& sink, const std::string& value) {
+  oatpp::data::stream::BufferOutputStream stream;
+  sink.writeField(&stream, value.data(), value.size());
+  return stream.toString();
+}
+
+}
+
+void CsvRowSinkTest::onRun() {
+
+  {
+    OATPP_LOGd(TAG, "--- default delimiter ---");
+    CsvRowSink sink;
+    OATPP_ASSERT(writeField(sink, "") == "");
+    OATPP_ASSERT(writeField(sink, "plain") == "plain");
+    OATPP_ASSERT(writeField(sink, "a;b") == "a;b");
+    OATPP_ASSERT(writeField(sink, "a,b") == "\"a,b\"");
+    OATPP_ASSERT(writeField(sink, "line\nbreak") == "\"line\nbreak\"");
+    OATPP_ASSERT(writeField(sink, "cr\r") == "\"cr\r\"");
+    OATPP_ASSERT(writeField(sink, "say \"hi\"") == "\"say \"\"hi\"\"\"");
+    OATPP_ASSERT(writeField(sink, "\"") == "\"\"\"\"");
+    OATPP_ASSERT(writeField(sink, "\"\"") == "\"\"\"\"\"\"");
+  }
+
+  {
+    OATPP_LOGd(TAG, "--- custom delimiter ---");
+    CsvRowSink::Config config;
+    config.delimiter = ';';
+    CsvRowSink sink(config);
+    OATPP_ASSERT(writeField(sink, "a,b") == "a,b");
+    OATPP_ASSERT(writeField(sink, "a;b") == "\"a;b\"");
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_stream_CsvRowSinkTest_hpp
+#define oatpp_test_mysql_stream_CsvRowSinkTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace stream {
+
+class CsvRowSinkTest : public UnitTest {
+public:
+  CsvRowSinkTest() : UnitTest("TEST[mysql::stream::CsvRowSinkTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_stream_CsvRowSinkTest_hpp
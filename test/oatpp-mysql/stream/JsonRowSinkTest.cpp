@@ -0,0 +1,83 @@
+#include "JsonRowSinkTest.hpp"
+
+#include "oatpp-mysql/stream/JsonRowSink.hpp"
+#include "oatpp/data/stream/BufferStream.hpp"
+
+#include <cstring>
+#include <string>
+
+namespace oatpp { namespace test { namespace mysql { namespace stream {
+
+namespace {
+
+typedef oatpp::mysql::stream::JsonRowSink JsonRowSink;
+
+oatpp::String writeString(const std::string& value) {
+  oatpp::data::stream::BufferOutputStream stream;
+  JsonRowSink::writeString(&stream, value.data(), value.size());
+  return stream.toString();
+}
+
+oatpp::String writeBase64(const std::string& value) {
+  oatpp::data::stream::BufferOutputStream stream;
+  JsonRowSink::writeBase64(&stream, value.data(), value.size());
+  return stream.toString();
+}
+
+bool isNumberText(const char* text) {
+  return JsonRowSink::isNumberText(text, std::strlen(text));
+}
+
+}
+
+void JsonRowSinkTest::onRun() {
+
+  {
+    OATPP_LOGd(TAG, "--- escaping ---");
+    OATPP_ASSERT(writeString("") == "\"\"");
+    OATPP_ASSERT(writeString("plain text") == "\"plain text\"");
+    OATPP_ASSERT(writeString("say \"hi\"") == "\"say \\\"hi\\\"\"");
+    OATPP_ASSERT(writeString("C:\\temp") == "\"C:\\\\temp\"");
+    OATPP_ASSERT(writeString("a\nb\r\tc\b\f") == "\"a\\nb\\r\\tc\\b\\f\"");
+    OATPP_ASSERT(writeString(std::string("\x01\x1f", 2)) == "\"\\u0001\\u001f\"");
+    OATPP_ASSERT(writeString(std::string("a\0b", 3)) == "\"a\\u0000b\"");
+    // non-ASCII UTF-8 is written as is
+    OATPP_ASSERT(writeString("\xc3\xa9t\xc3\xa9") == "\"\xc3\xa9t\xc3\xa9\"");
+  }
+
+  {
+    OATPP_LOGd(TAG, "--- base64 ---");
+    OATPP_ASSERT(writeBase64("") == "\"\"");
+    OATPP_ASSERT(writeBase64("f") == "\"Zg==\"");
+    OATPP_ASSERT(writeBase64("fo") == "\"Zm8=\"");
+    OATPP_ASSERT(writeBase64("foo") == "\"Zm9v\"");
+    OATPP_ASSERT(writeBase64("foobar") == "\"Zm9vYmFy\"");
+    OATPP_ASSERT(writeBase64(std::string("\x00\xff\xfe", 3)) == "\"AP/+\"");
+    // longer than the encoder chunk
+    OATPP_ASSERT(writeBase64(std::string(1000, 'x'))->size() == 2 + 1336);
+  }
+
+  {
+    OATPP_LOGd(TAG, "--- number text ---");
+    OATPP_ASSERT(isNumberText("0"));
+    OATPP_ASSERT(isNumberText("-0"));
+    OATPP_ASSERT(isNumberText("42"));
+    OATPP_ASSERT(isNumberText("-12.5"));
+    OATPP_ASSERT(isNumberText("1e5"));
+    OATPP_ASSERT(isNumberText("2.5E-3"));
+    OATPP_ASSERT(!isNumberText(""));
+    OATPP_ASSERT(!isNumberText("-"));
+    OATPP_ASSERT(!isNumberText("01"));
+    OATPP_ASSERT(!isNumberText("0x10"));
+    OATPP_ASSERT(!isNumberText("1."));
+    OATPP_ASSERT(!isNumberText(".5"));
+    OATPP_ASSERT(!isNumberText("+1"));
+    OATPP_ASSERT(!isNumberText("1e"));
+    OATPP_ASSERT(!isNumberText("inf"));
+    OATPP_ASSERT(!isNumberText("nan"));
+    OATPP_ASSERT(!isNumberText("12 "));
+  }
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_stream_JsonRowSinkTest_hpp
+#define oatpp_test_mysql_stream_JsonRowSinkTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace stream {
+
+class JsonRowSinkTest : public UnitTest {
+public:
+  JsonRowSinkTest() : UnitTest("TEST[mysql::stream::JsonRowSinkTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_stream_JsonRowSinkTest_hpp
@@ -1,5 +1,28 @@
-﻿#include "ql_template/ParserTest.hpp"
+﻿#include "connection/ConnectionProviderTest.hpp"
+#include "connection/ExecuteAsyncTest.hpp"
+#include "connection/NonBlockingEngineTest.hpp"
+#include "mapping/ColumnarResultTest.hpp"
+#include "mapping/DecimalCodecTest.hpp"
+#include "mapping/DecodePlanTest.hpp"
+#include "mapping/EnumCodecTest.hpp"
+#include "mapping/FetchPipelineTest.hpp"
+#include "mapping/JsonColumnTest.hpp"
+#include "mapping/RowBatchTest.hpp"
+#include "mapping/StreamColumnTest.hpp"
+#include "mapping/StructReaderTest.hpp"
+#include "mapping/TimeCodecTest.hpp"
+#include "mapping/UuidCodecTest.hpp"
+#include "ql_template/ListExpanderTest.hpp"
+#include "ql_template/ParserTest.hpp"
+#include "routing/RoutingExecutorTest.hpp"
+#include "scan/ParallelScanTest.hpp"
+#include "session/GtidSetTest.hpp"
+#include "sharding/ShardedExecutorTest.hpp"
+#include "stream/CsvRowSinkTest.hpp"
+#include "stream/JsonRowSinkTest.hpp"
+#include "types/BlobStreamTest.hpp"
 #include "types/NumericTest.hpp"
+#include "worker/WorkerPoolTest.hpp"
 
 #include "oatpp/Environment.hpp"
 
@@ -8,8 +31,31 @@
 namespace {
 
 void runTests() {
+  OATPP_RUN_TEST(oatpp::test::mysql::connection::ConnectionProviderTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::connection::ExecuteAsyncTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::connection::NonBlockingEngineTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::ColumnarResultTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::DecimalCodecTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::DecodePlanTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::EnumCodecTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::FetchPipelineTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::JsonColumnTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::RowBatchTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::StreamColumnTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::StructReaderTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::TimeCodecTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::mapping::UuidCodecTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::ql_template::ListExpanderTest);
   OATPP_RUN_TEST(oatpp::test::mysql::ql_template::ParserTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::routing::RoutingExecutorTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::scan::ParallelScanTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::session::GtidSetTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::sharding::ShardedExecutorTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::stream::CsvRowSinkTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::stream::JsonRowSinkTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::types::BlobStreamTest);
   OATPP_RUN_TEST(oatpp::test::mysql::types::NumericTest);
+  OATPP_RUN_TEST(oatpp::test::mysql::worker::WorkerPoolTest);
 }
 
 }
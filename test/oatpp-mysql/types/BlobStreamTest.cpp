@@ -0,0 +1,142 @@
+#include "BlobStreamTest.hpp"
+
+#include "oatpp-mysql/orm.hpp"
+
+#include "oatpp/data/stream/BufferStream.hpp"
+
+#include <string>
+
+namespace oatpp { namespace test { namespace mysql { namespace types {
+
+namespace {
+
+#include OATPP_CODEGEN_BEGIN(DTO)
+
+class BlobRow : public oatpp::DTO {
+
+  DTO_INIT(BlobRow, DTO);
+
+  DTO_FIELD(Int64, id);
+  DTO_FIELD(String, data);
+  DTO_FIELD(Int64, size);
+
+};
+
+#include OATPP_CODEGEN_END(DTO)
+
+#include OATPP_CODEGEN_BEGIN(DbClient)
+
+class MyClient : public oatpp::orm::DbClient {
+public:
+
+  MyClient(const std::shared_ptr<oatpp::orm::Executor>& executor)
+    : oatpp::orm::DbClient(executor)
+  {}
+
+  QUERY(createTable,
+        "CREATE TABLE IF NOT EXISTS test_blob_stream (id BIGINT PRIMARY KEY, data LONGBLOB);")
+
+  QUERY(deleteAll,
+        "DELETE FROM test_blob_stream;")
+
+  QUERY(insertBlob,
+        "INSERT INTO test_blob_stream (id, data) VALUES (:id, :data);",
+        PARAM(oatpp::Int64, id),
+        PARAM(oatpp::mysql::BlobStream, data))
+
+  QUERY(selectAll,
+        "SELECT id, data, LENGTH(data) AS size FROM test_blob_stream ORDER BY id;")
+
+};
+
+#include OATPP_CODEGEN_END(DbClient)
+
+/*
+ * Stream failing after the data is read.
+ */
+class BrokenStream : public oatpp::data::stream::BufferInputStream {
+public:
+
+  BrokenStream(const oatpp::String& data)
+    : oatpp::data::stream::BufferInputStream(data)
+  {}
+
+  v_io_size read(void* data, v_buff_size count, oatpp::async::Action& action) override {
+    auto res = oatpp::data::stream::BufferInputStream::read(data, count, action);
+    if(res == 0) {
+      return oatpp::IOError::BROKEN_PIPE;
+    }
+    return res;
+  }
+
+};
+
+oatpp::mysql::BlobStream createStream(const oatpp::String& data) {
+  return oatpp::mysql::BlobStream(std::make_shared<oatpp::data::stream::BufferInputStream>(data));
+}
+
+}
+
+void BlobStreamTest::onRun() {
+
+  oatpp::mysql::ConnectionOptions options;
+  options.host = "172.17.0.3";
+  options.port = 3306;
+  options.username = "root";
+  options.password = "root";
+  options.database = "test";
+
+  auto connectionProvider = std::make_shared<oatpp::mysql::ConnectionProvider>(options);
+  auto executor = std::make_shared<oatpp::mysql::Executor>(connectionProvider);
+
+  auto client = MyClient(executor);
+
+  OATPP_ASSERT(client.createTable()->isSuccess());
+  OATPP_ASSERT(client.deleteAll()->isSuccess());
+
+  // several upload chunks, zero bytes included
+  std::string bytes(200000, '\0');
+  for(size_t i = 0; i < bytes.size(); i ++) {
+    bytes[i] = (char) ((i * 31) % 256);
+  }
+  oatpp::String data(bytes);
+
+  OATPP_ASSERT(client.insertBlob(1, createStream(data))->isSuccess());
+  OATPP_ASSERT(client.insertBlob(2, createStream(""))->isSuccess());
+  OATPP_ASSERT(client.insertBlob(3, nullptr)->isSuccess());
+
+  {
+    // the row is not inserted if the stream fails
+    bool thrown = false;
+    try {
+      client.insertBlob(4, oatpp::mysql::BlobStream(std::make_shared<BrokenStream>(data)));
+    } catch (const std::runtime_error& e) {
+      OATPP_LOGd(TAG, "broken stream: {}", e.what());
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+  auto res = client.selectAll();
+  OATPP_ASSERT(res->isSuccess());
+
+  auto rows = res->fetch<oatpp::Vector<oatpp::Object<BlobRow>>>();
+  OATPP_ASSERT(rows->size() == 3);
+
+  OATPP_ASSERT(rows[0]->id == 1);
+  OATPP_ASSERT(rows[0]->size == (v_int64) bytes.size());
+  OATPP_ASSERT(rows[0]->data->size() == bytes.size());
+  OATPP_ASSERT(*rows[0]->data == bytes);
+
+  OATPP_ASSERT(rows[1]->id == 2);
+  OATPP_ASSERT(rows[1]->size == 0);
+  OATPP_ASSERT(rows[1]->data != nullptr);
+  OATPP_ASSERT(rows[1]->data->empty());
+
+  OATPP_ASSERT(rows[2]->id == 3);
+  OATPP_ASSERT(rows[2]->size == nullptr);
+  OATPP_ASSERT(rows[2]->data == nullptr);
+
+}
+
+}}}}
@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_types_BlobStreamTest_hpp
+#define oatpp_test_mysql_types_BlobStreamTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace types {
+
+class BlobStreamTest : public UnitTest {
+public:
+  BlobStreamTest() : UnitTest("TEST[mysql::types::BlobStreamTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_types_BlobStreamTest_hpp
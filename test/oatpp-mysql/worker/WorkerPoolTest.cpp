@@ -0,0 +1,169 @@
+#include "WorkerPoolTest.hpp"
+
+#include "oatpp-mysql/WorkerPool.hpp"
+
+#include "oatpp/async/Executor.hpp"
+
+#include <future>
+
+namespace oatpp { namespace test { namespace mysql { namespace worker {
+
+namespace {
+
+typedef oatpp::mysql::WorkerPool WorkerPool;
+
+class TaskCoroutine : public oatpp::async::Coroutine<TaskCoroutine> {
+private:
+  WorkerPool* m_pool;
+  v_int32 m_value;
+  std::atomic<v_int32>* m_result;
+  std::atomic<bool>* m_failed;
+public:
+
+  TaskCoroutine(WorkerPool* pool, v_int32 value, std::atomic<v_int32>* result, std::atomic<bool>* failed)
+    : m_pool(pool)
+    , m_value(value)
+    , m_result(result)
+    , m_failed(failed)
+  {}
+
+  Action act() override {
+    v_int32 value = m_value;
+    return m_pool->execute<v_int32>([value]() {
+      if(value < 0) {
+        throw std::runtime_error("negative value");
+      }
+      return value * 2;
+    }).callbackTo(&TaskCoroutine::onResult);
+  }
+
+  Action onResult(const v_int32& result) {
+    *m_result = result;
+    return finish();
+  }
+
+  Action handleError(Error* error) override {
+    *m_failed = true;
+    return error;
+  }
+
+};
+
+}
+
+void WorkerPoolTest::onRun() {
+
+  {
+    // more tasks than the queue holds - the rest are run by the calling thread
+    WorkerPool pool(2, 1);
+    std::vector<std::atomic<v_int32>> counters(16);
+    std::vector<WorkerPool::Task> tasks;
+    for(size_t i = 0; i < counters.size(); i ++) {
+      counters[i] = 0;
+      auto counter = &counters[i];
+      tasks.push_back([counter]() {
+        (*counter) ++;
+      });
+    }
+    pool.runAll(tasks);
+    for(auto& counter : counters) {
+      OATPP_ASSERT(counter == 1);
+    }
+  }
+
+  {
+    // error is rethrown only after every task is done
+    WorkerPool pool(2, 16);
+    std::atomic<v_int32> done(0);
+    std::vector<WorkerPool::Task> tasks;
+    for(v_int32 i = 0; i < 8; i ++) {
+      tasks.push_back([i, &done]() {
+        if(i == 3) {
+          throw std::runtime_error("task failed");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        done ++;
+      });
+    }
+    bool thrown = false;
+    try {
+      pool.runAll(tasks);
+    } catch (const std::runtime_error& e) {
+      OATPP_ASSERT(std::string(e.what()) == "task failed");
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+    OATPP_ASSERT(done == 7);
+  }
+
+  {
+    // tryPost doesn't wait for room in the queue
+    WorkerPool pool(1, 1);
+    std::promise<void> started;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    OATPP_ASSERT(pool.tryPost([&started, released]() {
+      started.set_value();
+      released.wait();
+    }));
+    started.get_future().wait();
+
+    std::atomic<v_int32> counter(0);
+    OATPP_ASSERT(pool.tryPost([&counter]() { counter ++; }));
+    OATPP_ASSERT(!pool.tryPost([&counter]() { counter ++; }));
+
+    release.set_value();
+    pool.stop();
+    OATPP_ASSERT(counter == 1);
+
+    bool thrown = false;
+    try {
+      pool.tryPost([]() {});
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    OATPP_ASSERT(thrown);
+  }
+
+  {
+    // runAll() from the only worker thread of the pool doesn't deadlock
+    WorkerPool pool(1, 1);
+    std::promise<v_int32> result;
+    pool.post([&pool, &result]() {
+      std::atomic<v_int32> counter(0);
+      std::vector<WorkerPool::Task> tasks(4, [&counter]() { counter ++; });
+      pool.runAll(tasks);
+      result.set_value(counter);
+    });
+    auto future = result.get_future();
+    OATPP_ASSERT(future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    OATPP_ASSERT(future.get() == 4);
+  }
+
+  {
+    // coroutine is resumed with the result or the error of the blocking call
+    WorkerPool pool(2, 1);
+    oatpp::async::Executor executor(1, 1, 1);
+
+    std::atomic<v_int32> result(0);
+    std::atomic<bool> failed(false);
+    std::atomic<v_int32> errorResult(0);
+    std::atomic<bool> errorFailed(false);
+
+    executor.execute<TaskCoroutine>(&pool, 21, &result, &failed);
+    executor.execute<TaskCoroutine>(&pool, -1, &errorResult, &errorFailed);
+
+    executor.waitTasksFinished();
+    executor.stop();
+    executor.join();
+
+    OATPP_ASSERT(result == 42);
+    OATPP_ASSERT(!failed);
+    OATPP_ASSERT(errorResult == 0);
+    OATPP_ASSERT(errorFailed);
+  }
+
+}
+
+}}}}
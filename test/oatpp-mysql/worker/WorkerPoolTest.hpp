@@ -0,0 +1,16 @@
+#ifndef oatpp_test_mysql_worker_WorkerPoolTest_hpp
+#define oatpp_test_mysql_worker_WorkerPoolTest_hpp
+
+#include "oatpp-test/UnitTest.hpp"
+
+namespace oatpp { namespace test { namespace mysql { namespace worker {
+
+class WorkerPoolTest : public UnitTest {
+public:
+  WorkerPoolTest() : UnitTest("TEST[mysql::worker::WorkerPoolTest]") {}
+  void onRun() override;
+};
+
+}}}}
+
+#endif // oatpp_test_mysql_worker_WorkerPoolTest_hpp